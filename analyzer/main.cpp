@@ -0,0 +1,384 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file main.cpp
+ * @brief recorded sessions analyzer; replays all the sessions of the given
+ * files (see analytics.hpp), prints one summary line per level, then the
+ * visits and walls collisions heatmaps of every played floor and the cells
+ * where the players lose lifes or run out of time; with the --csv option,
+ * also writes one CSV file per level into the given directory; must be
+ * executed from the game directory
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "analytics.hpp"
+#include "Level.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+
+using namespace memoris;
+
+namespace
+{
+
+using Level = entities::Level;
+
+/* from the less to the most counted cells */
+constexpr char SHADES[] {" .:-=+*#%@"};
+constexpr unsigned short SHADES_AMOUNT {sizeof(SHADES) - 1};
+
+/* the amount of cells listed for the lost lifes and the time overs */
+constexpr size_t LISTED_CELLS {5};
+
+constexpr float MILLISECONDS_PER_SECOND {1000.f};
+
+/**
+ * @brief returns the median of the given times, in seconds
+ *
+ * @param times the times in milliseconds, reordered by the function
+ *
+ * @return const float 0 if there is no time
+ */
+const float getMedian(std::vector<unsigned int>& times)
+{
+    if (times.empty())
+    {
+        return 0.f;
+    }
+
+    const auto median = times.begin() + times.size() / 2;
+
+    std::nth_element(
+        times.begin(),
+        median,
+        times.end()
+    );
+
+    return *median / MILLISECONDS_PER_SECOND;
+}
+
+/**
+ * @brief returns the percentage of the given amount of sessions
+ *
+ * @param amount the amount of sessions
+ * @param sessions the total amount of sessions
+ *
+ * @return const float
+ */
+const float getPercentage(
+    const unsigned int& amount,
+    const unsigned int& sessions
+)
+{
+    return sessions == 0 ? 0.f : 100.f * amount / sessions;
+}
+
+/**
+ * @brief prints one summary line per level
+ *
+ * @param levels the aggregated levels, the first stars times are reordered
+ */
+void printSummary(std::vector<analytics::LevelHeatmap>& levels)
+{
+    std::cout << std::left << std::setw(36) << "level" << std::right <<
+        std::setw(9) << "sessions" << std::setw(7) << "win%" <<
+        std::setw(7) << "time%" << std::setw(7) << "life%" <<
+        std::setw(7) << "left%" << std::setw(8) << "star1st" <<
+        std::setw(8) << "walls" << std::endl;
+
+    for (analytics::LevelHeatmap& level : levels)
+    {
+        unsigned int wallCollisions {0};
+
+        for (const unsigned int& collisions : level.wallCollisions)
+        {
+            wallCollisions += collisions;
+        }
+
+        const unsigned int& sessions = level.sessions;
+
+        std::cout << std::left << std::setw(36) << level.filePath <<
+            std::right << std::fixed << std::setprecision(1) <<
+            std::setw(9) << sessions <<
+            std::setw(7) << getPercentage(level.wins, sessions) <<
+            std::setw(7) << getPercentage(level.timeOverSessions, sessions) <<
+            std::setw(7) << getPercentage(level.noLifeSessions, sessions) <<
+            std::setw(7) <<
+                getPercentage(level.unfinishedSessions, sessions) <<
+            std::setw(8) << getMedian(level.firstStarTimes) <<
+            std::setw(8) << wallCollisions << std::endl;
+    }
+}
+
+/**
+ * @brief prints one line of a floor heatmap, two characters per cell
+ *
+ * @param counters the counters of the level
+ * @param firstIndex the index of the first cell of the line
+ * @param maximum the highest counter of the floor, not 0
+ */
+void printHeatmapLine(
+    const std::vector<unsigned int>& counters,
+    const unsigned short& firstIndex,
+    const unsigned int& maximum
+)
+{
+    for (
+        unsigned short index = firstIndex;
+        index < firstIndex + Level::CELLS_PER_LINE;
+        index++
+    )
+    {
+        const unsigned int& counter = counters[index];
+
+        /* every counted cell is visible, even if it is rarely counted */
+        const unsigned short shade = counter == 0 ? 0 :
+            1 + static_cast<unsigned short>(
+                static_cast<unsigned long long>(counter - 1) *
+                    (SHADES_AMOUNT - 1) / maximum
+            );
+
+        std::cout << SHADES[shade] << SHADES[shade];
+    }
+}
+
+/**
+ * @brief prints the cells with the highest given counters
+ *
+ * @param title the title of the list
+ * @param counters the counters of the level
+ */
+void printTopCells(
+    const std::string& title,
+    const std::vector<unsigned int>& counters
+)
+{
+    std::vector<unsigned short> indices;
+
+    for (unsigned short index {0}; index < counters.size(); index++)
+    {
+        if (counters[index] != 0)
+        {
+            indices.push_back(index);
+        }
+    }
+
+    if (indices.empty())
+    {
+        return;
+    }
+
+    const size_t listed = std::min(indices.size(), LISTED_CELLS);
+
+    std::partial_sort(
+        indices.begin(),
+        indices.begin() + listed,
+        indices.end(),
+        [&counters](const unsigned short& first, const unsigned short& second)
+        {
+            return counters[first] > counters[second];
+        }
+    );
+
+    std::cout << title << ":";
+
+    for (size_t cell {0}; cell < listed; cell++)
+    {
+        const unsigned short& index = indices[cell];
+        const unsigned short floorIndex = index % Level::CELLS_PER_FLOOR;
+
+        std::cout << " " << counters[index] << " on floor " <<
+            index / Level::CELLS_PER_FLOOR + 1 << " (line " <<
+            floorIndex / Level::CELLS_PER_LINE << ", column " <<
+            floorIndex % Level::CELLS_PER_LINE << ")" <<
+            (cell + 1 == listed ? "" : ";");
+    }
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief prints the visits and the walls collisions heatmaps of every
+ * played floor of the given level, side by side, then the cells where the
+ * players lose lifes and run out of time
+ *
+ * @param level the aggregated level
+ */
+void printHeatmaps(const analytics::LevelHeatmap& level)
+{
+    std::cout << std::endl << level.filePath << std::endl;
+
+    for (unsigned short floor {0}; floor <= Level::MAX_FLOOR; floor++)
+    {
+        const unsigned short first = floor * Level::CELLS_PER_FLOOR;
+        const unsigned short last = first + Level::CELLS_PER_FLOOR;
+
+        const unsigned int maximumVisits = *std::max_element(
+            level.visits.cbegin() + first,
+            level.visits.cbegin() + last
+        );
+
+        if (maximumVisits == 0)
+        {
+            continue;
+        }
+
+        const unsigned int maximumCollisions = *std::max_element(
+            level.wallCollisions.cbegin() + first,
+            level.wallCollisions.cbegin() + last
+        );
+
+        std::cout << "floor " << floor + 1 << ": visits (max " <<
+            maximumVisits << "), walls collisions (max " <<
+            maximumCollisions << ")" << std::endl;
+
+        for (
+            unsigned short line = first;
+            line < last;
+            line += Level::CELLS_PER_LINE
+        )
+        {
+            std::cout << "|";
+            printHeatmapLine(level.visits, line, maximumVisits);
+            std::cout << "|  |";
+            printHeatmapLine(
+                level.wallCollisions,
+                line,
+                maximumCollisions == 0 ? 1 : maximumCollisions
+            );
+            std::cout << "|" << std::endl;
+        }
+    }
+
+    printTopCells("lost lifes", level.lostLifes);
+    printTopCells("time over", level.timeOvers);
+}
+
+/**
+ * @brief writes the counters of the given level into one CSV file, one line
+ * per counted cell
+ *
+ * @param directory the directory of the CSV files
+ * @param level the aggregated level
+ *
+ * @return const bool false if the file cannot be written
+ */
+const bool writeCsv(
+    const std::string& directory,
+    const analytics::LevelHeatmap& level
+)
+{
+    /* the levels of different types may have the same name */
+    std::string name = level.filePath;
+    std::replace(name.begin(), name.end(), '/', '_');
+
+    std::ofstream file(directory + "/" + name + ".csv", std::ofstream::trunc);
+
+    file << "floor,line,column,visits,wall_collisions,lost_lifes,time_overs\n";
+
+    for (unsigned short index {0}; index < Level::CELLS_PER_LEVEL; index++)
+    {
+        const unsigned int& visits = level.visits[index];
+        const unsigned int& collisions = level.wallCollisions[index];
+        const unsigned int& lostLifes = level.lostLifes[index];
+        const unsigned int& timeOvers = level.timeOvers[index];
+
+        if (visits == 0 && collisions == 0 && lostLifes == 0 && timeOvers == 0)
+        {
+            continue;
+        }
+
+        const unsigned short floorIndex = index % Level::CELLS_PER_FLOOR;
+
+        file << index / Level::CELLS_PER_FLOOR + 1 << "," <<
+            floorIndex / Level::CELLS_PER_LINE << "," <<
+            floorIndex % Level::CELLS_PER_LINE << "," << visits << "," <<
+            collisions << "," << lostLifes << "," << timeOvers << "\n";
+    }
+
+    return static_cast<bool>(file);
+}
+
+}
+
+/**
+ *
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+    std::string csvDirectory;
+
+    if (arguments.size() >= 2 && arguments.front() == "--csv")
+    {
+        csvDirectory = arguments[1];
+
+        arguments.erase(arguments.begin(), arguments.begin() + 2);
+    }
+
+    if (arguments.empty())
+    {
+        std::cerr << "Usage: " << argv[0] <<
+            " [--csv directory] sessions_file..." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        auto report = analytics::analyzeSessions(arguments);
+
+        printSummary(report.levels);
+
+        for (const analytics::LevelHeatmap& level : report.levels)
+        {
+            printHeatmaps(level);
+
+            if (!csvDirectory.empty() && !writeCsv(csvDirectory, level))
+            {
+                std::cerr << "Cannot write the CSV file of " <<
+                    level.filePath << std::endl;
+
+                return EXIT_FAILURE;
+            }
+        }
+
+        if (report.rejectedSessions != 0)
+        {
+            std::cerr << report.rejectedSessions <<
+                " sessions rejected (malformed line or unknown level)" <<
+                std::endl;
+        }
+    }
+    catch (const std::invalid_argument& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
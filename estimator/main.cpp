@@ -0,0 +1,197 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file main.cpp
+ * @brief levels difficulty estimator; without argument, prints the
+ * difficulty of every level of data/levels; with the "check" command,
+ * verifies that the levels of the given serie file are ordered by increasing
+ * difficulty; with the "sort" command, rewrites the given serie file with its
+ * levels ordered by increasing difficulty; must be executed from the game
+ * directory
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "difficulty.hpp"
+#include "DirectoryReader.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdlib>
+
+using namespace memoris;
+
+namespace
+{
+
+constexpr const char* LEVELS_DIRECTORIES[] {
+    "data/levels/officials/",
+    "data/levels/personals/"
+};
+
+/**
+ * @brief prints the metrics of the given levels, one line per level
+ *
+ * @param levels the levels to print
+ */
+void printLevels(const std::vector<difficulty::LevelDifficulty>& levels)
+{
+    std::cout << std::left << std::setw(36) << "level" << std::right <<
+        std::setw(8) << "score" << std::setw(7) << "cells" <<
+        std::setw(6) << "path" << std::setw(8) << "transf" <<
+        std::setw(7) << "stairs" << std::setw(7) << "floors" <<
+        std::setw(7) << "slack" << std::endl;
+
+    for (const difficulty::LevelDifficulty& level : levels)
+    {
+        std::cout << std::left << std::setw(36) << level.filePath <<
+            std::right << std::fixed << std::setprecision(1) <<
+            std::setw(8) << level.score <<
+            std::setw(7) << level.cellsToMemorize;
+
+        if (level.solvable)
+        {
+            std::cout << std::setw(6) << level.optimalPathLength;
+        }
+        else
+        {
+            std::cout << std::setw(6) << "-";
+        }
+
+        std::cout << std::setw(5) << level.transformations << "/" <<
+            std::setw(2) << std::left << level.transformationsTypes <<
+            std::right << std::setw(7) << level.stairs <<
+            std::setw(7) << level.usedFloors <<
+            std::setw(7) << level.timeSlack << std::endl;
+    }
+}
+
+/**
+ * @brief rewrites the given serie file with the given levels
+ *
+ * @param seriePath the path of the serie file
+ * @param levels the levels of the serie, in the new order
+ *
+ * @return const bool false if the file cannot be written
+ */
+const bool writeSerie(
+    const std::string& seriePath,
+    const std::vector<difficulty::LevelDifficulty>& levels
+)
+{
+    std::ofstream file(seriePath, std::ofstream::trunc);
+
+    for (const difficulty::LevelDifficulty& level : levels)
+    {
+        const std::string& path = level.filePath;
+        const size_t nameStart = path.find_last_of('/') + 1;
+
+        file << path.substr(nameStart, path.find_last_of('.') - nameStart) <<
+            "\n";
+    }
+
+    return static_cast<bool>(file);
+}
+
+}
+
+/**
+ *
+ */
+int main(int argc, char* argv[])
+{
+    try
+    {
+        if (argc == 1)
+        {
+            std::vector<std::string> paths;
+
+            for (const char* directory : LEVELS_DIRECTORIES)
+            {
+                for (const std::string& name :
+                    utils::getFilesFromDirectory(directory))
+                {
+                    paths.push_back(directory + name + ".level");
+                }
+            }
+
+            auto levels = difficulty::estimateLevels(paths);
+            difficulty::sortByDifficulty(levels);
+
+            printLevels(levels);
+
+            return EXIT_SUCCESS;
+        }
+
+        const std::string command = argv[1];
+
+        if (argc != 3 || (command != "check" && command != "sort"))
+        {
+            std::cerr << "Usage: " << argv[0] <<
+                " [check|sort data/series/[officials|personals]/name.serie]" <<
+                std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        const std::string seriePath = argv[2];
+
+        auto levels = difficulty::estimateLevels(
+            difficulty::getSerieLevelsPaths(seriePath)
+        );
+
+        printLevels(levels);
+
+        if (command == "check")
+        {
+            if (!difficulty::isOrderedByDifficulty(levels))
+            {
+                std::cout << seriePath <<
+                    " is not ordered by increasing difficulty" << std::endl;
+
+                return EXIT_FAILURE;
+            }
+
+            return EXIT_SUCCESS;
+        }
+
+        difficulty::sortByDifficulty(levels);
+
+        if (!writeSerie(seriePath, levels))
+        {
+            std::cerr << "Cannot write " << seriePath << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        std::cout << seriePath << " ordered by increasing difficulty" <<
+            std::endl;
+    }
+    catch (const std::invalid_argument& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
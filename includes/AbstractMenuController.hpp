@@ -63,7 +63,8 @@ protected:
     ~AbstractMenuController() noexcept;
 
     /**
-     * @brief insert one menu item pointer inside the menu items list
+     * @brief insert one menu item pointer inside the menu items list; the
+     * menu items are created into the controller arena (see getArena())
      *
      * @param item unique pointer to the menu item to insert;
      *
@@ -86,7 +87,7 @@ protected:
      * is not supposed to throw exceptions, push_back can still throw
      * exceptions for other reasons
      */
-    void addMenuItem(std::unique_ptr<items::MenuItem> item) &;
+    void addMenuItem(allocators::ArenaPtr<items::MenuItem> item) &;
 
     /**
      * @brief display all the menu items
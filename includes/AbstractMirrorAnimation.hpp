@@ -27,6 +27,7 @@
 #define MEMORIS_ABSTRACTMIRRORANIMATION
 
 #include "LevelAnimation.hpp"
+#include "allocators.hpp"
 
 namespace memoris
 {
@@ -83,6 +84,12 @@ protected:
      */
     void setNoTransparent() & noexcept;
 
+    /**
+     * @brief sets the animated side back to no transparent when the
+     * animation is started
+     */
+    void resetAnimation(const utils::Context&) & override;
+
     /**
      * @brief applies the current animated side transparency on the given cell
      *
@@ -104,7 +111,7 @@ private:
     static constexpr sf::Uint8 MAXIMUM_TRANSPARENCY {255};
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 1, 1> impl;
 };
 
 }
@@ -0,0 +1,100 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file AssetPack.hpp
+ * @brief read-only access to the assets pack (see packs.hpp); the pack is
+ * mapped into the memory, so the assets are directly given to SFML from the
+ * mapped pages, without any copy and without opening one file per asset; if
+ * there is no pack, the game uses the separated files
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_ASSETPACK_H_
+#define MEMORIS_ASSETPACK_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <string>
+
+namespace memoris
+{
+namespace utils
+{
+
+/**
+ * the content of one asset; the data stays valid as long as the pack exists,
+ * so it can be used by the SFML objects that read their memory on demand
+ * (fonts, musics)
+ */
+struct AssetView
+{
+    /* nullptr if the asset is not into the pack */
+    const char* data {nullptr};
+
+    size_t size {0};
+};
+
+class AssetPack : public NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, maps the given pack file and reads its index; no
+     * asset is read
+     *
+     * @param path the path of the pack file; if the file does not exist, the
+     * pack is empty
+     *
+     * @throw std::invalid_argument the pack exists but is not valid; the
+     * exception is never caught and the program stops
+     */
+    AssetPack(const std::string& path);
+
+    /**
+     * @brief destructor, unmaps the pack file
+     */
+    ~AssetPack() noexcept;
+
+    /**
+     * @brief returns the content of the given asset; a compressed asset is
+     * decompressed the first time it is requested and kept in memory
+     *
+     * @param path the path of the original asset file
+     *
+     * @return const AssetView
+     *
+     * @throw std::invalid_argument the compressed asset is corrupted
+     *
+     * not noexcept because the decompression buffer allocation may throw
+     */
+    const AssetView getAsset(const std::string& path) const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
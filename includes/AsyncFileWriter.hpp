@@ -0,0 +1,111 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file AsyncFileWriter.hpp
+ * @brief writes files on a background thread, so a file writing never blocks
+ * the rendering of one frame; every file is written atomically: the content
+ * is written into a temporary file that replaces the destination file only
+ * when it is completely written on the disk; the appends and the writings
+ * are executed in the order they are queued
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_ASYNCFILEWRITER_H_
+#define MEMORIS_ASYNCFILEWRITER_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+namespace utils
+{
+
+class AsyncFileWriter : public NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, starts the writing thread
+     *
+     * @throw std::system_error the thread cannot be started; the exception
+     * is never caught and the program stops
+     */
+    AsyncFileWriter();
+
+    /**
+     * @brief destructor, writes all the remaining files and stops the writing
+     * thread; the pending writings are never lost when the program is closed
+     */
+    ~AsyncFileWriter() noexcept;
+
+    /**
+     * @brief adds one file to the writing queue; the function returns
+     * immediately, the file is written later by the writing thread; when
+     * many writings of the same file are queued, they are executed in order,
+     * so the last queued content is always the final one
+     *
+     * @param path the path of the file to write
+     * @param content the bytes to write, moved into the queue
+     *
+     * @return std::future<bool> true when the file has been written and
+     * renamed, false if one of the file system operations failed; the
+     * future can be ignored by the caller
+     *
+     * not noexcept because the queue insertion may throw std::bad_alloc
+     */
+    std::future<bool> write(
+        const std::string& path,
+        std::vector<char> content
+    ) const &;
+
+    /**
+     * @brief adds one append to the writing queue; the content is added at
+     * the end of the file (the file is created if it does not exist); an
+     * append is not atomic, the readers of appended files must detect a
+     * partially written end of file
+     *
+     * @param path the path of the file to update
+     * @param content the bytes to append, moved into the queue
+     *
+     * @return std::future<bool> true when the content has been appended
+     *
+     * not noexcept because the queue insertion may throw std::bad_alloc
+     */
+    std::future<bool> append(
+        const std::string& path,
+        std::vector<char> content
+    ) const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -28,6 +28,7 @@
 
 #include "Context.hpp"
 #include "aliases.hpp"
+#include "allocators.hpp"
 
 #include <SFML/Graphics.hpp>
 
@@ -72,8 +73,9 @@ public:
     );
 
     /**
-     * @brief copy constructor, used to copy cells during the rotation floor
-     * animation
+     * @brief copy constructor, copies the whole cell (position, surface, type
+     * and visibility); required by the floors containers, that store the
+     * cells by value
      *
      * @param cell constant reference to a cell object
      */
@@ -221,6 +223,15 @@ public:
      */
     void setCellColor(const sf::Color& color);
 
+    /**
+     * @brief getter of the color applied on the cell, transparency included
+     *
+     * @return const sf::Color&
+     *
+     * not noexcept because it calls a SFML function that is not noexcept
+     */
+    const sf::Color& getCellColor() const &;
+
     /**
      * @brief changes the cell to an empty cell, this is used by the game
      * controller when the player leaves a cell;
@@ -249,9 +260,11 @@ public:
     /**
      * @brief indicates if the mouse is currently hover this cell
      *
+     * @param context reference to the current context
+     *
      * @return const bool
      */
-    const bool isMouseHover() const;
+    const bool isMouseHover(const utils::Context& context) const;
 
     /**
      * @brief reset the graphical position of the cell to the original one
@@ -298,7 +311,7 @@ private:
     bool highlight {false};
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 8, 4> impl;
 };
 
 }
@@ -18,7 +18,9 @@
 
 /**
  * @file CellsTexturesManager.hpp
- * @brief loads the cells textures
+ * @brief provides the cells textures; every cell texture is declared into
+ * the resources manifest with the 'cell.' prefix followed by the cell type,
+ * so a new cell only requires a new manifest line
  * @package managers
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
@@ -38,22 +40,23 @@ namespace memoris
 namespace managers
 {
 
+class ResourcesRegistry;
+
 class CellsTexturesManager
 {
 
 public:
 
     /**
-     * @brief constructor, loads each texture one by one, stop if one texture
-     * cannot be loaded
+     * @brief constructor, resolves the handle of the texture of every cell
+     * type; no one texture is loaded
      *
-     * @throw std::invalid_argument if one of the image cannot be loaded, an
-     * exception is thrown and never caught to let the program stops
+     * @param registry the resources registry that loads the textures
      *
-     * not 'noexcept' because it throws an exception if one file cannot be
-     * loaded
+     * @throw std::invalid_argument the empty cell texture is not declared;
+     * the exception is never caught to let the program stops
      */
-    CellsTexturesManager();
+    CellsTexturesManager(const ResourcesRegistry& registry);
 
     /**
      * @brief default destructor, empty, declared in order to use forwarding
@@ -67,29 +70,14 @@ public:
      * @param type the type of the cell to get
      *
      * @return const sf::Texture&
+     *
+     * @throw std::invalid_argument the texture file cannot be loaded; the
+     * textures are loaded on first use
      */
-    const sf::Texture& getTextureReferenceByCellType(const char& type) const &
-    noexcept ;
+    const sf::Texture& getTextureReferenceByCellType(const char& type) const &;
 
 private:
 
-    /**
-     * @brief load a texture from the textures folder
-     *
-     * @param texture reference to the SFML texture object that has to be set
-     * @param path file path of the *.png picture to load
-     *
-     * @throw std::invalid_argument the given file cannot be opened; the
-     * exception is not caught in order to close the program directly if at
-     * least one texture cannot be loaded
-     *
-     * not 'const' because modifies the textures of the object
-     */
-    void loadTexture(
-        sf::Texture& texture,
-        const std::string& path
-    ) &;
-
     class Impl;
     std::unique_ptr<Impl> impl;
 };
@@ -29,12 +29,14 @@
 #include "NotCopiable.hpp"
 
 #include <SFML/Config.hpp>
+#include <SFML/System/Vector2.hpp>
 
 #include <memory>
 
 namespace sf
 {
 class RenderWindow;
+class RenderTarget;
 }
 
 namespace memoris
@@ -42,6 +44,7 @@ namespace memoris
 
 namespace managers
 {
+class ResourcesRegistry;
 class TexturesManager;
 class SoundsManager;
 class ColorsManager;
@@ -50,6 +53,8 @@ class CellsTexturesManager;
 class ShapesManager;
 class PlayingSerieManager;
 class EditingLevelManager;
+class LeaderboardManager;
+class LevelTemplatesManager;
 }
 
 namespace entities
@@ -57,9 +62,19 @@ namespace entities
 class Game;
 }
 
+namespace network
+{
+class LeaderboardClient;
+}
+
 namespace utils
 {
 
+class AsyncFileWriter;
+class ThumbnailsGenerator;
+class InputActionsQueue;
+class GameClock;
+
 class Context : public utils::NotCopiable
 {
 
@@ -68,7 +83,7 @@ public:
     /**
      * @brief constructor
      *
-     * @throw std::invalid_argument a texture resource or a font resource
+     * @throw std::invalid_argument the resources manifest or a font resource
      * cannot be loaded; the exception is never caught in order to finish
      */
     Context();
@@ -78,6 +93,14 @@ public:
      */
     ~Context();
 
+    /**
+     * @brief getter of the resources registry
+     *
+     * @return const managers::ResourcesRegistry&
+     */
+    const managers::ResourcesRegistry& getResourcesRegistry() const &
+    noexcept;
+
     /**
      * @brief getter of the textures manager
      *
@@ -140,6 +163,23 @@ public:
      */
     managers::EditingLevelManager& getEditingLevelManager() const & noexcept;
 
+    /**
+     * @brief getter of the leaderboard manager
+     *
+     * @return manager::LeaderboardManager&
+     *
+     * the manager is modified when the results of a serie are loaded
+     */
+    managers::LeaderboardManager& getLeaderboardManager() const & noexcept;
+
+    /**
+     * @brief getter of the level templates manager
+     *
+     * @return const managers::LevelTemplatesManager&
+     */
+    const managers::LevelTemplatesManager& getLevelTemplatesManager() const &
+    noexcept;
+
     /**
      * @brief getter on the SFML window object
      *
@@ -152,8 +192,51 @@ public:
     sf::RenderWindow& getSfmlWindow() const & noexcept;
 
     /**
-     * @brief return the elapsed time (milliseconds) since the clock started
-     * or restarted (maximum value is 49 days, this behavior is undefined)
+     * @brief getter on the target where the screens are drawn; this is the
+     * window itself, or an offscreen scene if the render scale is lower than
+     * 100% or if the frame presenter thread is enabled; the target always
+     * uses the design coordinates (window::WIDTH x window::HEIGHT), whatever its real
+     * size
+     *
+     * @return sf::RenderTarget&
+     *
+     * do not return a constant reference, the SFML draw() method is not
+     * constant
+     */
+    sf::RenderTarget& getRenderTarget() const & noexcept;
+
+    /**
+     * @brief displays the rendered frame on the screen; with the frame
+     * presenter thread, only publishes the frame and returns without waiting
+     * for the window display
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void display() const &;
+
+    /**
+     * @brief stops the frame presenter thread and closes the window
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void closeWindow() const &;
+
+    /**
+     * @brief returns the current position of the mouse into the design
+     * coordinates, the ones used by the drawn surfaces, whatever the render
+     * scale and the real resolution of the window
+     *
+     * @return const sf::Vector2f
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    const sf::Vector2f getMousePosition() const &;
+
+    /**
+     * @brief return the elapsed time (milliseconds) of the animation
+     * timeline since the clock started or restarted (maximum value is 49
+     * days, this behavior is undefined); the animations are paused with this
+     * timeline
      *
      * @return const sf::Int32
      *
@@ -161,6 +244,13 @@ public:
      */
     const sf::Int32 getClockMillisecondsTime() const &;
 
+    /**
+     * @brief getter of the game clock, contains all the timelines
+     *
+     * @return const utils::GameClock&
+     */
+    const GameClock& getGameClock() const & noexcept;
+
     /**
      * @brief load a new music file and play it,
      * silently fails if the music cannot be loaded
@@ -179,9 +269,9 @@ public:
     void stopMusic() const &;
 
     /**
-     * @brief restart the SFML clock; this function is called
-     * everytime the screen is switched from one controller
-     * to another
+     * @brief restart all the timelines of the game clock; this function is
+     * called everytime the screen is switched from one controller to
+     * another
      *
      * some called SFML functions are not noexcept
      */
@@ -194,6 +284,36 @@ public:
      */
     const entities::Game& getGame() const & noexcept;
 
+    /**
+     * @brief getter of the background files writer
+     *
+     * @return const utils::AsyncFileWriter&
+     */
+    const AsyncFileWriter& getAsyncFileWriter() const & noexcept;
+
+    /**
+     * @brief getter of the leaderboard service client
+     *
+     * @return const network::LeaderboardClient&
+     */
+    const network::LeaderboardClient& getLeaderboardClient() const &
+    noexcept;
+
+    /**
+     * @brief getter of the levels thumbnails generator
+     *
+     * @return const utils::ThumbnailsGenerator&
+     */
+    const ThumbnailsGenerator& getThumbnailsGenerator() const & noexcept;
+
+    /**
+     * @brief getter of the game input actions queue, contains the key
+     * bindings and the buffered player actions
+     *
+     * @return const utils::InputActionsQueue&
+     */
+    const InputActionsQueue& getInputActionsQueue() const & noexcept;
+
 private:
 
     class Impl;
@@ -26,6 +26,8 @@
 #ifndef MEMORIS_CONTROLLER_H_
 #define MEMORIS_CONTROLLER_H_
 
+#include "allocators.hpp"
+
 #include <memory>
 
 #include <SFML/Window/Event.hpp>
@@ -76,8 +78,48 @@ public:
         const utils::Context& context
     ) & = 0;
 
+    /**
+     * @brief indicates if the screen rendered at the previous frame is still
+     * up to date: no screen transition is rendering, no event occured
+     * recently and the controller does not animate anything; in that case,
+     * the main loop does not render the same frame again but waits for the
+     * next update with waitForUpdate()
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const bool
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    const bool isIdle(const utils::Context& context) const &;
+
+    /**
+     * @brief blocks until one event occurs or until the static duration of
+     * the controller screen is elapsed; the received event is kept and
+     * returned by the next pollEvent() call, so the controller handles it
+     * during the next rendering
+     *
+     * @param context constant reference to the current context to use
+     *
+     * not 'const' because it stores the received event
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    void waitForUpdate(const utils::Context& context) &;
+
 protected:
 
+    /* the screen changes at every frame, it is never idle */
+    static constexpr sf::Int32 ANIMATED_SCREEN {0};
+
+    /* the screen only changes when an event occurs */
+    static constexpr sf::Int32 STATIC_SCREEN {-1};
+
+    /* the screen changes when a thumbnail generated by the workers of the
+       thumbnails generator is received; the finished thumbnails are checked
+       at this interval, in milliseconds */
+    static constexpr sf::Int32 THUMBNAILS_POLLING_INTERVAL {100};
+
     /**
      * @brief constructor, initializes the implementation
      *
@@ -115,6 +157,49 @@ protected:
         const utils::Context& context
     ) &;
 
+    /**
+     * @brief getter of the memory arena of the controller; the objects that
+     * live as long as the controller are created into this arena, so they
+     * are all released together when the controller is destroyed
+     *
+     * @return allocators::MonotonicArena&
+     */
+    allocators::MonotonicArena& getArena() const & noexcept;
+
+    /**
+     * @brief gets the next window event into the event protected attribute;
+     * the controllers use this function instead of the window pollEvent()
+     * method, so the event received during the idle wait is not lost
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const bool true if one event has been stored into the event
+     * attribute
+     *
+     * not 'const' because it updates the event attribute
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    const bool pollEvent(const utils::Context& context) &;
+
+    /**
+     * @brief returns the amount of milliseconds during which the screen of
+     * the controller does not change if no event occurs; ANIMATED_SCREEN by
+     * default, the controllers that only change on events override it
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const sf::Int32 the duration, ANIMATED_SCREEN if the screen
+     * must be rendered at the next frame, STATIC_SCREEN if the screen never
+     * changes without event
+     *
+     * not 'noexcept' because the children may call SFML methods that are not
+     * noexcept
+     */
+    virtual const sf::Int32 getStaticDuration(
+        const utils::Context& context
+    ) const &;
+
     /* TODO: #784 not included in the implementation because used by the
        children objects, this should be refactored */
     unsigned short nextControllerId {0}, expectedControllerId {0};
@@ -127,6 +212,15 @@ private:
     static constexpr sf::Uint8 COLOR_UPDATE_STEP {51};
     static constexpr sf::Uint8 TRANSITION_STEPS_MAX {5};
 
+    /* the screen is rendered during this delay after the last event or the
+       last transition step, so the effects updated by intervals (cursor
+       position, mouse hover) reach their final state before the wait */
+    static constexpr sf::Int32 IDLE_DELAY {100};
+
+    /* SFML cannot wait for an event with a timeout, the events are polled
+       with this interval when the static duration is limited */
+    static constexpr sf::Int32 EVENTS_POLLING_INTERVAL {10};
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
@@ -71,9 +71,11 @@ private:
      * real cursor position; this function has been created for organization
      * purposes as it is called from two different locations in the code
      *
+     * @param context reference to the current context
+     *
      * not noexcept because it calls SFML functions that are not noexcept
      */
-    void updateCursorPosition() const &;
+    void updateCursorPosition(const utils::Context& context) const &;
 
     class Impl;
     std::unique_ptr<Impl> impl;
@@ -30,8 +30,6 @@
 
 #include "LevelAnimation.hpp"
 
-#include <SFML/Graphics/RectangleShape.hpp>
-
 namespace sf
 {
 class Color;
@@ -150,10 +148,6 @@ private:
         const unsigned short& source,
         const short& difference
     ) &;
-
-    /* the vertical and horizontal separators */
-    sf::RectangleShape verticalSeparator;
-    sf::RectangleShape horizontalSeparator;
 };
 
 }
@@ -27,7 +27,7 @@
 #ifndef MEMORIS_DOUBLESELECTIONLISTSWIDGET_H_
 #define MEMORIS_DOUBLESELECTIONLISTSWIDGET_H_
 
-#include <memory>
+#include "allocators.hpp"
 
 namespace memoris
 {
@@ -99,9 +99,10 @@ public:
 private:
 
     static constexpr char PERSONAL_LEVELS_PATH[] {"data/levels/personals"};
+    static constexpr char LEVELS_EXTENSION[] {".level"};
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 6784, 8> impl;
 };
 
 }
@@ -77,6 +77,20 @@ private:
 
     static constexpr float MESSAGE_VERTICAL_POSITION {300.f};
 
+    /**
+     * @brief the error message never changes, the screen is only rendered again
+     * when an event occurs
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const sf::Int32
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    const sf::Int32 getStaticDuration(
+        const utils::Context& context
+    ) const & override final;
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
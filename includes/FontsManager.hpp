@@ -36,6 +36,12 @@ class Font;
 
 namespace memoris
 {
+
+namespace utils
+{
+class AssetPack;
+}
+
 namespace managers
 {
 
@@ -49,10 +55,13 @@ public:
      * if one loading process failed; the exception is not caught and stops
      * the program, an error message is displayed in the console
      *
+     * @param pack the assets pack, the fonts are loaded from the separated
+     * files if they are not into the pack
+     *
      * @throw std::invalid_argument throw an exception if the file cannot
      * be loaded
      */
-    FontsManager();
+    FontsManager(const utils::AssetPack& pack);
 
     /**
      * @brief default destructor, empty, declared for forwarding declaration
@@ -77,8 +86,10 @@ private:
 
     /**
      * @brief load the font file from the given path into the font object
-     * specified by reference
+     * specified by reference; the font is read from the pack if it contains
+     * the file
      *
+     * @param pack the assets pack
      * @param font reference to the font object to set
      * @param path constant string of the path to the file to load
      *
@@ -93,7 +104,8 @@ private:
      * a font object from a file; it is not supposed to be call according to
      * the instance
      */
-    static void loadFontFromFile(
+    static void loadFont(
+        const utils::AssetPack& pack,
         sf::Font& font,
         const std::string& path
     );
@@ -0,0 +1,115 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file FramePresenter.hpp
+ * @brief presents the rendered frames; by default, the screens are drawn
+ * directly into the window at the 100% render scale, or into an offscreen
+ * scene upscaled to the window at a lower render scale; with the presenting
+ * thread (MEMORIS_PRESENTING_THREAD), every finished frame is published into
+ * a second scene, and the presenting thread upscales the last published one
+ * to the window and displays it; a slow window display (vertical
+ * synchronization, driver stall) then never delays the events handling and
+ * the timers of the main thread; the frames that are published faster than
+ * they can be displayed are dropped
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_FRAMEPRESENTER_H_
+#define MEMORIS_FRAMEPRESENTER_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+
+namespace sf
+{
+class RenderWindow;
+class RenderTarget;
+}
+
+namespace memoris
+{
+namespace utils
+{
+
+class FramePresenter : public NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, creates the scenes required by the render scale
+     * and by the presenting thread, and starts the presenting thread if it
+     * is enabled; the window OpenGL context is given to the presenting
+     * thread; if the scenes cannot be created (no render texture support),
+     * no thread is started and the frames are directly drawn and displayed
+     * into the window by the main thread
+     *
+     * @param window the window to present the frames into, must live longer
+     * than the presenter
+     *
+     * @throw std::system_error the thread cannot be started; the exception
+     * is never caught and the program stops
+     */
+    FramePresenter(sf::RenderWindow& window);
+
+    /**
+     * @brief destructor, stops the presenting thread
+     */
+    ~FramePresenter() noexcept;
+
+    /**
+     * @brief getter on the target where the main thread draws the frames;
+     * the target always uses the design coordinates (window::WIDTH x
+     * window::HEIGHT), whatever its real size
+     *
+     * @return sf::RenderTarget&
+     */
+    sf::RenderTarget& getRenderTarget() const & noexcept;
+
+    /**
+     * @brief publishes the drawn frame for the presenting thread and
+     * returns without waiting for the display; only waits if the presenting
+     * thread is currently reading the previous frame; without the presenting
+     * thread, upscales the scene (if any) and displays the window
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void display() const &;
+
+    /**
+     * @brief stops the presenting thread and gives the window OpenGL context
+     * back to the calling thread; the frames are then directly drawn into the
+     * window; must be called before the window is closed
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void stop() const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
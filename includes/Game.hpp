@@ -26,12 +26,20 @@
 #ifndef MEMORIS_GAME_H_
 #define MEMORIS_GAME_H_
 
+#include "snapshots.hpp"
+
 #include <memory>
 
 #include <string>
 
 namespace memoris
 {
+
+namespace utils
+{
+class AsyncFileWriter;
+}
+
 namespace entities
 {
 
@@ -46,12 +54,58 @@ public:
     Game();
 
     /**
-     * @brief game loader function, loads all the parameters in memory
+     * @brief game loader function, loads all the parameters in memory; the
+     * game file is read at once and contains the snapshot of the in-progress
+     * serie (if any); an empty or invalid file means there is nothing to
+     * resume
      *
      * @param constant reference to a string containing the file name (not
      * the full path)
+     *
+     * not noexcept because the file reading may throw std::bad_alloc
+     */
+    void loadGameFromFile(const std::string& fileName) const &;
+
+    /**
+     * @brief saves the given snapshot as the in-progress serie of the game;
+     * the game file is written by the writing thread, so the function never
+     * blocks the current frame
+     *
+     * @param writer the writer used to write the game file
+     * @param snapshot the snapshot to save
+     *
+     * not noexcept because the serialization may throw std::bad_alloc
+     */
+    void saveSnapshot(
+        const utils::AsyncFileWriter& writer,
+        const snapshots::SerieSnapshot& snapshot
+    ) const &;
+
+    /**
+     * @brief removes the in-progress serie of the game, used when the serie
+     * is finished (won or lost); the game file is emptied on the writing
+     * thread
+     *
+     * @param writer the writer used to write the game file
+     *
+     * not noexcept because the writing queue insertion may throw
      */
-    void loadGameFromFile(const std::string& fileName) const & noexcept;
+    void clearSnapshot(const utils::AsyncFileWriter& writer) const &;
+
+    /**
+     * @brief indicates if the game has an in-progress serie to resume
+     *
+     * @return const bool&
+     */
+    const bool& hasSnapshot() const & noexcept;
+
+    /**
+     * @brief getter of the in-progress serie snapshot, must only be called
+     * if hasSnapshot() returns true
+     *
+     * @return const snapshots::SerieSnapshot&
+     */
+    const snapshots::SerieSnapshot& getSnapshot() const & noexcept;
 
     /**
      * @brief deletes the game file
@@ -90,13 +144,23 @@ private:
 
     /**
      * @brief open the file using the given file name; only used internally
-     * by the two definitions of createGame()
+     * by the two definitions of createGame(); a new game has no in-progress
+     * serie
      *
      * @throw std::ios_base::failure the file cannot be written; the exception
      * is never caught and the program stops
      */
     void createFile() const &;
 
+    /**
+     * @brief returns the path of the game file
+     *
+     * @return const std::string
+     *
+     * not noexcept because the string concatenation may throw
+     */
+    const std::string getFilePath() const &;
+
     static constexpr char GAMES_FILES_DIRECTORY[] {"data/games/"};
     static constexpr char GAMES_FILES_EXTENSION[] {".game"};
 
@@ -108,6 +172,10 @@ private:
     public:
 
         std::string gameName;
+
+        snapshots::SerieSnapshot snapshot;
+
+        bool hasSnapshot {false};
     };
 
     std::unique_ptr<Impl> impl;
@@ -0,0 +1,145 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file GameClock.hpp
+ * @brief monotonic clock of the game, split into independent timelines; every
+ * timeline accumulates the elapsed time of one monotonic source, so it never
+ * drifts, and it can be paused, resumed and scaled without changing the
+ * other ones; the animations use the animation timeline, the level timers use
+ * the game timeline, the real timeline is never paused
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_GAMECLOCK_H_
+#define MEMORIS_GAMECLOCK_H_
+
+#include "NotCopiable.hpp"
+
+#include <SFML/Config.hpp>
+
+#include <memory>
+
+namespace memoris
+{
+namespace utils
+{
+
+class GameClock : public NotCopiable
+{
+
+public:
+
+    enum class Timeline
+    {
+        REAL, /** < never paused nor scaled */
+        GAME, /** < the levels timers */
+        ANIMATION, /** < the animations and the screens effects */
+        TIMELINES_AMOUNT /** < used to size the timelines, not a timeline */
+    };
+
+    /**
+     * @brief constructor, starts all the timelines from zero
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    GameClock();
+
+    /**
+     * @brief default destructor, empty, only declared in order to use
+     * forwarding declaration
+     */
+    ~GameClock() noexcept;
+
+    /**
+     * @brief returns the elapsed time of the given timeline since the last
+     * restart, paused periods excluded and scale applied
+     *
+     * @param timeline the timeline to read
+     *
+     * @return const sf::Int32 the elapsed time in milliseconds
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    const sf::Int32 getMilliseconds(const Timeline& timeline) const &;
+
+    /**
+     * @brief pauses the given timeline; the pauses are counted: the timeline
+     * runs again when every pause() call got its resume() call; the real
+     * timeline is never paused
+     *
+     * @param timeline the timeline to pause
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void pause(const Timeline& timeline) const &;
+
+    /**
+     * @brief cancels one pause of the given timeline
+     *
+     * @param timeline the timeline to resume
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void resume(const Timeline& timeline) const &;
+
+    /**
+     * @brief changes the speed of the given timeline; the time elapsed
+     * before the call is not modified; the real timeline is never scaled
+     *
+     * @param timeline the timeline to update
+     * @param scale the speed, 1 for the real speed, 0.5 for the half speed
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void setScale(
+        const Timeline& timeline,
+        const float& scale
+    ) const &;
+
+    /**
+     * @brief updates the focus of the window; all the timelines except the
+     * real one are paused while the window is not focused; this pause is
+     * independent from the pause() calls
+     *
+     * @param focused true if the window is focused
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void setFocused(const bool& focused) const &;
+
+    /**
+     * @brief restarts all the timelines from zero and cancels their pauses;
+     * called everytime the screen is switched from one controller to
+     * another; the scales and the window focus are kept
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void restart() const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -38,6 +38,11 @@ namespace entities
 class Level;
 }
 
+namespace snapshots
+{
+struct LevelSnapshot;
+}
+
 namespace controllers
 {
 
@@ -81,6 +86,19 @@ public:
         const utils::Context& context
     ) & override final;
 
+    /**
+     * @brief restores the state of a level that has been left before its end;
+     * the watching period is skipped and the player directly plays with the
+     * saved cells, timer and found stars
+     *
+     * @param context constant reference to the current context to use
+     * @param snapshot the level state to restore
+     */
+    void resumeLevel(
+        const utils::Context& context,
+        const snapshots::LevelSnapshot& snapshot
+    ) &;
+
 private:
 
     static constexpr float CELLS_DEFAULT_TRANSPARENCY {255.f};
@@ -91,6 +109,15 @@ private:
        only used with sf::Int32 variables) */
     static constexpr sf::Int32 ONE_SECOND {1000};
 
+    /**
+     * @brief executes the buffered player movements in order, as long as no
+     * animation and no floor transition is rendered; the buffered movements
+     * are dropped when the player cannot play (watching or ending period)
+     *
+     * @param context reference to the current context to use
+     */
+    void executeQueuedMovements(const utils::Context& context);
+
     /**
      * @brief function that refectors all the management related to the player
      * movement; this action is called everytime the player makes a move on
@@ -146,6 +173,16 @@ private:
      */
     void endLevel(const utils::Context& context);
 
+    /**
+     * @brief saves the in-progress serie into the game file when the player
+     * leaves the level; the level state is saved only if the player is
+     * playing and no animation is running, otherwise the level is played
+     * again from its beginning when the serie is resumed
+     *
+     * @param context constant reference to the current context to use
+     */
+    void saveSnapshot(const utils::Context& context) const &;
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
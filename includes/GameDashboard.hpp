@@ -28,17 +28,13 @@
 
 #include <memory>
 
-namespace sf
-{
-class Text;
-}
-
 namespace memoris
 {
 
 namespace widgets
 {
 class TimerWidget;
+class NumericText;
 }
 
 namespace utils
@@ -97,56 +93,44 @@ public:
 
     /**
      * @brief increments the found stars amount and update the SFML surface
-     *
-     * call SFML functions that are not noexcept
      */
-    void incrementFoundStars() const &;
+    void incrementFoundStars() const & noexcept;
 
     /**
      * @brief increments the lifes amount and update the SFML surface
-     *
-     * call SFML functions that are not noexcept
      */
-    void incrementLifes() const &;
+    void incrementLifes() const & noexcept;
 
     /**
      * @brief decrement the lifes amount and update the SFML surface
-     *
-     * call SFML functions that are not noexcept
      */
-    void decrementLifes() const &;
+    void decrementLifes() const & noexcept;
 
     /**
      * @brief increase the watching time seconds by 3
-     *
-     * call SFML functions that are not noexcept
      */
-    void increaseWatchingTime() const &;
+    void increaseWatchingTime() const & noexcept;
 
     /**
      * @brief decrease the amount of seconds of the watching time by 3 seconds
-     *
-     * call SFML functions that are not noexcept
      */
-    void decreaseWatchingTime() const &;
+    void decreaseWatchingTime() const & noexcept;
 
     /**
      * @brief updates the SFML surface that displays the total amount of cells
      *
      * @param amount the amount to display in the dashboard
-     *
-     * call SFML functions that are not noexcept
      */
-    void updateTotalStarsAmountSurface(const unsigned short& amount) const &;
+    void updateTotalStarsAmountSurface(const unsigned short& amount) const &
+    noexcept;
 
     /**
      * @brief updates the SFML surface that displays the current floor index
      *
      * @param amount the amount to display in the dashboard
-     *
-     * call SFML functions that are not noexcept
      */
-    void updateCurrentFloor(const unsigned short& floorIndex) const &;
+    void updateCurrentFloor(const unsigned short& floorIndex) const &
+    noexcept;
 
     /**
      * @brief getter for the timer widget
@@ -174,29 +158,14 @@ private:
      * @brief returns the horizontal position less the surface width
      *
      * @param rightSideHorizontalPosition horizontal position of the surface
-     * @param sfmlSurface SFML texture
+     * @param sfmlSurface the counter surface
      *
      * @return const float
-     *
-     * call sf::Rect::getLocalBounds() method which is not noexcept
      */
     const float getHorizontalPositionLessWidth(
         const float& rightSideHorizontalPosition,
-        const sf::Text& sfmlSurface
-    ) const &;
-
-    /**
-     * @brief replace SFML text surface content by numeric content
-     *
-     * @param sfmlText SFML text surface to update
-     * @param numericValue the numeric value
-     *
-     * call SFML functions that are not noexcept
-     */
-    void updateSfmlTextByNumericValue(
-        sf::Text& sfmlText,
-        const unsigned short& numericValue
-    ) const &;
+        const widgets::NumericText& sfmlSurface
+    ) const & noexcept;
 
     class Impl;
     std::unique_ptr<Impl> impl;
@@ -0,0 +1,121 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file Gradient.hpp
+ * @brief plain color surface with alpha gradients; the whole surface is one
+ * strip of triangles with colored vertices, so it is rendered with only one
+ * draw call and the graphic card interpolates the alpha between two stops
+ * @package others
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_GRADIENT_H_
+#define MEMORIS_GRADIENT_H_
+
+#include "NotCopiable.hpp"
+
+#include <SFML/Config.hpp>
+
+#include <memory>
+#include <initializer_list>
+
+namespace sf
+{
+class Color;
+}
+
+namespace memoris
+{
+
+namespace utils
+{
+class Context;
+}
+
+namespace others
+{
+
+/**
+ * the axis along which the alpha changes
+ */
+enum class GradientAxis
+{
+    HORIZONTAL,
+    VERTICAL
+};
+
+/**
+ * the alpha of the surface at one position of the gradient axis
+ */
+struct GradientStop
+{
+    float position;
+    sf::Uint8 alpha;
+};
+
+class Gradient : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, creates the vertices of the surface
+     *
+     * @param color the color of the surface, its alpha is ignored
+     * @param axis the axis along which the alpha changes
+     * @param crossPosition the position of the surface on the other axis
+     * @param crossSize the size of the surface on the other axis
+     * @param stops the gradient stops, ordered by position; the alpha is
+     * linearly interpolated between two stops
+     *
+     * not noexcept because the vertices allocation may throw
+     */
+    Gradient(
+        const sf::Color& color,
+        const GradientAxis& axis,
+        const float& crossPosition,
+        const float& crossSize,
+        std::initializer_list<GradientStop> stops
+    );
+
+    /**
+     * @brief default destructor, empty, only declared in order to use the
+     * forwarding declarations
+     */
+    ~Gradient() noexcept;
+
+    /**
+     * @brief renders the surface
+     *
+     * @param context reference to the current context to use
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void render(const utils::Context& context) const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
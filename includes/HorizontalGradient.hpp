@@ -70,23 +70,14 @@ public:
 
 private:
 
-    /**
-     * @brief refactored method (for organization purposes), generates the
-     * top and bottom sides surfaces
-     *
-     * @param context constant reference to the current context to use
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
-     */
-    void initializeGradientRectangles(const utils::Context& context) const &; 
-
     static constexpr float BACKGROUND_VERTICAL_POSITION {250.f};
     static constexpr float BACKGROUND_HEIGHT {300.f};
 
-    static constexpr unsigned short SURFACES_AMOUNT {1020};
-    static constexpr unsigned short SIDE_SURFACES_AMOUNT {510};
+    /* the alpha decreases of one unit every two pixels on both sides */
+    static constexpr float SIDE_HEIGHT {510.f};
 
-    static constexpr sf::Uint8 DEFAULT_EFFECT_COLOR_ALPHA {255};
+    static constexpr sf::Uint8 OPAQUE_ALPHA {255};
+    static constexpr sf::Uint8 TRANSPARENT_ALPHA {0};
 
     class Impl;
     std::unique_ptr<Impl> impl;
@@ -0,0 +1,161 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file InputActionsQueue.hpp
+ * @brief maps the keyboard events to game actions and buffers the actions
+ * that cannot be executed immediately (the player movements pressed during
+ * an animation); every buffered action is timestamped and expires after a
+ * delay, so an old key press is never executed too late
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_INPUTACTIONSQUEUE_H_
+#define MEMORIS_INPUTACTIONSQUEUE_H_
+
+#include "NotCopiable.hpp"
+
+#include <SFML/Config.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include <memory>
+
+namespace memoris
+{
+namespace utils
+{
+
+class InputActionsQueue : public NotCopiable
+{
+
+public:
+
+    enum class Action
+    {
+        MOVE_UP,
+        MOVE_DOWN,
+        MOVE_LEFT,
+        MOVE_RIGHT,
+        EXIT,
+        RESTART,
+        NO_ACTION /** < used when a key is not bound or the queue is empty */
+    };
+
+    static constexpr unsigned short DEFAULT_BUFFERING_DEPTH {4};
+
+    /* the actions are stored into a fixed ring buffer, so the buffering
+       never allocates during the game */
+    static constexpr unsigned short MAXIMUM_BUFFERING_DEPTH {16};
+    static constexpr sf::Int32 DEFAULT_EXPIRY {500};
+
+    /**
+     * @brief constructor, binds the default keys (arrows, escape and P)
+     *
+     * @param bufferingDepth the maximum amount of buffered actions, at most
+     * MAXIMUM_BUFFERING_DEPTH; the actions added when the queue is full are
+     * dropped
+     * @param expiry the delay in milliseconds after which a buffered action
+     * is dropped
+     *
+     * not 'noexcept' because the implementation allocation may throw
+     * std::bad_alloc
+     */
+    InputActionsQueue(
+        const unsigned short& bufferingDepth = DEFAULT_BUFFERING_DEPTH,
+        const sf::Int32& expiry = DEFAULT_EXPIRY
+    );
+
+    /**
+     * @brief default destructor, empty, only declared in order to use
+     * forwarding declaration
+     */
+    ~InputActionsQueue() noexcept;
+
+    /**
+     * @brief binds the given key to the given action; the previous action of
+     * the key is replaced; one action can be bound to many keys
+     *
+     * @param key the keyboard key
+     * @param action the action to bind, NO_ACTION to unbind the key
+     */
+    void bindKey(
+        const sf::Keyboard::Key& key,
+        const Action& action
+    ) const & noexcept;
+
+    /**
+     * @brief getter of the action bound to the given key
+     *
+     * @param key the keyboard key
+     *
+     * @return const Action NO_ACTION if the key is not bound
+     */
+    const Action getAction(const sf::Keyboard::Key& key) const & noexcept;
+
+    /**
+     * @brief updates the buffering parameters; the buffered actions are kept,
+     * except the newest ones that exceed the new depth
+     *
+     * @param bufferingDepth the maximum amount of buffered actions, clamped
+     * to MAXIMUM_BUFFERING_DEPTH
+     * @param expiry the delay in milliseconds after which a buffered action
+     * is dropped
+     */
+    void setBuffering(
+        const unsigned short& bufferingDepth,
+        const sf::Int32& expiry
+    ) const & noexcept;
+
+    /**
+     * @brief adds one action at the end of the queue; nothing is done if the
+     * queue is full or if the action is NO_ACTION
+     *
+     * @param action the action to buffer
+     * @param time the time of the key press, in milliseconds
+     */
+    void push(
+        const Action& action,
+        const sf::Int32& time
+    ) const & noexcept;
+
+    /**
+     * @brief removes and returns the oldest action of the queue that is not
+     * expired; the expired actions are dropped
+     *
+     * @param time the current time, in milliseconds
+     *
+     * @return const Action NO_ACTION if there is no action to execute
+     */
+    const Action pop(const sf::Int32& time) const & noexcept;
+
+    /**
+     * @brief drops all the buffered actions
+     */
+    void clear() const & noexcept;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -26,9 +26,10 @@
 #ifndef MEMORIS_INPUTTEXTWIDGET_H_
 #define MEMORIS_INPUTTEXTWIDGET_H_
 
+#include "allocators.hpp"
+
 #include <SFML/Config.hpp>
 
-#include <memory>
 #include <stddef.h>
 
 namespace sf
@@ -104,6 +105,18 @@ public:
      */
     void display(const utils::Context& context) &;
 
+    /**
+     * @brief returns the amount of milliseconds before the next cursor flash;
+     * the widget does not change before this delay if no key is pressed
+     *
+     * @param context reference to the current context to use
+     *
+     * @return const sf::Int32
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    const sf::Int32 getNextFlashDelay(const utils::Context& context) const &;
+
     /**
      * @brief update the displayed text according to the user input
      *
@@ -182,7 +195,7 @@ private:
     void updateCursorPosition() &;
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 2656, 8> impl;
 };
 
 }
@@ -0,0 +1,93 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LeaderboardClient.hpp
+ * @brief uploads the series results to the leaderboard service; the results
+ * are added into an outbound queue that is sent by batches from a separated
+ * thread, so the rendering is never stalled by the network, even if the
+ * server is slow or down; the queue is kept until the server acknowledges it
+ * @package network
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_LEADERBOARDCLIENT_H_
+#define MEMORIS_LEADERBOARDCLIENT_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <string>
+
+namespace memoris
+{
+
+namespace entities
+{
+class SerieResult;
+}
+
+namespace network
+{
+
+class LeaderboardClient : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, starts the sending thread; the connection is only
+     * opened when the first result is uploaded
+     *
+     * @throw std::system_error the thread cannot be started; the exception
+     * is never caught and the program stops
+     */
+    LeaderboardClient();
+
+    /**
+     * @brief destructor, stops the sending thread; the results that are not
+     * acknowledged yet are dropped (they are still saved into the local
+     * results store)
+     */
+    ~LeaderboardClient() noexcept;
+
+    /**
+     * @brief adds the given result into the outbound queue; the function
+     * returns immediately
+     *
+     * @param serieName the name of the serie, in the
+     * [personals|officials]/name format
+     * @param result the result to upload
+     *
+     * not noexcept because the queue insertion may throw std::bad_alloc
+     */
+    void upload(
+        const std::string& serieName,
+        const entities::SerieResult& result
+    ) const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
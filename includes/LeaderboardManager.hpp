@@ -0,0 +1,148 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LeaderboardManager.hpp
+ * @brief results store of the series; every serie has its own append-only
+ * results file, loaded into an index sorted by time; the results file is
+ * periodically compacted (rewritten sorted) so the index is quickly rebuilt
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_LEADERBOARDMANAGER_H_
+#define MEMORIS_LEADERBOARDMANAGER_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <string>
+
+namespace memoris
+{
+
+namespace entities
+{
+class SerieResult;
+}
+
+namespace utils
+{
+class AsyncFileWriter;
+}
+
+namespace managers
+{
+
+class LeaderboardManager : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, empty, only used to initialize the implementation
+     */
+    LeaderboardManager() noexcept;
+
+    /**
+     * @brief default destructor, empty, only used for forwarding declaration
+     */
+    ~LeaderboardManager() noexcept;
+
+    /**
+     * @brief loads the results of the given serie; the results file is read
+     * at once, once the writings of this file queued by addResult() are
+     * finished; nothing is done if the serie is already loaded; a partially
+     * written or corrupted end of file is ignored and removed during the next
+     * compaction
+     *
+     * @param serieName the name of the serie, in the
+     * [personals|officials]/name format
+     *
+     * not noexcept because the file reading may throw std::bad_alloc
+     */
+    void loadSerie(const std::string& serieName) &;
+
+    /**
+     * @brief adds one result to the loaded serie; the result is inserted
+     * into the sorted index and appended to the results file on the writing
+     * thread; the file is compacted instead if required
+     *
+     * @param writer the writer used to write the results file
+     * @param result the result to add, moved into the index
+     *
+     * @return const size_t the rank of the added result (starting at 1)
+     *
+     * not noexcept because the index insertion may throw std::bad_alloc
+     */
+    const size_t addResult(
+        const utils::AsyncFileWriter& writer,
+        entities::SerieResult result
+    ) &;
+
+    /**
+     * @brief returns the rank (starting at 1) a new result with the given
+     * time would have; the results with the same time are ranked before
+     *
+     * @param time the total playing time of the serie, in seconds
+     *
+     * @return const size_t
+     */
+    const size_t getRank(const unsigned short& time) const & noexcept;
+
+    /**
+     * @brief getter of the amount of results of the loaded serie
+     *
+     * @return const size_t
+     */
+    const size_t getResultsAmount() const & noexcept;
+
+    /**
+     * @brief returns the result at the given position in the ranking
+     *
+     * @param position the position of the result, starting at 0 (must be
+     * less than getResultsAmount())
+     *
+     * @return const entities::SerieResult&
+     */
+    const entities::SerieResult& getResult(const size_t& position) const &
+        noexcept;
+
+private:
+
+    static constexpr unsigned short COMPACTION_INTERVAL {64};
+
+    /**
+     * @brief rewrites the whole results file, sorted by time, on the writing
+     * thread; the results appended since the last compaction and the
+     * corrupted end of file (if any) are merged into the sorted content
+     *
+     * @param writer the writer used to write the results file
+     *
+     * not noexcept because the serialization may throw std::bad_alloc
+     */
+    void compact(const utils::AsyncFileWriter& writer) const &;
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
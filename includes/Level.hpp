@@ -18,7 +18,9 @@
 
 /**
  * @file Level.hpp
- * @brief level entity, contains all the cells
+ * @brief level entity, contains all the cells; only the floors that contain
+ * something else than walls are allocated, all the other floors are displayed
+ * with one shared floor of walls
  * @package entities
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
@@ -26,9 +28,8 @@
 #ifndef MEMORIS_LEVEL_H_
 #define MEMORIS_LEVEL_H_
 
-#include <memory>
-
 #include "aliases.hpp"
+#include "allocators.hpp"
 
 #include <SFML/Config.hpp>
 
@@ -45,6 +46,11 @@ namespace utils
 class Context;
 }
 
+namespace managers
+{
+struct LevelTemplate;
+}
+
 namespace entities
 {
 
@@ -56,25 +62,29 @@ public:
     static constexpr unsigned short MIN_FLOOR {0};
     static constexpr unsigned short MAX_FLOOR {9};
 
+    static constexpr unsigned short CELLS_PER_FLOOR {256};
+    static constexpr unsigned short CELLS_PER_LINE {16};
+    static constexpr unsigned short CELLS_PER_LEVEL {2560};
+
     /**
-     * @brief constructor that initializes a level full of wall cells
+     * @brief constructor that initializes a level full of wall cells; no
+     * floor is allocated, every floor is displayed with the walls floor
      *
      * @param context constant reference to the current context
      */
     Level(const utils::Context& context);
 
     /**
-     * @brief constructor that initializes a level from a specific file
+     * @brief constructor that initializes a level from a parsed level file;
+     * nothing is read or parsed, only the used floors cells are created
      *
      * @param context constant reference to the current context
-     * @param fileName constant reference to a string that contains the file
-     * name
-     *
-     * @throw std::invalid_argument the level file cannot be opened
+     * @param levelTemplate the parsed level file, shared with the other
+     * levels created from the same file and not modified
      */
     Level(
         const utils::Context& context,
-        const std::string& fileName
+        const managers::LevelTemplate& levelTemplate
     );
 
     /**
@@ -311,15 +321,18 @@ public:
     ) &;
 
     /**
-     * @brief getter of the cells container; returns a reference to the
-     * container; we return a constant reference to the container; in that
-     * case, the elements of the container cannot be modified (that means
-     * each pointer into the container cannot be replaced by another one)
-     * but the objects pointed by those pointers can be modified
+     * @brief getter of one cell of the level; if the cell belongs to a floor
+     * that is only made of walls and that is not allocated yet, the floor is
+     * allocated first (copy-on-write), so the returned cell can be modified
+     * without updating the other walls floors
+     *
+     * @param index the index of the cell into the level
+     *
+     * @return Cell&
      *
-     * @return const std::vector<std::unique_ptr<Cell>>&
+     * not noexcept because the floor allocation may throw std::bad_alloc
      */
-    const std::vector<std::unique_ptr<Cell>>& getCells() const & noexcept;
+    Cell& getCell(const unsigned short& index) const &;
 
     /**
      * @brief dynamically create a SFML transform object pointed by the
@@ -443,20 +456,32 @@ public:
     void setCellsFromCharactersList(const std::vector<char>& characters)
         const &;
 
-private:
-
-    static constexpr unsigned short CELLS_PER_FLOOR {256};
-    static constexpr unsigned short CELLS_PER_LINE {16};
-    static constexpr unsigned short CELLS_PER_LEVEL {2560};
+    /**
+     * @brief creates and returns the visibility of every cell of the level
+     *
+     * @return const std::vector<bool>
+     *
+     * the returned value is directly created into the method, so the function
+     * does not return a reference
+     */
+    const std::vector<bool> getVisibilitiesList() const & noexcept;
 
     /**
-     * @brief called by the constructor to update the cursor position during
-     * the level creation
+     * @brief shows or hides every cell of the level according to a given
+     * list of visibilities
+     *
+     * @param context constant reference to the current context to use
+     * @param visibilities one boolean per cell
      */
-    void updateCursors() const & noexcept;
+    void setCellsFromVisibilitiesList(
+        const utils::Context& context,
+        const std::vector<bool>& visibilities
+    ) const &;
+
+private:
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 184, 8> impl;
 };
 
 }
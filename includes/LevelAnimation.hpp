@@ -26,6 +26,8 @@
 #ifndef MEMORIS_LEVELANIMATION_H_
 #define MEMORIS_LEVELANIMATION_H_
 
+#include "transforms.hpp"
+
 #include <SFML/Config.hpp>
 
 #include <memory>
@@ -77,6 +79,19 @@ public:
         const unsigned short& floor
     ) & = 0;
 
+    /**
+     * @brief starts the animation from its first step; the animations are
+     * created once per level by the animations pool and started again every
+     * time the player finds a cell that triggers them
+     *
+     * @param context reference to the current context to use
+     *
+     * not 'const' because it resets the animation attributes
+     *
+     * not 'noexcept' because the animations may read the context clock
+     */
+    void start(const utils::Context& context) &;
+
     /**
      * @brief true if the animation is finished
      *
@@ -92,6 +107,16 @@ protected:
     static constexpr unsigned short CELLS_PER_LINE {16};
     static constexpr unsigned short CELLS_PER_FLOOR {256};
 
+    /**
+     * @brief resets the attributes of the child animation, called when the
+     * animation is started; the default definition does nothing
+     *
+     * @param context reference to the current context to use
+     *
+     * not 'noexcept' because the definitions may read the context clock
+     */
+    virtual void resetAnimation(const utils::Context& context) &;
+
     /**
      * @brief hides or shows the given cell at the given index, used during the
      * animation
@@ -136,6 +161,26 @@ protected:
         const Level& level
     ) const &;
 
+    /**
+     * @brief applies a whole floor transformation on the given floor; the
+     * types and the visibilities of the floor cells are packed, transformed
+     * by the floor transformations kernels and written back to the cells;
+     * the player is moved with the cells if he is on the transformed floor
+     *
+     * @param context reference to the current context to use
+     * @param level shared pointer to the concerned level object
+     * @param floor the floor to transform
+     * @param transform the transformation to apply
+     *
+     * not 'noexcept' because it calls SFML functions
+     */
+    void transformFloor(
+        const utils::Context& context,
+        const Level& level,
+        const unsigned short& floor,
+        const transforms::FloorTransform& transform
+    ) const &;
+
     /* these attributes are protected, so we do not set them into an
        implementation */
 
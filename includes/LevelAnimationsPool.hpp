@@ -0,0 +1,96 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LevelAnimationsPool.hpp
+ * @brief stores one object of every level animation, created with the game
+ * controller; the animations are started again every time a cell triggers
+ * them, so no animation is created during the game
+ * @package animations
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_LEVELANIMATIONSPOOL_H_
+#define MEMORIS_LEVELANIMATIONSPOOL_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+
+namespace memoris
+{
+
+namespace utils
+{
+class Context;
+}
+
+namespace animations
+{
+
+class LevelAnimation;
+
+class LevelAnimationsPool : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, creates all the animations of the pool
+     *
+     * not 'noexcept' because the implementation allocation may throw
+     * std::bad_alloc
+     */
+    LevelAnimationsPool();
+
+    /**
+     * @brief default destructor, empty, only declared here in order to use
+     * forwarding declaration
+     */
+    ~LevelAnimationsPool() noexcept;
+
+    /**
+     * @brief starts the animation of the given cell type and returns it;
+     * the returned animation belongs to the pool and is started again the
+     * next time the same cell type is found (see the cells traits)
+     *
+     * @param context reference to the current context to use
+     * @param cellType the type of the cell that starts the animation
+     *
+     * @return LevelAnimation* nullptr if the cell does not start any
+     * animation
+     *
+     * not 'const' because it resets the started animation
+     *
+     * not 'noexcept' because starting an animation may read the context clock
+     */
+    LevelAnimation* startAnimation(
+        const utils::Context& context,
+        const char& cellType
+    ) &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -28,7 +28,13 @@
 
 #include "Controller.hpp"
 
-#include "aliases.hpp"
+#include <vector>
+#include <string>
+
+namespace sf
+{
+class Color;
+}
 
 namespace memoris
 {
@@ -87,6 +93,9 @@ private:
     static constexpr const char* SAVE_LEVEL_NAME_MESSAGE {"Level name"};
     static constexpr const char* ERASE_LEVEL_MESSAGE
         {"Erase the current level ? y / n"};
+    static constexpr const char* SAVING_MESSAGE {"Saving..."};
+    static constexpr const char* SAVED_MESSAGE {"Saved"};
+    static constexpr const char* SAVE_FAILED_MESSAGE {"Cannot save the level"};
 
     static constexpr float CELLS_DEFAULT_TRANSPARENCY {255.f};
     static constexpr float TITLES_HORIZONTAL_POSITION {1200.f};
@@ -103,18 +112,44 @@ private:
 
     /**
      * @brief save the current level cells type into a level file, creates a
-     * new level file with the given name or overwrittes the existing one
+     * new level file with the given name or overwrittes the existing one; the
+     * content is copied and written by the asynchronous file writer, so the
+     * function returns immediately; the result is displayed when the writing
+     * is finished
      *
+     * @param context constant reference to the current context to use
      * @param name the name of the level to create
-     * @param cells constant reference to the container of cells pointers
+     * @param characters the types of all the cells of the level
      *
-     * @throw std::ios_base::failure thrown if the file manipulation failed;
-     * this exception is never caught by the program and the game directly
-     * stops
+     * not noexcept because the content copy may throw std::bad_alloc
      */
     void saveLevelFile(
+        const utils::Context& context,
         const std::string& name,
-        aliases::ConstUniquePtrCellsContainerRef cells
+        const std::vector<char>& characters
+    ) const &;
+
+    /**
+     * @brief displays the result of the last level file writing if it is
+     * finished; called every frame, never waits for the writing thread
+     *
+     * @param context constant reference to the current context to use
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void updateSaveStatus(const utils::Context& context) const &;
+
+    /**
+     * @brief updates the message of the save status surface
+     *
+     * @param message the message to display
+     * @param color the color of the message
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void setSaveStatus(
+        const std::string& message,
+        const sf::Color& color
     ) const &;
 
     /**
@@ -131,6 +166,22 @@ private:
         const std::string& levelName
     ) const &;
 
+    /**
+     * @brief the screen only changes on events, when the cursor of the save
+     * input flashes, or when the level file writing is finished; the screen
+     * is rendered at every frame during the writing to display the result
+     * as soon as possible
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const sf::Int32
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    const sf::Int32 getStaticDuration(
+        const utils::Context& context
+    ) const & override final;
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
@@ -0,0 +1,106 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LevelTemplatesManager.hpp
+ * @brief cache of the parsed level files; every level file is parsed once
+ * into an immutable template, the levels are then directly created from the
+ * template, so restarting a level reads and parses nothing; a template is
+ * parsed again if its file has been modified since its last parsing
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_LEVELTEMPLATESMANAGER_H_
+#define MEMORIS_LEVELTEMPLATESMANAGER_H_
+
+#include "NotCopiable.hpp"
+#include "Level.hpp"
+
+#include <memory>
+#include <string>
+#include <array>
+
+namespace memoris
+{
+namespace managers
+{
+
+/**
+ * the parsed content of one level file; never modified once created
+ */
+struct LevelTemplate
+{
+    /* one type per cell of the level */
+    std::string cells;
+
+    /* true for the floors that contain something else than walls; the
+       created levels allocate these floors and the walls floors the player
+       can reach from them */
+    std::array<bool, entities::Level::MAX_FLOOR + 1> usedFloors {};
+
+    unsigned short minutes {0};
+    unsigned short seconds {0};
+    unsigned short playerIndex {0};
+    unsigned short starsAmount {0};
+    unsigned short playableFloors {0};
+};
+
+class LevelTemplatesManager : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, empty, only used to initialize the implementation
+     */
+    LevelTemplatesManager() noexcept;
+
+    /**
+     * @brief default destructor, empty, only used for forwarding declaration
+     */
+    ~LevelTemplatesManager() noexcept;
+
+    /**
+     * @brief returns the template of the given level file; the file is only
+     * parsed if it is not cached yet or if its modification time or its size
+     * changed since the last parsing (the level may be saved by the editor)
+     *
+     * @param filePath the path of the level file
+     *
+     * @return std::shared_ptr<const LevelTemplate>
+     *
+     * the template is shared, so the returned template is still valid if it
+     * is replaced into the cache
+     *
+     * @throw std::invalid_argument the level file cannot be opened or parsed
+     */
+    std::shared_ptr<const LevelTemplate> getTemplate(
+        const std::string& filePath
+    ) const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
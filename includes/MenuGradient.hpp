@@ -75,25 +75,14 @@ public:
 
 private:
 
-    static constexpr unsigned short SURFACES_AMOUNT {1020};
-    static constexpr unsigned short SIDE_SURFACES_AMOUNT {510};
-
-    static constexpr float LEFT_SIDE_HORIZONTAL_POSITION {479.f};
-    static constexpr float RIGHT_SIDE_HORIZONTAL_POSITION {1099.f};
     static constexpr float BACKGROUND_WIDTH {620.f};
     static constexpr float BACKGROUND_HORIZONTAL_POSITION {480.f};
 
-    static constexpr sf::Uint8 DEFAULT_EFFECT_COLOR_ALPHA {255};
+    /* the alpha decreases of one unit every two pixels on both sides */
+    static constexpr float SIDE_WIDTH {510.f};
 
-    /**
-     * @brief private method called by the constructor only to create the
-     * background sides lines with the gradient effect
-     *
-     * @param context reference to the current context to use
-     *
-     * not 'noexcept' because it calls SFML methods that are not noexcept
-     */
-    void initializeGradientRectangles(const utils::Context& context) &;
+    static constexpr sf::Uint8 OPAQUE_ALPHA {255};
+    static constexpr sf::Uint8 TRANSPARENT_ALPHA {0};
 
     class Impl;
     std::unique_ptr<Impl> impl;
@@ -69,6 +69,20 @@ public:
 
 private:
 
+    /**
+     * @brief the screen only changes when a key is pressed or when the cursor
+     * of the game name input flashes
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const sf::Int32
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    const sf::Int32 getStaticDuration(
+        const utils::Context& context
+    ) const & override final;
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
@@ -0,0 +1,131 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file NumericText.hpp
+ * @brief fixed width text that only displays numbers; the quads of the ten
+ * digits glyphs are computed once when the text is created, so changing a
+ * number only updates the vertices of the digits that changed, without any
+ * string allocation and without any layout of the whole text
+ * @package widgets
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_NUMERICTEXT_H_
+#define MEMORIS_NUMERICTEXT_H_
+
+#include "NotCopiable.hpp"
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+
+#include <memory>
+#include <string>
+
+namespace sf
+{
+class Font;
+class Color;
+}
+
+namespace memoris
+{
+namespace widgets
+{
+
+class NumericText :
+    public sf::Drawable,
+    public sf::Transformable,
+    public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, creates the quads of the whole text
+     *
+     * @param font the font of the text
+     * @param characterSize the size of the characters
+     * @param color the color of the text
+     * @param layout the displayed characters; every ZERO_PADDED_DIGIT is a
+     * digit displayed with leading zeros, every BLANK_PADDED_DIGIT is a digit
+     * displayed without leading zero, the other characters never change; a
+     * field is a sequence of digits of the same kind, for example "00 : 00"
+     * contains two fields
+     *
+     * not noexcept because the vertices allocation may throw and some SFML
+     * functions are not noexcept
+     */
+    NumericText(
+        const sf::Font& font,
+        const unsigned int& characterSize,
+        const sf::Color& color,
+        const std::string& layout
+    );
+
+    /**
+     * @brief default destructor, empty, only declared in order to use the
+     * forwarding declaration
+     */
+    ~NumericText() noexcept;
+
+    /**
+     * @brief displays the given number into the given field; the digits that
+     * do not fit into the field are not displayed
+     *
+     * @param field the index of the field, from the left
+     * @param number the number to display
+     */
+    void setNumber(
+        const unsigned short& field,
+        const unsigned int& number
+    ) const & noexcept;
+
+    /**
+     * @brief returns the width of the text, it never changes
+     *
+     * @return const float
+     */
+    const float getWidth() const & noexcept;
+
+    static constexpr char ZERO_PADDED_DIGIT {'0'};
+    static constexpr char BLANK_PADDED_DIGIT {'#'};
+
+private:
+
+    /**
+     * @brief draws the quads of the text with the glyphs page of the font
+     *
+     * @param target the render target
+     * @param states the render states, combined with the text transform
+     *
+     * not noexcept because the SFML functions are not noexcept
+     */
+    void draw(
+        sf::RenderTarget& target,
+        sf::RenderStates states
+    ) const override;
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -79,6 +79,8 @@ private:
     static constexpr const char* MEDIUM {"medium"};
     static constexpr const char* DIFFICULT {"difficult"};
 
+    static constexpr float THUMBNAIL_VERTICAL_POSITION {710.f};
+
     /**
      * @brief defines what happens when a menu item is selected
      *
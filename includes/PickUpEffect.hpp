@@ -47,20 +47,14 @@ class PickUpEffect
 public:
 
     /**
-     * @brief constructor, initializes the implementation
-     *
-     * @param texture constant reference to the texture to display
-     * @param hPosition horizontal position of the animation
-     * @param vPosition vertical position of the animation
+     * @brief constructor, initializes the implementation; the effect is
+     * finished until it is started, so the effects can be created before the
+     * game starts and reused during the game without any allocation
      *
      * @throw std::bad_alloc the implementation unique pointer cannot be
      * created
      */
-    PickUpEffect(
-        const sf::Texture& texture,
-        const float& hPosition,
-        const float& vPosition
-    );
+    PickUpEffect();
 
     /**
      * @brief default destructor, empty, only declared in order to use
@@ -68,6 +62,22 @@ public:
      */
     ~PickUpEffect() noexcept;
 
+    /**
+     * @brief starts (or restarts) the effect with the given texture at the
+     * given position
+     *
+     * @param texture constant reference to the texture to display
+     * @param hPosition horizontal position of the animation
+     * @param vPosition vertical position of the animation
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    void start(
+        const sf::Texture& texture,
+        const float& hPosition,
+        const float& vPosition
+    ) &;
+
     /**
      * @brief renders the current pick up effect
      *
@@ -59,15 +59,15 @@ public:
     ~PickUpEffectsManager() noexcept;
 
     /**
-     * @brief creates an unique pointer to a PickUpEffect object and copy this
-     * pointer into the effects queue; set the textures and the position of
-     * the effect; this method is called by the game controller
+     * @brief starts the next effect of the effects pool; the effects are
+     * reused in turn, so the oldest effect is restarted if all the effects
+     * are still rendered; this method is called by the game controller
      *
      * @param texture constant reference to the texture to use in the effect
      * @param hPosition constant reference to the effect horizontal position
      * @param vPosition constant reference to the effect vertical position
      *
-     * not 'const' because it modifies the effects container
+     * not 'const' because it modifies the started effect
      *
      * not 'noexcept' because it calls SFML methods that are not noexcept
      */
@@ -78,8 +78,8 @@ public:
     ) &;
 
     /**
-     * @brief animates every pick up effect in the effects queue; delete an
-     * effect from the queue when this effect is terminated
+     * @brief animates every pick up effect of the effects pool that is not
+     * finished
      *
      * @param context constant reference to the current context to use
      *
@@ -91,6 +91,10 @@ public:
 
 private:
 
+    /* one effect lasts less than one second, so this is more than the amount
+       of items the player can find at the same time */
+    static constexpr unsigned short MAXIMUM_EFFECTS {8};
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
@@ -29,6 +29,7 @@
 #include "NotCopiable.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace sf
 {
@@ -38,9 +39,10 @@ class String;
 namespace memoris
 {
 
-namespace entities
+namespace snapshots
 {
-class SerieResult;
+struct SerieSnapshot;
+struct LevelSnapshot;
 }
 
 namespace managers
@@ -48,13 +50,9 @@ namespace managers
 
 class PlayingSerieManager : public utils::NotCopiable
 {
-    /* declared here because used in an alias */
-    static constexpr unsigned short RESULTS_PER_SERIE_FILE_AMOUNT {3};
 
 public:
 
-    using Results = std::array<entities::SerieResult, RESULTS_PER_SERIE_FILE_AMOUNT>;
-
     /**
      * @brief constructor, empty, only used to initialize the implementation
      */
@@ -174,11 +172,12 @@ public:
     const unsigned short& getPlayingTime() const & noexcept;
 
     /**
-     * @brief getter of the results list loaded from the serie file
+     * @brief getter of the playing time of every finished level of the serie
+     * (the split times), in seconds
      *
-     * @return const std::array<std::string, N>&
+     * @return const std::vector<unsigned short>&
      */
-    const Results& getResults() const & noexcept;
+    const std::vector<unsigned short>& getLevelsTimes() const & noexcept;
 
     /**
      * @brief setter that specifies if the serie is official or not; we use
@@ -220,13 +219,67 @@ public:
     /**
      * @brief add the given seconds amount to the total amount of seconds
      * for the serie play time; this function is called at the end of every
-     * level in order to make the total serie playing time
+     * level in order to make the total serie playing time; the level time is
+     * also saved as a split time of the serie
      *
      * @param levelPlayingTime constant reference to the level playing time;
      * the given number is the seconds amount
+     *
+     * not noexcept because the split times insertion may throw
      */
     void addSecondsToPlayingSerieTime(const unsigned short& levelPlayingTime)
-        const & noexcept;
+        const &;
+
+    /**
+     * @brief creates a snapshot of the current serie state; the level
+     * section of the snapshot is not filled (it is filled by the game
+     * controller that knows the level state)
+     *
+     * @param includeCurrentLevel true if the currently played level has to
+     * be played again when the serie is resumed, false if the current level
+     * is finished
+     *
+     * @return snapshots::SerieSnapshot
+     *
+     * not noexcept because the levels names copies may throw
+     */
+    snapshots::SerieSnapshot getSnapshot(const bool& includeCurrentLevel)
+        const &;
+
+    /**
+     * @brief restores the serie state from the given snapshot; the serie file
+     * is loaded again in order to get the serie results
+     *
+     * @param snapshot the snapshot to restore
+     *
+     * @throw std::invalid_argument if the serie file cannot be loaded, this
+     * exception should be caught in order to display the error controller
+     *
+     * no 'const' because it modifies the levels queue attribute
+     */
+    void restoreSnapshot(const snapshots::SerieSnapshot& snapshot) &;
+
+    /**
+     * @brief indicates if the next played level has to be resumed from the
+     * level section of the restored snapshot
+     *
+     * @return const bool&
+     */
+    const bool& hasResumedLevel() const & noexcept;
+
+    /**
+     * @brief getter of the level section of the restored snapshot, must only
+     * be called if hasResumedLevel() returns true
+     *
+     * @return const snapshots::LevelSnapshot&
+     */
+    const snapshots::LevelSnapshot& getResumedLevel() const & noexcept;
+
+    /**
+     * @brief called by the game controller factory once the resumed level
+     * has been restored; the next levels are played normally
+     */
+    void clearResumedLevel() const & noexcept;
 
 private:
 
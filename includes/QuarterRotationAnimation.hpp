@@ -27,6 +27,7 @@
 #define MEMORIS_QUARTERROTATIONANIMATION_H_
 
 #include "LevelAnimation.hpp"
+#include "allocators.hpp"
 
 namespace memoris
 {
@@ -69,6 +70,12 @@ private:
     static constexpr unsigned short ANIMATION_STEPS {40};
     static constexpr unsigned short HALF_CELLS_PER_LINE {8};
 
+    /**
+     * @brief resets the saved cells and the translation when the animation
+     * is started
+     */
+    void resetAnimation(const utils::Context&) & override;
+
     /**
      * @brief move all the quarters at the same time in the expected direction
      *
@@ -116,7 +123,7 @@ private:
 
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 132, 2> impl;
 };
 
 }
@@ -0,0 +1,169 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ResourcesRegistry.hpp
+ * @brief registry of the textures and sounds assets, described by the
+ * resources manifest; every asset is identified by a handle that never
+ * changes during the execution, it is only loaded the first time it is used
+ * and it can be unloaded again when the memory budget is exceeded; the
+ * evicted assets are the least recently used ones that are not referenced
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_RESOURCESREGISTRY_H_
+#define MEMORIS_RESOURCESREGISTRY_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <string>
+
+namespace sf
+{
+class Texture;
+}
+
+namespace memoris
+{
+
+namespace utils
+{
+class AssetPack;
+}
+
+namespace managers
+{
+
+class ResourcesRegistry : public utils::NotCopiable
+{
+
+public:
+
+    /* the index of the resource into the manifest */
+    using Handle = unsigned short;
+
+    /**
+     * @brief constructor, reads the manifest; no one resource is loaded
+     *
+     * @param manifestPath the path of the resources manifest; every line of
+     * the manifest is a 'texture|sound name path' declaration or the
+     * 'budget bytes' declaration; empty lines and lines starting with '#'
+     * are ignored
+     * @param pack the assets pack; the manifest and the resources are read
+     * from the pack if it contains them, from the separated files otherwise
+     *
+     * @throw std::invalid_argument the manifest cannot be opened or
+     * contains an invalid line; the exception is never caught and the program
+     * stops
+     */
+    ResourcesRegistry(
+        const std::string& manifestPath,
+        const utils::AssetPack& pack
+    );
+
+    /**
+     * @brief default destructor, empty, only used for forwarding declaration
+     */
+    ~ResourcesRegistry() noexcept;
+
+    /**
+     * @brief returns the handle of the given resource
+     *
+     * @param name the name of the resource into the manifest
+     *
+     * @return const Handle
+     *
+     * @throw std::invalid_argument the resource is not declared
+     */
+    const Handle getHandle(const std::string& name) const &;
+
+    /**
+     * @brief indicates if the given resource is declared into the manifest
+     *
+     * @param name the name of the resource
+     *
+     * @return const bool
+     */
+    const bool hasResource(const std::string& name) const & noexcept;
+
+    /**
+     * @brief returns the texture of the given handle, loads it if necessary;
+     * the address of the returned texture never changes, even if the texture
+     * is evicted and loaded again
+     *
+     * @param handle the handle of a texture resource
+     *
+     * @return const sf::Texture&
+     *
+     * @throw std::invalid_argument the handle is not a texture or the texture
+     * file cannot be loaded; the exception is never caught and the program
+     * stops
+     */
+    const sf::Texture& getTexture(const Handle& handle) const &;
+
+    /**
+     * @brief plays the sound of the given handle; the sound is never loaded
+     * here, nothing is played if it has not been loaded by acquire() (the
+     * sounds are played during the frames, the loading may throw and reads
+     * the file)
+     *
+     * @param handle the handle of a sound resource
+     */
+    void playSound(const Handle& handle) const & noexcept;
+
+    /**
+     * @brief adds one reference to the given resource and loads it; the
+     * referenced resources are never evicted
+     *
+     * @param handle the handle of the resource
+     *
+     * @throw std::invalid_argument the handle does not exist, the texture
+     * file cannot be loaded or the asset cannot be read from the pack
+     */
+    void acquire(const Handle& handle) const &;
+
+    /**
+     * @brief removes one reference from the given resource
+     *
+     * @param handle the handle of the resource
+     */
+    void release(const Handle& handle) const & noexcept;
+
+    /**
+     * @brief unloads the least recently used resources until the resident
+     * memory fits the budget; only the resources that are not referenced and
+     * that have not been used since the previous collection are evicted;
+     * called between two screens, once the previous controller (so all the
+     * sprites that use its textures) has been destroyed
+     *
+     * not noexcept because the candidates container allocation may throw
+     */
+    void collect() const &;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
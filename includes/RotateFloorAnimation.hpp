@@ -27,6 +27,7 @@
 #define MEMORIS_ROTATEFLOORANIMATION_H_
 
 #include "LevelAnimation.hpp"
+#include "allocators.hpp"
 
 #include <memory>
 
@@ -104,7 +105,7 @@ private:
     ) &;
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 2, 2> impl;
 };
 
 }
@@ -27,7 +27,8 @@
 #ifndef MEMORIS_SELECTIONLISTWIDGET_H_
 #define MEMORIS_SELECTIONLISTWIDGET_H_
 
-#include <memory>
+#include "allocators.hpp"
+
 #include <vector>
 
 namespace sf
@@ -95,6 +96,21 @@ public:
         const std::vector<std::string>& list
     ) const &;
 
+    /**
+     * @brief displays the thumbnail of every displayed item; the thumbnail
+     * of one item is the one of the file directory + item + extension; the
+     * thumbnails are only requested when their items are displayed
+     *
+     * @param directory the directory of the items files, with the final slash
+     * @param extension the extension of the items files (.level or .serie)
+     *
+     * not noexcept because the strings copies may throw std::bad_alloc
+     */
+    void setThumbnailsFiles(
+        const std::string& directory,
+        const std::string& extension
+    ) const &;
+
     /**
      * @brief getter of the current pointed item string
      *
@@ -151,6 +167,7 @@ private:
     static constexpr float WIDTH {600.f};
     static constexpr float HEIGHT {600.f};
     static constexpr float ITEMS_SEPARATION {50.f};
+    static constexpr float THUMBNAIL_MARGIN {10.f};
 
     static constexpr unsigned short ARROW_DIMENSION {64};
     static constexpr unsigned short VISIBLE_ITEMS {12};
@@ -197,7 +214,7 @@ private:
     void updateAllItemsPosition(const float& movement) const &;
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 3392, 8> impl;
 };
 
 }
@@ -67,15 +67,20 @@ public:
 
     /**
      * @brief save the current serie file according to the given serie name
-     * and the levels of the serie levels list
+     * and the levels of the serie levels list; the thumbnails are refreshed
+     * as the first level of the serie may have changed
      *
+     * @param context constant reference to the current context to use
      * @param name the name of the level to create
      *
      * @throw std::ios_base::failure thrown if the file manipulation failed;
      * this exception is never caught by the program and the game directly
      * stops
      */
-    void saveSerieFile(const std::string& name) const &;
+    void saveSerieFile(
+        const utils::Context& context,
+        const std::string& name
+    ) const &;
 
 private:
 
@@ -105,6 +110,21 @@ private:
     static constexpr const char* ERASE_SERIE_MESSAGE
         {"Erase the current serie ? y / n"};
 
+    /**
+     * @brief the screen only changes on events (the lists are updated by the
+     * mouse), when the cursor of the save input flashes, or when a pending
+     * thumbnail of the lists is generated
+     *
+     * @param context constant reference to the current context to use
+     *
+     * @return const sf::Int32
+     *
+     * not 'noexcept' because it calls SFML methods that are not noexcept
+     */
+    const sf::Int32 getStaticDuration(
+        const utils::Context& context
+    ) const & override final;
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
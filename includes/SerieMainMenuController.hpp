@@ -74,6 +74,8 @@ public:
 
 private:
 
+    static constexpr unsigned short RESUME_ITEM_INDEX {2};
+
     /**
      * @brief overwrite the parent method; defines which constroller is called
      * when one menu item is selected
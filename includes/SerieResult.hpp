@@ -27,6 +27,8 @@
 #define MEMORIS_SERIERESULT_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace memoris
 {
@@ -39,9 +41,36 @@ class SerieResult
 public:
 
     /**
-     * @brief default constructor, just initializes the implementation
+     * @brief constructor
+     *
+     * @param name the name of the game that made the result
+     * @param time the total playing time of the serie, in seconds
+     * @param levelsTimes the playing time of every level, in seconds
+     *
+     * not noexcept because the strings and vectors copies may throw
+     */
+    SerieResult(
+        const std::string& name,
+        const unsigned short& time,
+        const std::vector<unsigned short>& levelsTimes
+    );
+
+    /**
+     * @brief move constructor, the results are moved into the sorted index
+     * of the leaderboard manager
+     *
+     * @param other the result to move
+     */
+    SerieResult(SerieResult&& other) noexcept;
+
+    /**
+     * @brief move assignment operator
+     *
+     * @param other the result to move
+     *
+     * @return SerieResult&
      */
-    SerieResult() noexcept;
+    SerieResult& operator=(SerieResult&& other) noexcept;
 
     /**
      * @brief default destructor, empty, only declared in order to use
@@ -50,25 +79,38 @@ public:
     ~SerieResult() noexcept;
 
     /**
-     * @brief getter of the serie result string; does not return a constant
-     * reference; this reference is used to modify the value
+     * @brief getter of the name of the game that made the result
      *
-     * @return std::string&
+     * @return const std::string&
      */
-    std::string& getString() const & noexcept;
+    const std::string& getName() const & noexcept;
 
     /**
-     * @brief calculate the total time from the record string; this is a
-     * separated function as we never set the std::string record, but we
-     * use the std::getline() function instead that just takes a string
-     * reference as a parameter (during the reading serie file process)
+     * @brief getter of the total playing time of the serie, in seconds
+     *
+     * @return const unsigned short&
+     */
+    const unsigned short& getTime() const & noexcept;
+
+    /**
+     * @brief getter of the playing time of every level of the serie (the
+     * split times), in seconds
+     *
+     * @return const std::vector<unsigned short>&
+     */
+    const std::vector<unsigned short>& getLevelsTimes() const & noexcept;
+
+    /**
+     * @brief returns the displayed representation of the result, in the
+     * format "name mm:ss"
+     *
+     * @return const std::string
+     *
+     * the string is created into the method, so we return it by copy
      *
-     * @throws std::invalid_argument the format of serie record is incorrect
-     * and the time cannot be calculated; the function throws an exception,
-     * this exception is caught and an error message is displayed into the
-     * error controller
+     * not noexcept because the string creation may throw
      */
-    void calculateTime() const &;
+    const std::string getString() const &;
 
 private:
 
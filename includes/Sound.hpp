@@ -27,6 +27,7 @@
 #define MEMORIS_SOUND_H_
 
 #include <memory>
+#include <string>
 
 namespace sf
 {
@@ -50,13 +51,25 @@ public:
      * loaded; if the loading fails, both of the two pointed objects are
      * destroyed and the two pointers become null
      *
-     * @param path location of the sound file
+     * @param path path of the sound file
      *
      * 'noexcept' because we do not handle error if the file cannot be loaded;
      * each time the sound has to be played, it justs silently fails
      */
     Sound(const std::string& path) noexcept;
 
+    /**
+     * @brief load the sound from the given file content, same behavior as
+     * the loading from a file
+     *
+     * @param data the content of the sound file, only read by the constructor
+     * @param size the size of the content
+     */
+    Sound(
+        const void* data,
+        const size_t& size
+    ) noexcept;
+
     /**
      * @brief empty destructor declared here instead of the default one;
      * by generating the default one, the compiler needs the whole definition
@@ -72,8 +85,24 @@ public:
      */
     void play() const noexcept;
 
+    /**
+     * @brief returns the amount of memory used by the samples of the sound,
+     * 0 if the sound has not been loaded
+     *
+     * @return const size_t
+     */
+    const size_t getMemorySize() const noexcept;
+
 private:
 
+    /**
+     * @brief creates the SFML sound if the buffer has been loaded, destroys
+     * the buffer otherwise
+     *
+     * @param loaded true if the buffer has been loaded
+     */
+    void attachBuffer(const bool& loaded) noexcept;
+
     /* we use unique pointers to store the SFML sound and sound buffer; it's
        better to use dynamic allocation here because if the objects cannot
        be created successfully, we just do not use memory for them */
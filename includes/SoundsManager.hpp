@@ -35,19 +35,28 @@ namespace memoris
 namespace managers
 {
 
+class ResourcesRegistry;
+
 class SoundsManager : public utils::NotCopiable
 {
 
 public:
 
     /**
-     * @brief constructor, loads each sound file one by one, silently
-     * fails if the loading process fail
+     * @brief constructor, resolves the handles of the sounds, loads all of
+     * them and keeps them into the registry; silently fails if one file
+     * cannot be decoded
+     *
+     * @param registry the resources registry that loads the sounds
+     *
+     * @throw std::invalid_argument one sound is not declared into the
+     * resources manifest or cannot be read from the assets pack; the
+     * exception is never caught and the program stops
      */
-    SoundsManager() noexcept;
+    SoundsManager(const ResourcesRegistry& registry);
 
     /**
-     *
+     * @brief destructor, releases the sounds kept by the registry
      */
     ~SoundsManager() noexcept;
 
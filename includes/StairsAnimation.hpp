@@ -39,18 +39,12 @@ class StairsAnimation : public LevelAnimation
 public:
 
     /**
-     * @brief constructor, we define it because we have to save the time
-     * just before the animation starts; we use this saved value later to
-     * know when the waiting time of the animation is terminated
+     * @brief constructor, called by the animations pool
      *
-     * @param context reference to the current context to use
      * @param dir indicates in which direction is made the transition
      * (up/down), only equals to -1 or 1;
      */
-    StairsAnimation(
-        const utils::Context& context,
-        const short& dir
-    );
+    StairsAnimation(const short& dir) noexcept;
 
     /**
      * @brief render the animation
@@ -80,6 +74,15 @@ public:
 
 private:
 
+    /**
+     * @brief resets the transition and saves the time just before the
+     * animation starts; we use this saved value later to know when the
+     * waiting time of the animation is terminated
+     *
+     * @param context reference to the current context to use
+     */
+    void resetAnimation(const utils::Context& context) & override;
+
     /* during the animation, the transparency of the cells is modified
        progressively; the amount of transparency value update at each iteration
        is always the same and equal to 17.f, so we just refactor it in the
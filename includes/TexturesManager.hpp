@@ -18,7 +18,8 @@
 
 /**
  * @file TexturesManager.hpp
- * @brief loads and provides the textures assets
+ * @brief provides the textures assets; the textures are declared into the
+ * resources manifest and loaded by the resources registry on first use
  * @package managers
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
@@ -38,19 +39,24 @@ namespace memoris
 namespace managers
 {
 
+class ResourcesRegistry;
+
 class TexturesManager
 {
 
 public:
 
     /**
-     * @brief constructor, loads each texture one by one, stop if one texture
-     * cannot be loaded and throw an exception
+     * @brief constructor, resolves the handles of the textures; no one
+     * texture is loaded
+     *
+     * @param registry the resources registry that loads the textures
      *
-     * @throw std::invalid_argument thrown if the texture cannot be loaded,
-     * the exception is never caught to voluntary stop the program
+     * @throw std::invalid_argument one texture is not declared into the
+     * resources manifest, the exception is never caught to voluntary stop the
+     * program
      */
-    TexturesManager();
+    TexturesManager(const ResourcesRegistry& registry);
 
     /**
      * @brief default constructor, empty, only declared in order to use
@@ -58,137 +64,123 @@ public:
      */
     ~TexturesManager() noexcept;
 
+    /* the getters are not noexcept because the textures are loaded on first
+       use; std::invalid_argument is thrown if the file cannot be loaded */
+
     /**
      * @brief getter for the github texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getGithubTexture() const & noexcept;
+    const sf::Texture& getGithubTexture() const &;
 
     /**
      * @brief getter for the star texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getStarTexture() const & noexcept;
+    const sf::Texture& getStarTexture() const &;
 
     /**
      * @brief getter for the life texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getLifeTexture() const & noexcept;
+    const sf::Texture& getLifeTexture() const &;
 
     /**
      * @brief getter for the target texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getTargetTexture() const & noexcept;
+    const sf::Texture& getTargetTexture() const &;
 
     /**
      * @brief getter for the time texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getTimeTexture() const & noexcept;
+    const sf::Texture& getTimeTexture() const &;
 
     /**
      * @brief getter for the floor texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getFloorTexture() const & noexcept;
+    const sf::Texture& getFloorTexture() const &;
 
     /**
      * @brief getter for the new texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getNewTexture() const & noexcept;
+    const sf::Texture& getNewTexture() const &;
 
     /**
      * @brief getter for the open texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getOpenTexture() const & noexcept;
+    const sf::Texture& getOpenTexture() const &;
 
     /**
      * @brief getter for the save texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getSaveTexture() const & noexcept;
+    const sf::Texture& getSaveTexture() const &;
 
     /**
      * @brief getter for the cursor texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getCursorTexture() const & noexcept;
+    const sf::Texture& getCursorTexture() const &;
 
     /**
      * @brief getter for the exit texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getExitTexture() const & noexcept;
+    const sf::Texture& getExitTexture() const &;
 
     /**
      * @brief getter for the test texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getTestTexture() const & noexcept;
+    const sf::Texture& getTestTexture() const &;
 
     /**
      * @brief getter for the arrow up texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getArrowUpTexture() const & noexcept;
+    const sf::Texture& getArrowUpTexture() const &;
 
     /**
      * @brief getter for the arrow down texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getArrowDownTexture() const & noexcept;
+    const sf::Texture& getArrowDownTexture() const &;
 
     /**
      * @brief getter for the scroll arrow down texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getScrollArrowDownTexture() const & noexcept;
+    const sf::Texture& getScrollArrowDownTexture() const &;
 
     /**
      * @brief getter for the scroll arrow up texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getScrollArrowUpTexture() const & noexcept;
+    const sf::Texture& getScrollArrowUpTexture() const &;
 
 private:
 
-    /**
-     * @brief load a texture from the textures folder
-     *
-     * @param texture reference to the SFML texture object that has to be set
-     * @param path file path of the *.png picture to load
-     *
-     * @throw std::invalid_argument the given file cannot be opened; the
-     * exception is not caught in order to close the program directly if at
-     * least one texture cannot be loaded
-     *
-     * not 'const' because modifies the textures of the object
-     */
-    void loadTexture(
-        sf::Texture& texture,
-        const std::string& path
-    ) &;
-
     class Impl;
     std::unique_ptr<Impl> impl;
 };
@@ -0,0 +1,113 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ThumbnailsGenerator.hpp
+ * @brief generates the miniatures of the levels displayed into the lists;
+ * the miniatures are drawn from the cells types by worker threads, without
+ * any rendering on the graphic card, and saved into an images cache on the
+ * disk; a cached image is named with the hash of the level file content, so
+ * it is only generated again when the level is modified
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_THUMBNAILSGENERATOR_H_
+#define MEMORIS_THUMBNAILSGENERATOR_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <string>
+
+namespace sf
+{
+class Texture;
+}
+
+namespace memoris
+{
+namespace utils
+{
+
+class ThumbnailsGenerator : public NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, starts the worker threads
+     *
+     * @throw std::system_error one thread cannot be started; the exception
+     * is never caught and the program stops
+     */
+    ThumbnailsGenerator();
+
+    /**
+     * @brief destructor, stops the worker threads; the thumbnails that are
+     * being generated are finished first, the queued ones are dropped
+     */
+    ~ThumbnailsGenerator() noexcept;
+
+    /**
+     * @brief returns the thumbnail of the given level or serie file; the
+     * thumbnail of a serie is the one of its first level; the generation is
+     * requested the first time the thumbnail is asked, the function never
+     * waits for it and returns nullptr until it is finished
+     *
+     * @param filePath the path of the .level or .serie file
+     *
+     * @return const sf::Texture* the thumbnail, nullptr if the thumbnail is
+     * not ready yet or if it cannot be generated
+     *
+     * not noexcept because the request insertion may throw std::bad_alloc;
+     * not thread-safe, must be called by the rendering thread only as the
+     * textures are created on the graphic card
+     */
+    const sf::Texture* getThumbnail(const std::string& filePath) const &;
+
+    /**
+     * @brief true while at least one requested thumbnail has not been
+     * received by getThumbnail() yet; the static screens keep rendering
+     * during this time, so the finished thumbnails are displayed without
+     * waiting for an event
+     *
+     * @return const bool
+     *
+     * not thread-safe, must be called by the rendering thread only
+     */
+    const bool hasPendingThumbnails() const & noexcept;
+
+    /**
+     * @brief forgets all the loaded thumbnails; they are requested again
+     * when they are displayed, so the modified levels and series get new
+     * thumbnails (the thumbnails of the other ones are quickly loaded from
+     * the disk cache); called when a level or a serie is saved
+     */
+    void refresh() const & noexcept;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -27,12 +27,7 @@
 #ifndef MEMORIS_TIMERWIDGET_H_
 #define MEMORIS_TIMERWIDGET_H_
 
-#include <memory>
-
-namespace sf
-{
-class Text;
-}
+#include "allocators.hpp"
 
 namespace memoris
 {
@@ -45,6 +40,8 @@ class Context;
 namespace widgets
 {
 
+class NumericText;
+
 class TimerWidget
 {
 
@@ -106,15 +103,30 @@ public:
      */
     const bool& isFinished() const &;
 
+    /**
+     * @brief getter of the remaining minutes, used to save the timer into
+     * the in-progress serie snapshot
+     *
+     * @return const unsigned short&
+     */
+    const unsigned short& getMinutes() const & noexcept;
+
+    /**
+     * @brief getter of the remaining seconds
+     *
+     * @return const unsigned short&
+     */
+    const unsigned short& getSeconds() const & noexcept;
+
     /**
      * @brief the SFML surface that displays the text is the only displayed
      * attribute of the widget; so we provides a direct access to its
      * reference in order to save a reference in a controller (it avoids
      * to create a functions call tree)
      *
-     * @return const sf::Text&
+     * @return const NumericText&
      */
-    const sf::Text& getTextSurface() const & noexcept;
+    const NumericText& getTextSurface() const & noexcept;
 
 private:
 
@@ -122,15 +134,13 @@ private:
     static constexpr unsigned short FIRST_SECOND_IN_MINUTE {59};
 
     /**
-     * @brief update the displayed timer string; add a 0 to second or minute
-     * value if it contains only one digit to make a better graphical effect
-     *
-     * not noexcept because some SFML methods are not noexcept
+     * @brief update the displayed timer digits; the minutes and the seconds
+     * are always displayed with two digits
      */
-    void updateDisplayedString() const &;
+    void updateDisplayedString() const & noexcept;
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 264, 8> impl;
 };
 
 }
@@ -27,7 +27,7 @@
 #ifndef MEMORIS_WATCHINGTIMER_H_
 #define MEMORIS_WATCHINGTIMER_H_
 
-#include <memory>
+#include "allocators.hpp"
 
 namespace memoris
 {
@@ -69,10 +69,8 @@ public:
      * the displayed amount during the watching period
      *
      * not 'const' because it modifies the current object SFML surfaces
-     *
-     * not 'noexcept' because it calls SFML functions that are not noexcept
      */
-    void updateDisplayedAmount(const unsigned short& amount) &;
+    void updateDisplayedAmount(const unsigned short& amount) & noexcept;
 
     /**
      * @brief displays the timer at both sides of the level
@@ -90,7 +88,7 @@ private:
     static constexpr float TIMERS_VERTICAL_POSITION {300.f};
 
     class Impl;
-    std::unique_ptr<Impl> impl;
+    allocators::FastPimpl<Impl, 504, 8> impl;
 };
 
 }
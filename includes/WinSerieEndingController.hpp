@@ -67,6 +67,8 @@ private:
     static constexpr float RESULTS_FIRST_ITEM_VERTICAL_POSITION {300.f};
     static constexpr float RESULTS_INTERVAL {50.f};
 
+    static constexpr unsigned short RESULTS_DISPLAYED_AMOUNT {10};
+
     static constexpr unsigned short SECONDS_IN_ONE_MINUTE {60};
 
     static constexpr sf::Int32 SWITCH_ANIMATION_INTERVAL {30};
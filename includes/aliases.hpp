@@ -53,9 +53,6 @@ namespace aliases
 
 using ConstTransformUniquePtrRef = const std::unique_ptr<sf::Transform>&;
 
-using ConstUniquePtrCellsContainerRef =
-    const std::vector<std::unique_ptr<entities::Cell>>&;
-
 using UniquePtrTutorialFramesContainerRef =
     std::queue<std::unique_ptr<widgets::TutorialFrame>>&;
 }
@@ -0,0 +1,119 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file allocations.hpp
+ * @brief allocations tracking of the instrumentation build (compiled with
+ * MEMORIS_TRACK_ALLOCATIONS); the global allocation operators are replaced
+ * and every allocation of the main thread is attributed to the rendered
+ * controller and to the current frame phase; the frames that allocate are
+ * reported on the error output, with a summary when the controller changes;
+ * without MEMORIS_TRACK_ALLOCATIONS, all the functions are empty
+ * @package allocations
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_ALLOCATIONS_H_
+#define MEMORIS_ALLOCATIONS_H_
+
+#include <cstddef>
+
+namespace memoris
+{
+namespace allocations
+{
+
+/**
+ * the phases of one frame of the main loop
+ */
+enum class FramePhase
+{
+    CLEAR,
+    RENDER,
+    DISPLAY,
+    PHASES_AMOUNT /** < used to size the counters, not a phase */
+};
+
+#ifdef MEMORIS_TRACK_ALLOCATIONS
+
+/**
+ * @brief starts tracking the allocations of one frame of the current thread,
+ * the first phase is the clear phase
+ *
+ * @param controllerId the id of the rendered controller
+ */
+void startFrame(const unsigned short& controllerId) noexcept;
+
+/**
+ * @brief the next allocations of the frame are attributed to the given phase
+ *
+ * @param phase the new phase
+ */
+void setPhase(const FramePhase& phase) noexcept;
+
+/**
+ * @brief stops tracking the frame allocations; the frame is reported if it
+ * allocated anything
+ */
+void endFrame() noexcept;
+
+/**
+ * @brief reports the allocations of all the frames of the controller; the
+ * first frame is reported separately, as the controllers initialize some
+ * resources when they are rendered for the first time
+ */
+void endController() noexcept;
+
+/**
+ * @brief getter of the amount of allocations of the last ended frame of the
+ * current thread; used by the allocations test to fail on the first
+ * allocating frame
+ *
+ * @return const size_t
+ */
+const size_t getFrameAllocations() noexcept;
+
+#else
+
+inline void startFrame(const unsigned short&) noexcept
+{
+}
+
+inline void setPhase(const FramePhase&) noexcept
+{
+}
+
+inline void endFrame() noexcept
+{
+}
+
+inline void endController() noexcept
+{
+}
+
+inline const size_t getFrameAllocations() noexcept
+{
+    return 0;
+}
+
+#endif
+
+}
+}
+
+#endif
@@ -18,7 +18,8 @@
 
 /**
  * @file allocators.hpp
- * @brief dynamic allocation routines
+ * @brief dynamic allocation routines, inline implementation storage and
+ * monotonic arenas
  * @package allocators
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
@@ -26,7 +27,14 @@
 #ifndef MEMORIS_ALLOCATORS_H_
 #define MEMORIS_ALLOCATORS_H_
 
+#include "NotCopiable.hpp"
+
 #include <memory>
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
 
 namespace memoris
 {
@@ -52,6 +60,379 @@ void createDynamicObject(std::unique_ptr<T>& pointer);
 template<typename T>
 void deleteDynamicObject(std::unique_ptr<T>& pointer);
 
+/**
+ * @brief compilation check of one FastPimpl storage; the implementation
+ * size and alignment are template parameters, so the compiler error message
+ * contains the values to use when the check fails
+ */
+template<
+    std::size_t StorageSize,
+    std::size_t StorageAlignment,
+    std::size_t ImplementationSize,
+    std::size_t ImplementationAlignment
+>
+struct FastPimplCheck
+{
+    static_assert(
+        StorageSize >= ImplementationSize,
+        "The FastPimpl storage is too small for the implementation"
+    );
+
+    static_assert(
+        StorageAlignment % ImplementationAlignment == 0,
+        "The FastPimpl storage alignment does not fit the implementation"
+    );
+
+    static constexpr bool valid {true};
+};
+
+/**
+ * @brief true if the given constructor arguments are one FastPimpl object,
+ * so the copy and the move constructors are used instead of the forwarding
+ * constructor
+ */
+template<typename Pimpl, typename... Args>
+struct IsFastPimplArgument : std::false_type
+{
+};
+
+template<typename Pimpl, typename Arg>
+struct IsFastPimplArgument<Pimpl, Arg> :
+    std::is_same<typename std::decay<Arg>::type, Pimpl>
+{
+};
+
+/**
+ * @brief stores the implementation of a class (pimpl idiom) directly into
+ * the object instead of allocating it; the implementation type is still
+ * only declared into the header of the class, only its maximum size and
+ * its alignment are written into the header; constructing the object and
+ * accessing its implementation never use the allocator
+ *
+ * the size and the alignment are checked when the implementation is
+ * destroyed, so into the source file of the class, where the implementation
+ * is defined; every source file also asserts that its implementation fits
+ * SIZE and documents the measured size; the storages of the implementations
+ * that contain SFML or standard library objects keep at least a quarter of
+ * headroom over the size measured with SFML 2.5 and libstdc++ on 64 bits, as
+ * these objects have other sizes with the other versions
+ *
+ * like std::unique_ptr, the constness is not propagated to the
+ * implementation, so the const methods keep the same behavior as with the
+ * unique pointers implementations
+ */
+template<typename T, std::size_t Size, std::size_t Alignment>
+class FastPimpl
+{
+
+public:
+
+    /* the storage size and alignment, used by the source files checks */
+    static constexpr std::size_t SIZE {Size};
+    static constexpr std::size_t ALIGNMENT {Alignment};
+
+    /**
+     * @brief constructor, constructs the implementation into the storage;
+     * not used for one FastPimpl argument, even if it is not const
+     *
+     * @param arguments the implementation constructor arguments
+     */
+    template<
+        typename... Args,
+        typename = typename std::enable_if<
+            !IsFastPimplArgument<FastPimpl, Args...>::value
+        >::type
+    >
+    explicit FastPimpl(Args&&... arguments)
+    {
+        new (&storage) T(std::forward<Args>(arguments)...);
+    }
+
+    /**
+     * @brief copy constructor, copies the implementation
+     *
+     * @param other the implementation to copy
+     */
+    FastPimpl(const FastPimpl& other)
+    {
+        new (&storage) T(*other);
+    }
+
+    /**
+     * @brief move constructor, moves the implementation; the other
+     * implementation is still constructed and destroyed with its object
+     *
+     * @param other the implementation to move
+     */
+    FastPimpl(FastPimpl&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value
+    )
+    {
+        new (&storage) T(std::move(*other));
+    }
+
+    /**
+     * @brief copy assignment, copies the implementation
+     *
+     * @param other the implementation to copy
+     *
+     * @return FastPimpl&
+     */
+    FastPimpl& operator=(const FastPimpl& other)
+    {
+        **this = *other;
+
+        return *this;
+    }
+
+    /**
+     * @brief move assignment, moves the implementation
+     *
+     * @param other the implementation to move
+     *
+     * @return FastPimpl&
+     */
+    FastPimpl& operator=(FastPimpl&& other) noexcept(
+        std::is_nothrow_move_assignable<T>::value
+    )
+    {
+        **this = std::move(*other);
+
+        return *this;
+    }
+
+    /**
+     * @brief destructor, destroys the implementation
+     */
+    ~FastPimpl() noexcept
+    {
+        static_assert(
+            FastPimplCheck<Size, Alignment, sizeof(T), alignof(T)>::valid,
+            "Invalid FastPimpl storage"
+        );
+
+        get()->~T();
+    }
+
+    /**
+     * @brief access to the implementation
+     *
+     * @return T*
+     */
+    T* operator->() const noexcept
+    {
+        return get();
+    }
+
+    /**
+     * @brief access to the implementation
+     *
+     * @return T&
+     */
+    T& operator*() const noexcept
+    {
+        return *get();
+    }
+
+private:
+
+    /**
+     * @brief returns the implementation constructed into the storage
+     *
+     * @return T*
+     */
+    T* get() const noexcept
+    {
+        return reinterpret_cast<T*>(&storage);
+    }
+
+    /* mutable as the constness is not propagated */
+    mutable typename std::aligned_storage<Size, Alignment>::type storage;
+};
+
+/**
+ * @brief deleter of the objects created into an arena; only calls the
+ * destructor of the object, the memory is released with the whole arena
+ */
+struct ArenaDeleter
+{
+    template<typename T>
+    void operator()(T* object) const noexcept
+    {
+        object->~T();
+    }
+};
+
+template<typename T>
+using ArenaPtr = std::unique_ptr<T, ArenaDeleter>;
+
+/**
+ * @brief monotonic arena; the memory is taken from big blocks, one after
+ * the other, and is never released one allocation at a time: all the blocks
+ * are released together when the arena is destroyed; used for the objects
+ * that all die together (the objects of one controller), so their
+ * destruction is one release of a few blocks and the heap is not fragmented
+ * by many small allocations
+ */
+class MonotonicArena : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, empty; the first block is only allocated when the
+     * arena is used for the first time
+     */
+    MonotonicArena() noexcept;
+
+    /**
+     * @brief destructor, releases all the blocks; the objects created into
+     * the arena must have been destroyed before
+     */
+    ~MonotonicArena() noexcept;
+
+    /**
+     * @brief returns the given amount of memory with the given alignment
+     *
+     * @param bytes the amount of bytes
+     * @param alignment the alignment, must be a power of two lower or equal
+     * to the alignment of std::max_align_t
+     *
+     * @return void*
+     *
+     * @throw std::bad_alloc a new block cannot be allocated
+     */
+    void* allocate(
+        const std::size_t& bytes,
+        const std::size_t& alignment
+    ) &;
+
+    /**
+     * @brief creates one object into the arena
+     *
+     * @param arguments the object constructor arguments
+     *
+     * @return ArenaPtr<T>
+     *
+     * @throw std::bad_alloc a new block cannot be allocated
+     */
+    template<typename T, typename... Args>
+    ArenaPtr<T> create(Args&&... arguments) &
+    {
+        void* memory = allocate(
+            sizeof(T),
+            alignof(T)
+        );
+
+        return ArenaPtr<T>(new (memory) T(std::forward<Args>(arguments)...));
+    }
+
+private:
+
+    class Impl;
+    FastPimpl<Impl, 48, 8> impl;
+};
+
+/**
+ * @brief standard allocator that takes its memory from one arena, so the
+ * standard containers can be stored into the arena; the deallocation does
+ * nothing, the memory is released with the arena; the containers should
+ * reserve their size before being filled, the memory of the replaced
+ * buffers is only released with the arena
+ */
+template<typename T>
+class ArenaAllocator
+{
+
+public:
+
+    using value_type = T;
+
+    /**
+     * @brief constructor
+     *
+     * @param memoryArena the arena to use, must live longer than the
+     * containers using the allocator
+     */
+    ArenaAllocator(MonotonicArena& memoryArena) noexcept :
+        arena(&memoryArena)
+    {
+    }
+
+    /**
+     * @brief conversion constructor, required by the containers to allocate
+     * their internal types
+     *
+     * @param other the allocator to convert
+     */
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+        arena(other.getArena())
+    {
+    }
+
+    /**
+     * @brief allocates the given amount of objects
+     *
+     * @param amount the amount of objects
+     *
+     * @return T*
+     *
+     * @throw std::bad_alloc a new block cannot be allocated
+     */
+    T* allocate(const std::size_t amount)
+    {
+        return static_cast<T*>(
+            arena->allocate(
+                amount * sizeof(T),
+                alignof(T)
+            )
+        );
+    }
+
+    /**
+     * @brief does nothing, the memory is released with the arena
+     */
+    void deallocate(T*, const std::size_t) noexcept
+    {
+    }
+
+    /**
+     * @brief getter of the arena
+     *
+     * @return MonotonicArena*
+     */
+    MonotonicArena* getArena() const noexcept
+    {
+        return arena;
+    }
+
+private:
+
+    MonotonicArena* arena;
+};
+
+template<typename T, typename U>
+bool operator==(
+    const ArenaAllocator<T>& first,
+    const ArenaAllocator<U>& second
+) noexcept
+{
+    return first.getArena() == second.getArena();
+}
+
+template<typename T, typename U>
+bool operator!=(
+    const ArenaAllocator<T>& first,
+    const ArenaAllocator<U>& second
+) noexcept
+{
+    return !(first == second);
+}
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
 }
 }
 
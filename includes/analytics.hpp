@@ -0,0 +1,105 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file analytics.hpp
+ * @brief offline analysis of recorded play sessions; every session is
+ * replayed with the simulation rules and aggregated into per level heatmaps
+ * (visited cells, walls collisions, lost lifes, time overs) and summaries,
+ * used by the levels designers to tune the difficulty; the sessions files
+ * are text files with one session per line:
+ *
+ *     level_file_path time:move time:move ... [time:E]
+ *
+ * the times are the level times in milliseconds (see
+ * simulation::LevelPlayer::move()), the moves are U, D, L or R, the optional
+ * E move is the end of the recording (the player left the level or the
+ * timer ended); the empty lines and the lines starting with # are ignored
+ * @package analytics
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_ANALYTICS_H_
+#define MEMORIS_ANALYTICS_H_
+
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+namespace analytics
+{
+
+/**
+ * the aggregated sessions of one level
+ */
+struct LevelHeatmap
+{
+    /* the path of the level file */
+    std::string filePath;
+
+    /* one counter per cell of the level: the moves that ended on the cell
+       (the departure is counted once per session), the moves stopped by the
+       cell wall, the lifes lost on the cell and the timers that ended while
+       the player was on the cell */
+    std::vector<unsigned int> visits;
+    std::vector<unsigned int> wallCollisions;
+    std::vector<unsigned int> lostLifes;
+    std::vector<unsigned int> timeOvers;
+
+    unsigned int sessions {0};
+    unsigned int wins {0};
+    unsigned int timeOverSessions {0};
+    unsigned int noLifeSessions {0};
+    unsigned int unfinishedSessions {0};
+
+    /* the level time of the first found star of every session that found
+       one, in milliseconds, not ordered */
+    std::vector<unsigned int> firstStarTimes;
+};
+
+/**
+ * the result of the analysis of all the sessions files
+ */
+struct SessionsReport
+{
+    /* ordered by level file path */
+    std::vector<LevelHeatmap> levels;
+
+    /* the lines that cannot be parsed or whose level cannot be loaded */
+    unsigned int rejectedSessions {0};
+};
+
+/**
+ * @brief reads and replays all the sessions of the given files; the files
+ * are split into chunks that are read as streams by worker threads, one per
+ * available core; every worker aggregates its own heatmaps, that are merged
+ * at the end
+ *
+ * @param filePaths the paths of the sessions files
+ *
+ * @return SessionsReport
+ *
+ * @throw std::invalid_argument one sessions file cannot be opened
+ */
+SessionsReport analyzeSessions(const std::vector<std::string>& filePaths);
+
+}
+}
+
+#endif
@@ -30,7 +30,7 @@
 #ifndef MEMORIS_CELLS_H_
 #define MEMORIS_CELLS_H_
 
-#include "Cell.hpp"
+#include "transforms.hpp"
 
 namespace memoris
 {
@@ -63,27 +63,99 @@ constexpr char ELEVATOR_DOWN_CELL {'V'};
 constexpr char QUARTER_ROTATION_CELL {'q'};
 constexpr char INVERTED_QUARTER_ROTATION_CELL {'Q'};
 
+/* every cell type has one dense identifier, from 0 to the amount of types;
+   the last identifier is used by all the unknown characters */
+constexpr unsigned char CELL_TYPES_AMOUNT {22};
+constexpr unsigned char UNKNOWN_CELL_ID {CELL_TYPES_AMOUNT - 1};
+
+/**
+ * the effect of a cell when the player enters it
+ */
+enum class CellAction : unsigned char
+{
+    NONE,
+    FIND_STAR,
+    MORE_LIFE,
+    LESS_LIFE,
+    MORE_TIME,
+    LESS_TIME,
+    FLOOR_UP,
+    FLOOR_DOWN,
+    TRANSFORM_FLOOR,
+    ARRIVE
+};
+
+/**
+ * the level animation started when the player enters a cell
+ */
+enum class CellAnimation : unsigned char
+{
+    NONE,
+    STAIRS_UP,
+    STAIRS_DOWN,
+    HORIZONTAL_MIRROR,
+    VERTICAL_MIRROR,
+    DIAGONAL,
+    LEFT_ROTATION,
+    RIGHT_ROTATION,
+    QUARTER_ROTATION,
+    ANIMATIONS_AMOUNT
+};
+
+/**
+ * the semantics of one cell type; a new cell type is added by adding its
+ * character above and its traits into the traits table (cells.cpp)
+ */
+struct CellTraits
+{
+    /* the character of the cell into the levels files */
+    char type;
+
+    CellAction action;
+    CellAnimation animation;
+
+    /* the floor transformation applied by the cell, only used by the
+       TRANSFORM_FLOOR action */
+    transforms::FloorTransform transform;
+
+    /* the cell becomes an empty cell when the player leaves it */
+    bool emptiedOnLeave;
+
+    /* the player cannot enter the cell */
+    bool blocking;
+
+    /* the cell can be put into a level by the editor */
+    bool placeable;
+};
+
+/**
+ * @brief returns the dense identifier of the given cell character; the
+ * identifier is also the texture slot of the cell type
+ *
+ * @param type the character of the cell
+ *
+ * @return const unsigned char& UNKNOWN_CELL_ID for the unknown characters
+ */
+const unsigned char& getCellId(const char& type) noexcept;
+
+/**
+ * @brief returns the traits of the given cell character
+ *
+ * @param type the character of the cell
+ *
+ * @return const CellTraits& the traits of the unknown cell type for the
+ * unknown characters
+ */
+const CellTraits& getCellTraits(const char& type) noexcept;
+
 /**
- * @brief create Cell unique pointers, usuable at a given position inside
- * the level; the given positions are the positions of the cell *inside* the
- * level (the level position is the origin of the cells positions); we use
- * a template for the positions types (whatever the type, the position is
- * cast to float)
+ * @brief returns the traits of the given cell identifier
  *
- * @param context reference to the current context to use
- * @param horizontalPosition the horizontal position of the cell
- * @param verticalPosiition the vertical position of the cell
- * @param type the cell type
+ * @param id the identifier of the cell type, lower than CELL_TYPES_AMOUNT
  *
- * @return std::unique_ptr<entities::Cell>
+ * @return const CellTraits&
  */
-template<typename T>
-std::unique_ptr<entities::Cell> getCellByType(
-    const utils::Context& context,
-    const T& horizontalPosition,
-    const T& verticalPosition,
-    const char type
-);
+const CellTraits& getCellTraitsById(const unsigned char& id) noexcept;
 
 }
 }
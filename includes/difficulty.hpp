@@ -0,0 +1,153 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file difficulty.hpp
+ * @brief levels difficulty estimation; every level is scored from metrics
+ * computed on its grid (cells to memorize, shortest path, floors
+ * transformations, stairs, floors and time budget), so the levels of a serie
+ * can be checked or ordered by increasing difficulty
+ * @package difficulty
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_DIFFICULTY_H_
+#define MEMORIS_DIFFICULTY_H_
+
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+
+namespace managers
+{
+struct LevelTemplate;
+}
+
+namespace difficulty
+{
+
+/**
+ * the metrics and the score of one level
+ */
+struct LevelDifficulty
+{
+    /* the path of the level file */
+    std::string filePath;
+
+    /* the amount of non-wall cells of the level, so the amount of cells the
+       player has to memorize */
+    unsigned short cellsToMemorize {0};
+
+    /* the amount of movements of the shortest path that starts from the
+       departure, finds all the stars and ends on the arrival; the floors
+       transformations are not simulated, so this is an estimation */
+    unsigned short optimalPathLength {0};
+
+    /* false if no path can find all the stars and reach the arrival */
+    bool solvable {false};
+
+    /* the amount of floors transformations cells (mirrors, rotations...) and
+       the amount of different transformations types */
+    unsigned short transformations {0};
+    unsigned short transformationsTypes {0};
+
+    /* the amount of stairs and elevators cells */
+    unsigned short stairs {0};
+
+    unsigned short usedFloors {0};
+
+    /* the level time minus the time required by the optimal path, in
+       seconds; negative if the time budget is shorter than the path */
+    float timeSlack {0.f};
+
+    /* the higher the score, the more difficult the level */
+    float score {0.f};
+};
+
+/**
+ * @brief computes the metrics and the score of the given level
+ *
+ * @param levelTemplate the parsed level
+ *
+ * @return const LevelDifficulty the file path of the result is empty
+ *
+ * not noexcept because the path computation containers may throw
+ * std::bad_alloc
+ */
+const LevelDifficulty estimateLevel(
+    const managers::LevelTemplate& levelTemplate
+);
+
+/**
+ * @brief parses and estimates the given level files; the levels are
+ * estimated in parallel, one worker thread per available core
+ *
+ * @param filePaths the paths of the level files
+ *
+ * @return std::vector<LevelDifficulty> the results, in the same order as
+ * the given files
+ *
+ * @throw std::invalid_argument one level file cannot be opened or parsed
+ */
+std::vector<LevelDifficulty> estimateLevels(
+    const std::vector<std::string>& filePaths
+);
+
+/**
+ * @brief returns the paths of the levels of the given serie file, in the
+ * serie order; the file is read as PlayingSerieManager::loadSerieFileContent
+ * does, the levels are located into the levels directory of the same type
+ * (officials or personals) as the serie
+ *
+ * @param seriePath the path of the serie file, in the
+ * data/series/[personals|officials]/name.serie format
+ *
+ * @return std::vector<std::string>
+ *
+ * @throw std::invalid_argument the serie file cannot be opened
+ */
+std::vector<std::string> getSerieLevelsPaths(const std::string& seriePath);
+
+/**
+ * @brief checks if the given levels are ordered by increasing difficulty
+ *
+ * @param levels the estimated levels, in the serie order
+ *
+ * @return const bool false if one level is less difficult than the previous
+ * one or if one level cannot be solved
+ */
+const bool isOrderedByDifficulty(
+    const std::vector<LevelDifficulty>& levels
+) noexcept;
+
+/**
+ * @brief orders the given levels by increasing difficulty; the levels with
+ * the same score keep their order
+ *
+ * @param levels the estimated levels
+ *
+ * not noexcept because the stable sort may throw std::bad_alloc
+ */
+void sortByDifficulty(std::vector<LevelDifficulty>& levels);
+
+}
+}
+
+#endif
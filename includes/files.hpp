@@ -27,6 +27,7 @@
 #define MEMORIS_FILES_H_
 
 #include <fstream>
+#include <cstdint>
 
 namespace memoris
 {
@@ -42,6 +43,20 @@ namespace utils
  */
 void applyFailbitAndBadbitExceptions(std::ofstream& file);
 
+/**
+ * @brief 32 bits FNV-1a hash of the given bytes; used by the binary files
+ * (snapshots, results) to detect a corrupted or partially written content
+ *
+ * @param bytes pointer to the first byte to hash
+ * @param length the amount of bytes to hash
+ *
+ * @return const uint32_t
+ */
+const uint32_t getChecksum(
+    const char* bytes,
+    const size_t& length
+) noexcept;
+
 }
 }
 
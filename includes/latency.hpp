@@ -0,0 +1,187 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file latency.hpp
+ * @brief input latency tracking of the instrumentation build (compiled with
+ * MEMORIS_TRACK_LATENCY); every movement key press is timestamped when it is
+ * queued, followed until it moves the player, and until the first frame that
+ * contains the movement is displayed; the latencies are reported as
+ * histograms on the error output when the program stops; the probe mode
+ * injects key presses at a fixed rate, so the latency can be measured without
+ * any player; without MEMORIS_TRACK_LATENCY, all the functions are empty
+ * @package latency
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_LATENCY_H_
+#define MEMORIS_LATENCY_H_
+
+namespace sf
+{
+class Event;
+}
+
+namespace memoris
+{
+namespace latency
+{
+
+#ifdef MEMORIS_TRACK_LATENCY
+
+/**
+ * @brief one movement key press has been added into the input actions queue
+ */
+void inputQueued() noexcept;
+
+/**
+ * @brief the oldest queued key press expired and has been dropped
+ */
+void inputDropped() noexcept;
+
+/**
+ * @brief the oldest queued key press is executed; it may move the player or
+ * not (collision)
+ */
+void inputDequeued() noexcept;
+
+/**
+ * @brief all the queued key presses have been dropped
+ */
+void inputsCleared() noexcept;
+
+/**
+ * @brief the executed key press moved the player
+ */
+void stateChanged() noexcept;
+
+/**
+ * @brief the main thread starts to draw one frame; the player movements
+ * done before this call are visible into this frame
+ */
+void frameStarted() noexcept;
+
+/**
+ * @brief the drawn frame has been published for the display
+ */
+void framePublished() noexcept;
+
+/**
+ * @brief the last published frame is drawn into the window; called by the
+ * thread that displays the frames
+ */
+void framePresenting() noexcept;
+
+/**
+ * @brief the window display of the presenting frame is finished; called by
+ * the thread that displays the frames
+ */
+void framePresented() noexcept;
+
+/**
+ * @brief starts the probe mode: key presses are injected at a fixed rate
+ * until enough latencies are measured, then the escape key is injected
+ *
+ * @return const bool true, the probe is available in this build
+ */
+const bool startProbe() noexcept;
+
+/**
+ * @brief indicates if the probe mode is started
+ *
+ * @return const bool
+ */
+const bool isProbing() noexcept;
+
+/**
+ * @brief gets the next injected key press if one is expected at this time
+ *
+ * @param event the event to fill
+ *
+ * @return const bool true if the event has been filled
+ */
+const bool pollInjectedEvent(sf::Event& event) noexcept;
+
+/**
+ * @brief reports the latencies histograms on the error output
+ */
+void report() noexcept;
+
+#else
+
+inline void inputQueued() noexcept
+{
+}
+
+inline void inputDropped() noexcept
+{
+}
+
+inline void inputDequeued() noexcept
+{
+}
+
+inline void inputsCleared() noexcept
+{
+}
+
+inline void stateChanged() noexcept
+{
+}
+
+inline void frameStarted() noexcept
+{
+}
+
+inline void framePublished() noexcept
+{
+}
+
+inline void framePresenting() noexcept
+{
+}
+
+inline void framePresented() noexcept
+{
+}
+
+inline const bool startProbe() noexcept
+{
+    return false;
+}
+
+inline const bool isProbing() noexcept
+{
+    return false;
+}
+
+inline const bool pollInjectedEvent(sf::Event&) noexcept
+{
+    return false;
+}
+
+inline void report() noexcept
+{
+}
+
+#endif
+
+}
+}
+
+#endif
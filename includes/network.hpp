@@ -0,0 +1,132 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file network.hpp
+ * @brief leaderboard service protocol, shared by the game client and the
+ * reference server; the messages are sent by batches, one batch is one SFML
+ * packet (so it is prefixed by its length on the socket); the server answers
+ * every batch with an acknowledgement that contains the amount of received
+ * messages
+ * @package network
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_NETWORK_H_
+#define MEMORIS_NETWORK_H_
+
+#include <SFML/Config.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sf
+{
+class Packet;
+}
+
+namespace memoris
+{
+namespace network
+{
+
+constexpr char SERVER_ADDRESS[] {"127.0.0.1"};
+constexpr unsigned short SERVER_PORT {53000};
+
+constexpr sf::Uint8 PROTOCOL_VERSION {1};
+
+/* the maximum amount of messages into one batch */
+constexpr sf::Uint16 MAXIMUM_BATCH_SIZE {32};
+
+/**
+ * the types of the messages; every message of a batch starts with its type
+ */
+enum class MessageType : sf::Uint8
+{
+    RESULT = 1,
+    ACKNOWLEDGEMENT = 2
+};
+
+/**
+ * one serie result uploaded to the leaderboard service
+ */
+struct ResultMessage
+{
+    /* in the [personals|officials]/name format */
+    std::string serieName;
+
+    std::string gameName;
+
+    sf::Uint16 time {0};
+
+    std::vector<sf::Uint16> levelsTimes;
+};
+
+/**
+ * @brief writes the given messages into one batch packet
+ *
+ * @param packet the packet to write
+ * @param messages the messages of the batch
+ */
+void writeBatch(
+    sf::Packet& packet,
+    const std::vector<ResultMessage>& messages
+);
+
+/**
+ * @brief reads the messages of one batch packet
+ *
+ * @param packet the received packet
+ * @param messages the container where the read messages are added
+ *
+ * @return const bool false if the packet is not a valid batch (unknown
+ * protocol version or message type, truncated packet)
+ */
+const bool readBatch(
+    sf::Packet& packet,
+    std::vector<ResultMessage>& messages
+);
+
+/**
+ * @brief writes the acknowledgement of one batch
+ *
+ * @param packet the packet to write
+ * @param messagesAmount the amount of received messages
+ */
+void writeAcknowledgement(
+    sf::Packet& packet,
+    const sf::Uint16& messagesAmount
+);
+
+/**
+ * @brief reads the acknowledgement of one batch
+ *
+ * @param packet the received packet
+ * @param messagesAmount the amount of messages received by the server
+ *
+ * @return const bool false if the packet is not a valid acknowledgement
+ */
+const bool readAcknowledgement(
+    sf::Packet& packet,
+    sf::Uint16& messagesAmount
+);
+
+}
+}
+
+#endif
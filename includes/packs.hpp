@@ -0,0 +1,139 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file packs.hpp
+ * @brief assets pack format, shared by the game and the pack builder; a pack
+ * is one file that starts with an index (the path, the flags, the position
+ * and the sizes of every asset) followed by the assets contents; an asset
+ * can be stored compressed (LZSS) when it makes it noticeably smaller; all
+ * the integers are little endian
+ * @package packs
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_PACKS_H_
+#define MEMORIS_PACKS_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+namespace packs
+{
+
+constexpr char MAGIC[] {"MPAK"};
+constexpr std::uint32_t FORMAT_VERSION {1};
+
+/* the content of the entry has to be decompressed before being used */
+constexpr std::uint8_t COMPRESSED_ENTRY {1};
+
+/**
+ * the index entry of one asset of the pack
+ */
+struct PackEntry
+{
+    /* the path of the original file, relative to the game directory */
+    std::string path;
+
+    std::uint8_t flags {0};
+
+    /* the position of the content from the beginning of the pack */
+    std::uint64_t offset {0};
+
+    /* the size of the content into the pack */
+    std::uint64_t storedSize {0};
+
+    /* the size of the original file */
+    std::uint64_t size {0};
+};
+
+/**
+ * @brief returns the size of the index of the given entries, so the position
+ * of the first content into the pack
+ *
+ * @param entries the entries of the pack
+ *
+ * @return const std::uint64_t
+ */
+const std::uint64_t getIndexSize(const std::vector<PackEntry>& entries);
+
+/**
+ * @brief writes the index of the given entries (including the header)
+ *
+ * @param index the buffer where the index is appended
+ * @param entries the entries of the pack, with their final offsets
+ */
+void writeIndex(
+    std::string& index,
+    const std::vector<PackEntry>& entries
+);
+
+/**
+ * @brief reads the index of the given pack
+ *
+ * @param data the content of the pack
+ * @param size the size of the pack
+ * @param entries the container where the read entries are added
+ *
+ * @return const bool false if the pack is not valid (unknown format version,
+ * truncated index, entry out of the pack)
+ */
+const bool readIndex(
+    const char* data,
+    const std::uint64_t& size,
+    std::vector<PackEntry>& entries
+);
+
+/**
+ * @brief compresses the given content
+ *
+ * @param content the content to compress
+ * @param size the size of the content
+ *
+ * @return std::vector<char>
+ */
+std::vector<char> compress(
+    const char* content,
+    const std::uint64_t& size
+);
+
+/**
+ * @brief decompresses the given content
+ *
+ * @param content the compressed content
+ * @param storedSize the size of the compressed content
+ * @param output the container where the decompressed content is written;
+ * resized to the original size
+ * @param size the size of the original content
+ *
+ * @return const bool false if the compressed content is corrupted
+ */
+const bool decompress(
+    const char* content,
+    const std::uint64_t& storedSize,
+    std::vector<char>& output,
+    const std::uint64_t& size
+);
+
+}
+}
+
+#endif
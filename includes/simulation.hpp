@@ -0,0 +1,366 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file simulation.hpp
+ * @brief headless levels simulation; the levels are played by a moves script
+ * or by a built-in agent without any window, music or sound, by applying the
+ * game rules directly on the level templates; used by the batch play mode to
+ * regression test the series and to drive automated playtesting
+ * @package simulation
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_SIMULATION_H_
+#define MEMORIS_SIMULATION_H_
+
+#include "NotCopiable.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace memoris
+{
+
+namespace managers
+{
+struct LevelTemplate;
+}
+
+namespace simulation
+{
+
+/* the level time of one move when no pace is given; the pace of the level
+   difficulty estimation, at which every official level can be finished */
+constexpr float DEFAULT_SECONDS_PER_MOVEMENT {0.2f};
+
+/* a new serie starts without any life and with a watching time of 6 seconds
+   (see PlayingSerieManager) */
+constexpr unsigned short INITIAL_LIFES {0};
+constexpr unsigned short INITIAL_WATCHING_TIME {6};
+
+/**
+ * the way one simulated level ended
+ */
+enum class Outcome
+{
+    WIN,
+    TIME_OVER,
+    NO_LIFE,
+
+    /* the script has no more moves or the agent cannot reach any target */
+    UNFINISHED,
+
+    /* the serie ended before this level */
+    NOT_PLAYED
+};
+
+/**
+ * the result of one simulated level
+ */
+struct LevelResult
+{
+    /* the path of the level file */
+    std::string filePath;
+
+    /* the path of the serie file, empty for a level played alone */
+    std::string serieFilePath;
+
+    Outcome outcome {Outcome::UNFINISHED};
+
+    /* the level timer is simulated: every move takes the same time and the
+       timer is paused during the floors animations, as into the game */
+    float time {0.f};
+
+    /* the moves that changed the player cell, and the ones stopped by a
+       wall or by the floor borders */
+    unsigned short moves {0};
+    unsigned short collisions {0};
+
+    unsigned short foundStars {0};
+    unsigned short starsAmount {0};
+
+    /* the lifes and the watching time at the end of the level, carried to
+       the next level of the serie when the level is won */
+    unsigned short lifes {0};
+    unsigned short watchingTime {0};
+
+    /* the playing time of the serie at the end of the level: the sum of the
+       times of the level and of the previous levels of the serie */
+    float serieTime {0.f};
+};
+
+/**
+ * levels played in a row, as a serie; every won level gives its lifes and its
+ * watching time to the next one, the first level that is not won ends the
+ * serie
+ */
+struct PlayedSerie
+{
+    /* the path of the serie file, empty for one level played alone */
+    std::string filePath;
+
+    std::vector<std::string> levelsPaths;
+};
+
+/**
+ * what happened during one move of the player
+ */
+struct MoveReport
+{
+    /* the player entered a new cell */
+    bool moved {false};
+
+    /* the move was stopped by the wall at the given index; the moves
+       stopped by the floor borders are not reported */
+    bool hitWall {false};
+    unsigned short wallIndex {0};
+
+    bool foundStar {false};
+
+    /* the player entered a less life cell; the level is lost if the player
+       had no life anymore */
+    bool lostLife {false};
+};
+
+/**
+ * one level played move after move; the rules are the ones of the game
+ * controller, without the animations, the sounds and the display
+ */
+class LevelPlayer : public utils::NotCopiable
+{
+
+public:
+
+    /**
+     * @brief constructor, copies the cells of the given level
+     *
+     * @param levelTemplate the parsed level
+     * @param lifes the lifes at the beginning of the level
+     * @param watchingTime the watching time at the beginning of the level,
+     * changed by the more and less time cells
+     *
+     * not noexcept because the cells are copied
+     */
+    LevelPlayer(
+        const managers::LevelTemplate& levelTemplate,
+        const unsigned short& lifes = INITIAL_LIFES,
+        const unsigned short& watchingTime = INITIAL_WATCHING_TIME
+    );
+
+    /**
+     * @brief default destructor, empty, only used for forwarding declaration
+     */
+    ~LevelPlayer() noexcept;
+
+    /**
+     * @brief tries to move the player at the given level time; nothing
+     * happens once the level is over
+     *
+     * @param movement the cells offset of the move (see getMovement())
+     * @param time the level time of the move, in seconds since the end of
+     * the watching period, not counting the animations; the level is lost if
+     * it is after the end of the timer
+     *
+     * @return const MoveReport
+     */
+    const MoveReport move(
+        const short& movement,
+        const float& time
+    ) & noexcept;
+
+    /**
+     * @brief stops the level at the given level time, without any move; the
+     * level is lost if the timer is over at this time
+     *
+     * @param time the level time, in seconds
+     */
+    void stop(const float& time) & noexcept;
+
+    /**
+     * @brief checks if the given movement stays inside the floor of the
+     * given cell
+     *
+     * @param index the cell the movement starts from
+     * @param movement the cells offset of the move
+     *
+     * @return const bool
+     */
+    static const bool isInsideFloor(
+        const unsigned short& index,
+        const short& movement
+    ) noexcept;
+
+    /**
+     * @brief checks if the player can go from the given cell with the given
+     * movement: the movement stays inside the floor and does not go into a
+     * wall
+     *
+     * @param index the cell the movement starts from
+     * @param movement the cells offset of the move
+     *
+     * @return const bool
+     */
+    const bool isAllowed(
+        const unsigned short& index,
+        const short& movement
+    ) const & noexcept;
+
+    /**
+     * @brief true once the level is won or lost
+     *
+     * @return const bool&
+     */
+    const bool& isOver() const & noexcept;
+
+    /**
+     * @brief getter of the index of the player cell
+     *
+     * @return const unsigned short&
+     */
+    const unsigned short& getPlayerIndex() const & noexcept;
+
+    /**
+     * @brief getter of the current type of the given cell
+     *
+     * @param index the index of the cell into the level
+     *
+     * @return const char&
+     */
+    const char& getCellType(const unsigned short& index) const & noexcept;
+
+    /**
+     * @brief getter of the current result of the level; the outcome stays
+     * UNFINISHED while the level is not over
+     *
+     * @return const LevelResult&
+     */
+    const LevelResult& getResult() const & noexcept;
+
+private:
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+/**
+ * @brief returns the cells offset of the given move character
+ *
+ * @param character U (up), D (down), L (left) or R (right), in uppercase or
+ * in lowercase
+ *
+ * @return const short 0 if the character is not a move
+ */
+const short getMovement(const char& character) noexcept;
+
+/**
+ * @brief plays the given level with the given moves script
+ *
+ * @param levelTemplate the parsed level
+ * @param script the moves, one character per move: U (up), D (down), L
+ * (left) or R (right); the other characters are ignored
+ * @param secondsPerMovement the level time of every move
+ *
+ * @return const LevelResult the file path of the result is empty
+ *
+ * not noexcept because the level cells are copied
+ */
+const LevelResult playScript(
+    const managers::LevelTemplate& levelTemplate,
+    const std::string& script,
+    const float& secondsPerMovement
+);
+
+/**
+ * @brief plays the given level with the built-in agent; the agent knows the
+ * whole level and always goes to the nearest star (or to the arrival when
+ * all the stars are found), the path is computed again after every move, so
+ * the floors transformations are followed
+ *
+ * @param levelTemplate the parsed level
+ * @param secondsPerMovement the level time of every move
+ *
+ * @return const LevelResult the file path of the result is empty
+ *
+ * not noexcept because the path computation containers may throw
+ * std::bad_alloc
+ */
+const LevelResult playAgent(
+    const managers::LevelTemplate& levelTemplate,
+    const float& secondsPerMovement
+);
+
+/**
+ * @brief plays the given level with the built-in agent and returns its moves
+ * as a script that playScript() replays
+ *
+ * @param levelTemplate the parsed level
+ * @param secondsPerMovement the level time of every move
+ *
+ * @return const std::string one character per move: U, D, L or R
+ *
+ * not noexcept because the path computation containers may throw
+ * std::bad_alloc
+ */
+const std::string getAgentScript(
+    const managers::LevelTemplate& levelTemplate,
+    const float& secondsPerMovement
+);
+
+/**
+ * @brief parses and plays the given series; the series are played in
+ * parallel, one worker thread per available core, and the levels of one
+ * serie are played in order
+ *
+ * @param series the played series, a level played alone is a serie of one
+ * level
+ * @param scripts the moves scripts of the levels, in the same order as the
+ * levels of the series; the built-in agent plays every level if the
+ * container is empty, a level without script does not move
+ * @param secondsPerMovement the level time of every move
+ *
+ * @return std::vector<LevelResult> the results of all the levels, in the
+ * same order as the levels of the series
+ *
+ * @throw std::invalid_argument one level file cannot be opened or parsed
+ */
+std::vector<LevelResult> playSeries(
+    const std::vector<PlayedSerie>& series,
+    const std::vector<std::string>& scripts,
+    const float& secondsPerMovement
+);
+
+/**
+ * @brief writes the given results as a JSON array, one object per level
+ *
+ * @param stream the output stream
+ * @param results the results to write
+ *
+ * not noexcept because the stream may throw if its exceptions are enabled
+ */
+void writeJson(
+    std::ostream& stream,
+    const std::vector<LevelResult>& results
+);
+
+}
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file snapshots.hpp
+ * @brief binary snapshots of an in-progress serie, saved into the game file;
+ * a snapshot contains the state of the playing serie manager and optionally
+ * the state of the level that is currently played
+ * @package snapshots
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_SNAPSHOTS_H_
+#define MEMORIS_SNAPSHOTS_H_
+
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+namespace snapshots
+{
+
+/**
+ * state of the level that is currently played; only saved when the player
+ * leaves a level before its end
+ */
+struct LevelSnapshot
+{
+    /* one character per cell, same format as the level files */
+    std::vector<char> cells;
+
+    /* one boolean per cell, packed as bits into the file */
+    std::vector<bool> visibilities;
+
+    unsigned short playerIndex {0};
+    unsigned short minutes {0};
+    unsigned short seconds {0};
+    unsigned short foundStars {0};
+    unsigned short lifes {0};
+    unsigned short watchingTime {0};
+    unsigned short playingTime {0};
+};
+
+/**
+ * state of the playing serie manager; the first level of the levels list is
+ * the level to play when the serie is resumed
+ */
+struct SerieSnapshot
+{
+    /* in the [personals|officials]/name format */
+    std::string serieName;
+
+    std::vector<std::string> levels;
+
+    /* the playing time of every finished level, in seconds */
+    std::vector<unsigned short> levelsTimes;
+
+    unsigned short levelIndex {0};
+    unsigned short lifes {0};
+    unsigned short watchingTime {0};
+    unsigned short totalPlayingTime {0};
+
+    bool hasLevel {false};
+
+    LevelSnapshot level;
+};
+
+/**
+ * @brief creates the binary representation of the given snapshot
+ *
+ * @param snapshot the snapshot to serialize
+ *
+ * @return std::vector<char>
+ *
+ * not noexcept because the vector allocation may throw std::bad_alloc
+ */
+std::vector<char> serialize(const SerieSnapshot& snapshot);
+
+/**
+ * @brief creates a snapshot from its binary representation
+ *
+ * @param bytes the bytes read from the game file
+ *
+ * @return SerieSnapshot
+ *
+ * @throw std::invalid_argument the bytes are not a valid snapshot (unknown
+ * format version, truncated or corrupted content)
+ */
+SerieSnapshot deserialize(const std::vector<char>& bytes);
+
+}
+}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file transforms.hpp
+ * @brief whole floor transformations (mirrors, diagonal, rotations...)
+ * applied on packed floors; one packed floor is an array of 256 bytes (one
+ * byte per cell, line after line); the same functions are used for the cells
+ * types and for the cells visibilities; the transformations are fixed
+ * permutations, so they are vectorized when the processor allows it
+ * @package transforms
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_TRANSFORMS_H_
+#define MEMORIS_TRANSFORMS_H_
+
+#include <array>
+
+namespace memoris
+{
+namespace transforms
+{
+
+constexpr unsigned short CELLS_PER_LINE {16};
+constexpr unsigned short CELLS_PER_FLOOR {256};
+
+/* one byte per cell; the visibilities array contains 1 for a visible cell
+   and 0 for a hidden cell; both of the containers have exactly the same
+   layout, so they can be transformed by the same kernels */
+using PackedFloor = std::array<char, CELLS_PER_FLOOR>;
+
+/**
+ * all the floor transformations; each one matches the final cells disposition
+ * of one level animation
+ */
+enum class FloorTransform
+{
+    HORIZONTAL_MIRROR,
+    VERTICAL_MIRROR,
+    DIAGONAL,
+    LEFT_ROTATION,
+    RIGHT_ROTATION,
+    QUARTER_ROTATION,
+    INVERTED_QUARTER_ROTATION
+};
+
+/**
+ * the instructions set used to apply the transformations, selected one time
+ * at runtime according to the processor capabilities
+ */
+enum class InstructionsSet
+{
+    SCALAR,
+    SSE4,
+    AVX2
+};
+
+/**
+ * @brief applies the given transformation on a packed floor
+ *
+ * @param transform the transformation to apply
+ * @param destination the packed floor to write, must not overlap source
+ * @param source the packed floor to read
+ */
+void applyFloorTransform(
+    const FloorTransform& transform,
+    PackedFloor& destination,
+    const PackedFloor& source
+) noexcept;
+
+/**
+ * @brief applies the given transformation in place on both the types and
+ * the visibilities of one floor
+ *
+ * @param transform the transformation to apply
+ * @param types the cells types of the floor
+ * @param visibilities the cells visibilities of the floor
+ */
+void applyFloorTransformInPlace(
+    const FloorTransform& transform,
+    PackedFloor& types,
+    PackedFloor& visibilities
+) noexcept;
+
+/**
+ * @brief returns the index (inside the floor) where the given cell index is
+ * moved by the transformation; used to follow the player during the
+ * transformation
+ *
+ * @param transform the applied transformation
+ * @param index the index of the cell inside the floor (from 0 to 255)
+ *
+ * @return const unsigned short
+ */
+const unsigned short getTransformedIndex(
+    const FloorTransform& transform,
+    const unsigned short& index
+) noexcept;
+
+/**
+ * @brief returns the index (inside the floor) of the cell that is moved to
+ * the given index by the transformation; this is the reference scalar
+ * definition of every transformation
+ *
+ * @param transform the applied transformation
+ * @param index the destination index of the cell inside the floor
+ *
+ * @return const unsigned short
+ */
+const unsigned short getSourceIndex(
+    const FloorTransform& transform,
+    const unsigned short& index
+) noexcept;
+
+/**
+ * @brief getter of the instructions set selected for the current processor
+ *
+ * @return const InstructionsSet&
+ */
+const InstructionsSet& getInstructionsSet() noexcept;
+
+}
+}
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file transformsKernels.hpp
+ * @brief vectorized floor transformations kernels; each instructions set is
+ * defined into its own source file, compiled with the matching compiler
+ * flags; included by transforms.cpp that selects the kernel at runtime and by
+ * the kernels tests
+ * @package transforms
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_TRANSFORMSKERNELS_H_
+#define MEMORIS_TRANSFORMSKERNELS_H_
+
+#include "transforms.hpp"
+
+namespace memoris
+{
+namespace transforms
+{
+namespace kernels
+{
+
+/**
+ * @brief reference scalar kernel, every cell is copied one by one; defined
+ * for every architecture
+ *
+ * @param transform the transformation to apply
+ * @param destination the 256 bytes to write
+ * @param source the 256 bytes to read
+ */
+void applyScalar(
+    const FloorTransform& transform,
+    char* destination,
+    const char* source
+) noexcept;
+
+/**
+ * @brief indicates if the SSE4 kernels have been compiled; false when the
+ * target architecture does not support them
+ *
+ * @return const bool
+ */
+const bool hasSse4Kernels() noexcept;
+
+/**
+ * @brief applies the transformation using SSE4 instructions; must only be
+ * called if hasSse4Kernels() returns true and if the processor supports SSE4
+ *
+ * @param transform the transformation to apply
+ * @param destination the 256 bytes to write
+ * @param source the 256 bytes to read
+ */
+void applySse4(
+    const FloorTransform& transform,
+    char* destination,
+    const char* source
+) noexcept;
+
+/**
+ * @brief indicates if the AVX2 kernels have been compiled
+ *
+ * @return const bool
+ */
+const bool hasAvx2Kernels() noexcept;
+
+/**
+ * @brief applies the transformation using AVX2 instructions; must only be
+ * called if hasAvx2Kernels() returns true and if the processor supports AVX2
+ *
+ * @param transform the transformation to apply
+ * @param destination the 256 bytes to write
+ * @param source the 256 bytes to read
+ */
+void applyAvx2(
+    const FloorTransform& transform,
+    char* destination,
+    const char* source
+) noexcept;
+
+}
+}
+}
+
+#endif
@@ -43,6 +43,29 @@ constexpr unsigned int WIDTH = 1600;
 constexpr unsigned int HEIGHT = 900;
 constexpr unsigned int RESOLUTION = 32;
 
+/* percentage of the design resolution used to render the scene, set at the
+   configuration step (see CMakeLists.txt) */
+
+#ifdef MEMORIS_RENDER_SCALE
+constexpr unsigned int RENDER_SCALE = MEMORIS_RENDER_SCALE;
+#else
+constexpr unsigned int RENDER_SCALE = 100;
+#endif
+
+static_assert(
+    RENDER_SCALE > 0 && RENDER_SCALE <= 100,
+    "the render scale must be a percentage between 1 and 100"
+);
+
+/* the frames are displayed by a separated thread (see FramePresenter.hpp),
+   set at the configuration step */
+
+#ifdef MEMORIS_PRESENTING_THREAD
+constexpr bool PRESENTING_THREAD = true;
+#else
+constexpr bool PRESENTING_THREAD = false;
+#endif
+
 /* extern to be sure that we only declare them one time */
 
 extern const std::string TITLE;
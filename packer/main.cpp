@@ -0,0 +1,239 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file main.cpp
+ * @brief assets pack builder; concatenates the resources manifest and all
+ * the files of the resources directories into one pack file, used by the
+ * game instead of the separated files; the assets that are noticeably
+ * smaller once compressed are stored compressed, except with the "--store"
+ * option; must be executed from the game directory
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "packs.hpp"
+
+#include <dirent.h>
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace memoris;
+
+namespace
+{
+
+constexpr const char* PACK_PATH {"res/resources.pack"};
+
+constexpr const char* MANIFEST_PATH {"res/resources.manifest"};
+
+constexpr const char* RESOURCES_DIRECTORIES[] {
+    "res/cells/",
+    "res/images/",
+    "res/sounds/",
+    "res/fonts/",
+    "res/musics/"
+};
+
+/* an asset is compressed if it saves at least one eighth of its size */
+constexpr std::uint64_t COMPRESSION_RATIO_DIVISOR {8};
+
+/**
+ * @brief adds the files of the given directory into the given container,
+ * ignores the directory if it does not exist
+ *
+ * @param directory the directory path, ends with a slash
+ * @param paths the container where the files paths are added
+ */
+void addDirectoryFiles(
+    const std::string& directory,
+    std::vector<std::string>& paths
+)
+{
+    DIR* dir = opendir(directory.c_str());
+
+    if (dir == NULL)
+    {
+        return;
+    }
+
+    struct dirent* reader = NULL;
+
+    while ((reader = readdir(dir)) != NULL)
+    {
+        const std::string name = reader->d_name;
+
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+
+        paths.push_back(directory + name);
+    }
+
+    closedir(dir);
+}
+
+/**
+ * @brief reads the whole content of the given file
+ *
+ * @param path the file to read
+ * @param content the container where the content is written
+ *
+ * @return const bool false if the file cannot be read
+ */
+const bool readFile(
+    const std::string& path,
+    std::vector<char>& content
+)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    content.assign(
+        std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>()
+    );
+
+    return !file.bad();
+}
+
+}
+
+/**
+ *
+ */
+int main(int argc, char* argv[])
+{
+    const bool store = argc == 2 && std::string(argv[1]) == "--store";
+
+    if (argc > 2 || (argc == 2 && !store))
+    {
+        std::cerr << "Usage: " << argv[0] << " [--store]" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> paths {MANIFEST_PATH};
+
+    for (const char* directory : RESOURCES_DIRECTORIES)
+    {
+        addDirectoryFiles(
+            directory,
+            paths
+        );
+    }
+
+    /* the pack content does not depend on the directories order */
+    std::sort(
+        paths.begin() + 1,
+        paths.end()
+    );
+
+    std::vector<packs::PackEntry> entries;
+    std::vector<std::vector<char>> contents;
+
+    for (const std::string& path : paths)
+    {
+        std::vector<char> content;
+
+        if (!readFile(path, content))
+        {
+            std::cerr << "Cannot read " << path << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        packs::PackEntry entry;
+        entry.path = path;
+        entry.size = content.size();
+
+        if (!store)
+        {
+            std::vector<char> compressed = packs::compress(
+                content.data(),
+                content.size()
+            );
+
+            if (
+                compressed.size() <= content.size() -
+                    content.size() / COMPRESSION_RATIO_DIVISOR
+            )
+            {
+                entry.flags |= packs::COMPRESSED_ENTRY;
+                content = std::move(compressed);
+            }
+        }
+
+        entry.storedSize = content.size();
+
+        entries.push_back(std::move(entry));
+        contents.push_back(std::move(content));
+    }
+
+    std::uint64_t offset = packs::getIndexSize(entries);
+
+    for (packs::PackEntry& entry : entries)
+    {
+        entry.offset = offset;
+        offset += entry.storedSize;
+    }
+
+    std::string index;
+    packs::writeIndex(
+        index,
+        entries
+    );
+
+    std::ofstream file(PACK_PATH, std::ios::binary | std::ios::trunc);
+    file.write(index.data(), index.size());
+
+    for (const std::vector<char>& content : contents)
+    {
+        file.write(content.data(), content.size());
+    }
+
+    file.close();
+
+    if (!file)
+    {
+        std::cerr << "Cannot write " << PACK_PATH << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    for (const packs::PackEntry& entry : entries)
+    {
+        std::cout << entry.path << " " << entry.size << " -> " <<
+            entry.storedSize << std::endl;
+    }
+
+    std::cout << entries.size() << " assets written into " << PACK_PATH <<
+        " (" << offset << " bytes)" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file main.cpp
+ * @brief reference leaderboard server; receives the results batches from
+ * the game clients, keeps the results in memory and prints them; used to
+ * test the leaderboard client on the local host
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "network.hpp"
+
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/Packet.hpp>
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <list>
+#include <string>
+#include <cstdlib>
+
+using namespace memoris;
+
+/**
+ *
+ */
+int main(int argc, char* argv[])
+{
+    unsigned short port {network::SERVER_PORT};
+
+    if (argc > 1)
+    {
+        port = static_cast<unsigned short>(std::atoi(argv[1]));
+    }
+
+    sf::TcpListener listener;
+
+    if (listener.listen(port) != sf::Socket::Done)
+    {
+        std::cerr << "Cannot listen on port " << port << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Leaderboard server listening on port " << port << std::endl;
+
+    sf::SocketSelector selector;
+    selector.add(listener);
+
+    /* the clients sockets are not copiable, so we store pointers; a list is
+       used as the clients are removed from anywhere when they disconnect */
+    std::list<std::unique_ptr<sf::TcpSocket>> clients;
+
+    std::map<std::string, std::vector<network::ResultMessage>> results;
+
+    while (true)
+    {
+        if (!selector.wait())
+        {
+            continue;
+        }
+
+        if (selector.isReady(listener))
+        {
+            auto client = std::make_unique<sf::TcpSocket>();
+
+            if (listener.accept(*client) == sf::Socket::Done)
+            {
+                /* a slow client never blocks the other ones: its packets are
+                   received piece by piece */
+                client->setBlocking(false);
+
+                selector.add(*client);
+                clients.push_back(std::move(client));
+            }
+        }
+
+        for (auto iterator = clients.begin(); iterator != clients.end();)
+        {
+            sf::TcpSocket& client = **iterator;
+
+            if (!selector.isReady(client))
+            {
+                iterator++;
+
+                continue;
+            }
+
+            sf::Packet packet;
+            const sf::Socket::Status status = client.receive(packet);
+
+            if (status == sf::Socket::NotReady)
+            {
+                iterator++;
+
+                continue;
+            }
+
+            std::vector<network::ResultMessage> batch;
+
+            if (
+                status != sf::Socket::Done ||
+                !network::readBatch(packet, batch)
+            )
+            {
+                selector.remove(client);
+                iterator = clients.erase(iterator);
+
+                continue;
+            }
+
+            for (auto& message : batch)
+            {
+                std::cout << message.serieName << " " << message.gameName <<
+                    " " << message.time << "s (" <<
+                    message.levelsTimes.size() << " levels)" << std::endl;
+
+                results[message.serieName].push_back(std::move(message));
+            }
+
+            sf::Packet answer;
+            network::writeAcknowledgement(
+                answer,
+                static_cast<sf::Uint16>(batch.size())
+            );
+
+            /* the acknowledgement is a few bytes, it is immediately written
+               into the socket buffer */
+            client.send(answer);
+
+            iterator++;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
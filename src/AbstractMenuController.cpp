@@ -31,8 +31,9 @@
 #include <vector>
 #include <cstdlib>
 
-using UniquePtrMenuItemContainer =
-    std::vector<std::unique_ptr<memoris::items::MenuItem>>;
+using MenuItemsContainer = memoris::allocators::ArenaVector<
+    memoris::allocators::ArenaPtr<memoris::items::MenuItem>
+>;
 
 namespace memoris
 {
@@ -44,9 +45,19 @@ class AbstractMenuController::Impl
 
 public:
 
+    Impl(allocators::MonotonicArena& arena) :
+        items(arena)
+    {
+        /* the menus never contain more items, so the container buffer is
+           never replaced into the arena */
+        items.reserve(MAXIMUM_ITEMS);
+    }
+
+    static constexpr size_t MAXIMUM_ITEMS {8};
+
     unsigned short selectorPosition {0};
 
-    UniquePtrMenuItemContainer items;
+    MenuItemsContainer items;
 };
 
 /**
@@ -54,7 +65,7 @@ public:
  */
 AbstractMenuController::AbstractMenuController(const utils::Context& context) :
     Controller(context),
-    impl(std::make_unique<Impl>())
+    impl(std::make_unique<Impl>(getArena()))
 {
 }
 
@@ -67,7 +78,7 @@ AbstractMenuController::~AbstractMenuController() noexcept = default;
  *
  */
 void AbstractMenuController::addMenuItem(
-    std::unique_ptr<items::MenuItem> item
+    allocators::ArenaPtr<items::MenuItem> item
 ) &
 {
     impl->items.push_back(std::move(item));
@@ -80,7 +91,7 @@ void AbstractMenuController::renderAllMenuItems(
     const utils::Context& context
 ) const &
 {
-    for (auto& item : impl->items) // item -> std::unique_ptr<items::MenuItem>&
+    for (auto& item : impl->items) // item -> ArenaPtr<items::MenuItem>&
     {
         item->render(context);
     }
@@ -144,7 +155,7 @@ void AbstractMenuController::updateMenuSelection(
     /* browse all the menu items; use an iterator in order to calculate the
        current index during each iteration */
     for(
-        UniquePtrMenuItemContainer::const_iterator iterator =
+        MenuItemsContainer::const_iterator iterator =
             impl->items.cbegin();
         iterator != impl->items.cend();
         ++iterator
@@ -45,9 +45,13 @@ public:
 /**
  *
  */
-AbstractMirrorAnimation::AbstractMirrorAnimation() :
-    impl(std::make_unique<Impl>())
+AbstractMirrorAnimation::AbstractMirrorAnimation()
 {
+    /* Impl is one byte on every platform, so its storage has no headroom */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The AbstractMirrorAnimation implementation does not fit its storage"
+    );
 }
 
 /**
@@ -55,6 +59,14 @@ AbstractMirrorAnimation::AbstractMirrorAnimation() :
  */
 AbstractMirrorAnimation::~AbstractMirrorAnimation() noexcept = default;
 
+/**
+ *
+ */
+void AbstractMirrorAnimation::resetAnimation(const utils::Context&) &
+{
+    setNoTransparent();
+}
+
 /**
  *
  */
@@ -96,7 +108,7 @@ void AbstractMirrorAnimation::applyTransparencyOnOneCell(
     const unsigned short& index
 ) const &
 {
-    level->getCells()[index]->setCellColorTransparency(
+    level->getCell(index).setCellColorTransparency(
         context,
         impl->animatedSideTransparency
     );
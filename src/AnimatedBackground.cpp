@@ -27,6 +27,9 @@
 #include "Context.hpp"
 #include "dimensions.hpp"
 #include "cells.hpp"
+#include "Cell.hpp"
+
+#include <array>
 
 #include <time.h>
 
@@ -90,29 +93,19 @@ void AnimatedBackground::render(const utils::Context& context) const &
  */
 void AnimatedBackground::initializeCells(const utils::Context& context) &
 {
-    /* TODO: #488 bad idea, we have to update this container manually everytime
-       we add new cells types */
-    const char cellsLib[] =
+    /* the background shows every cell type that can be put into a level */
+    std::array<char, cells::CELL_TYPES_AMOUNT> cellsLib;
+    size_t cellsLibSize {0};
+
+    for (unsigned char id {0}; id < cells::CELL_TYPES_AMOUNT; id++)
     {
-        cells::EMPTY_CELL,
-        cells::DEPARTURE_CELL,
-        cells::ARRIVAL_CELL,
-        cells::STAR_CELL,
-        cells::MORE_LIFE_CELL,
-        cells::LESS_LIFE_CELL,
-        cells::MORE_TIME_CELL,
-        cells::LESS_TIME_CELL,
-        cells::WALL_CELL,
-        cells::STAIRS_UP_CELL,
-        cells::STAIRS_DOWN_CELL,
-        cells::HORIZONTAL_MIRROR_CELL,
-        cells::VERTICAL_MIRROR_CELL,
-        cells::DIAGONAL_CELL,
-        cells::LEFT_ROTATION_CELL,
-        cells::RIGHT_ROTATION_CELL,
-        cells::ELEVATOR_UP_CELL,
-        cells::ELEVATOR_DOWN_CELL
-    };
+        const cells::CellTraits& traits = cells::getCellTraitsById(id);
+
+        if (traits.placeable)
+        {
+            cellsLib[cellsLibSize++] = traits.type;
+        }
+    }
 
     unsigned short currentLine {0}, currentColumn {0};
 
@@ -140,7 +133,7 @@ void AnimatedBackground::initializeCells(const utils::Context& context) &
             currentColumn++;
         }
 
-        if(randomNumber >= (sizeof(cellsLib) / sizeof(char)))
+        if(randomNumber >= cellsLibSize)
         {
             continue;
         }
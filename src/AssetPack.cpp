@@ -0,0 +1,197 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file AssetPack.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "AssetPack.hpp"
+
+#include "packs.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <unordered_map>
+#include <vector>
+#include <stdexcept>
+
+namespace memoris
+{
+namespace utils
+{
+
+class AssetPack::Impl
+{
+
+public:
+
+    /**
+     * @brief destructor, unmaps the pack if it has been mapped
+     */
+    ~Impl() noexcept
+    {
+        if (data != nullptr)
+        {
+            munmap(
+                const_cast<char*>(data),
+                size
+            );
+        }
+    }
+
+    /* nullptr if there is no pack */
+    const char* data {nullptr};
+
+    size_t size {0};
+
+    std::unordered_map<std::string, packs::PackEntry> entries;
+
+    /* the compressed assets once decompressed; kept until the end, the fonts
+       and the musics read their data while they are used */
+    std::unordered_map<std::string, std::vector<char>> decompressedAssets;
+};
+
+/**
+ *
+ */
+AssetPack::AssetPack(const std::string& path) :
+    impl(std::make_unique<Impl>())
+{
+    /* this part uses the POSIX C functions, so it also uses old-C++ coding
+       style (file descriptor) */
+
+    const int file = open(path.c_str(), O_RDONLY);
+
+    if (file == -1)
+    {
+        return;
+    }
+
+    struct stat status;
+
+    if (fstat(file, &status) == -1 || status.st_size == 0)
+    {
+        close(file);
+
+        throw std::invalid_argument("Cannot read the assets pack " + path);
+    }
+
+    void* mapping = mmap(
+        nullptr,
+        status.st_size,
+        PROT_READ,
+        MAP_PRIVATE,
+        file,
+        0
+    );
+
+    /* the mapping stays valid once the file is closed */
+    close(file);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::invalid_argument("Cannot map the assets pack " + path);
+    }
+
+    impl->data = static_cast<const char*>(mapping);
+    impl->size = status.st_size;
+
+    std::vector<packs::PackEntry> entries;
+
+    if (!packs::readIndex(impl->data, impl->size, entries))
+    {
+        throw std::invalid_argument("Invalid assets pack " + path);
+    }
+
+    for (packs::PackEntry& entry : entries)
+    {
+        std::string entryPath = entry.path;
+
+        impl->entries.emplace(
+            std::move(entryPath),
+            std::move(entry)
+        );
+    }
+}
+
+/**
+ *
+ */
+AssetPack::~AssetPack() noexcept = default;
+
+/**
+ *
+ */
+const AssetView AssetPack::getAsset(const std::string& path) const &
+{
+    AssetView view;
+
+    const auto entry = impl->entries.find(path);
+
+    if (entry == impl->entries.end())
+    {
+        return view;
+    }
+
+    const packs::PackEntry& packEntry = entry->second;
+
+    if (!(packEntry.flags & packs::COMPRESSED_ENTRY))
+    {
+        view.data = impl->data + packEntry.offset;
+        view.size = packEntry.size;
+
+        return view;
+    }
+
+    auto decompressed = impl->decompressedAssets.find(path);
+
+    if (decompressed == impl->decompressedAssets.end())
+    {
+        std::vector<char> content;
+
+        if (
+            !packs::decompress(
+                impl->data + packEntry.offset,
+                packEntry.storedSize,
+                content,
+                packEntry.size
+            )
+        )
+        {
+            throw std::invalid_argument("Corrupted asset " + path);
+        }
+
+        decompressed = impl->decompressedAssets.emplace(
+            path,
+            std::move(content)
+        ).first;
+    }
+
+    view.data = decompressed->second.data();
+    view.size = decompressed->second.size();
+
+    return view;
+}
+
+}
+}
@@ -0,0 +1,379 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file AsyncFileWriter.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "AsyncFileWriter.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <cstdio>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace memoris
+{
+namespace utils
+{
+
+namespace
+{
+
+constexpr char TEMPORARY_FILE_EXTENSION[] {".tmp"};
+
+/**
+ * one file to write, waiting into the writing queue
+ */
+struct Job
+{
+    std::string path;
+    std::vector<char> content;
+    std::promise<bool> result;
+
+    /* true if the content is added at the end of the file */
+    bool append {false};
+};
+
+/**
+ * @brief writes all the given bytes into the given file descriptor
+ *
+ * @param descriptor the file descriptor to write
+ * @param content the bytes to write
+ *
+ * @return const bool
+ */
+const bool writeAll(
+    const int& descriptor,
+    const std::vector<char>& content
+) noexcept
+{
+    const char* data = content.data();
+    size_t remaining = content.size();
+
+    while (remaining)
+    {
+        const ssize_t written = ::write(
+            descriptor,
+            data,
+            remaining
+        );
+
+        /* a signal received before any byte is written interrupts the
+           call, it is simply executed again */
+        if (written == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (written == -1)
+        {
+            return false;
+        }
+
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    return true;
+}
+
+/**
+ * @brief flushes on the disk the directory that contains the given file;
+ * the creation or the rename of a file is a modification of its directory,
+ * it is only durable once the directory itself is flushed
+ *
+ * @param path the file path
+ *
+ * @return const bool
+ */
+const bool syncParentDirectory(const std::string& path) noexcept
+{
+    const size_t separator = path.find_last_of('/');
+
+    const std::string directory =
+        separator == std::string::npos ? "." : path.substr(0, separator + 1);
+
+    const int descriptor = open(
+        directory.c_str(),
+        O_RDONLY | O_DIRECTORY
+    );
+
+    if (descriptor == -1)
+    {
+        return false;
+    }
+
+    const bool result = fsync(descriptor) == 0;
+
+    close(descriptor);
+
+    return result;
+}
+
+/**
+ * @brief adds the given content at the end of the file and flushes it on
+ * the disk
+ *
+ * @param path the file path
+ * @param content the bytes to append
+ *
+ * @return const bool
+ */
+const bool appendToFile(
+    const std::string& path,
+    const std::vector<char>& content
+) noexcept
+{
+    const int descriptor = open(
+        path.c_str(),
+        O_WRONLY | O_CREAT | O_APPEND,
+        0644
+    );
+
+    if (descriptor == -1)
+    {
+        return false;
+    }
+
+    const bool result =
+        writeAll(descriptor, content) &&
+        fsync(descriptor) == 0;
+
+    close(descriptor);
+
+    /* the file may have been created by this append */
+    return result && syncParentDirectory(path);
+}
+
+/**
+ * @brief writes the given content into a temporary file, flushes it on the
+ * disk and renames it as the destination file; the rename is atomic, so the
+ * destination file always contains either the previous content or the new
+ * one, even if the program crashes during the writing
+ *
+ * @param path the destination file path
+ * @param content the bytes to write
+ *
+ * @return const bool
+ */
+const bool writeAtomically(
+    const std::string& path,
+    const std::vector<char>& content
+) noexcept
+{
+    const std::string temporaryPath = path + TEMPORARY_FILE_EXTENSION;
+
+    const int descriptor = open(
+        temporaryPath.c_str(),
+        O_WRONLY | O_CREAT | O_TRUNC,
+        0644
+    );
+
+    if (descriptor == -1)
+    {
+        return false;
+    }
+
+    /* the content must be on the disk before the rename, otherwise a crash
+       could replace the previous file by an incomplete one */
+    if (
+        !writeAll(descriptor, content) ||
+        fsync(descriptor) == -1
+    )
+    {
+        close(descriptor);
+        std::remove(temporaryPath.c_str());
+
+        return false;
+    }
+
+    close(descriptor);
+
+    /* the renamed entry must be on the disk too, otherwise a crash could
+       bring the previous file back */
+    return std::rename(
+        temporaryPath.c_str(),
+        path.c_str()
+    ) == 0 && syncParentDirectory(path);
+}
+
+}
+
+class AsyncFileWriter::Impl
+{
+
+public:
+
+    /**
+     * @brief writing thread loop, waits for jobs and executes them one by
+     * one until the writer is destroyed and the queue is empty
+     */
+    void run() noexcept
+    {
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            condition.wait(
+                lock,
+                [this]()
+                {
+                    return stopped || !jobs.empty();
+                }
+            );
+
+            if (jobs.empty())
+            {
+                return;
+            }
+
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+
+            /* the file system operations are executed without the lock, so
+               the main thread can still add jobs during the writing */
+            lock.unlock();
+
+            if (job.append)
+            {
+                job.result.set_value(
+                    appendToFile(
+                        job.path,
+                        job.content
+                    )
+                );
+
+                continue;
+            }
+
+            job.result.set_value(
+                writeAtomically(
+                    job.path,
+                    job.content
+                )
+            );
+        }
+    }
+
+    /**
+     * @brief adds one job at the end of the queue and wakes up the writing
+     * thread
+     *
+     * @param path the path of the file to write
+     * @param content the bytes to write
+     * @param append true if the content is added at the end of the file
+     *
+     * @return std::future<bool>
+     */
+    std::future<bool> push(
+        const std::string& path,
+        std::vector<char> content,
+        const bool& append
+    )
+    {
+        Job job;
+        job.path = path;
+        job.content = std::move(content);
+        job.append = append;
+
+        std::future<bool> result = job.result.get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(std::move(job));
+        }
+
+        condition.notify_one();
+
+        return result;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    std::deque<Job> jobs;
+
+    bool stopped {false};
+
+    /* declared last: the thread is started once all the other attributes
+       have been initialized */
+    std::thread thread {&Impl::run, this};
+};
+
+/**
+ *
+ */
+AsyncFileWriter::AsyncFileWriter() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+AsyncFileWriter::~AsyncFileWriter() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopped = true;
+    }
+
+    impl->condition.notify_one();
+    impl->thread.join();
+}
+
+/**
+ *
+ */
+std::future<bool> AsyncFileWriter::write(
+    const std::string& path,
+    std::vector<char> content
+) const &
+{
+    return impl->push(
+        path,
+        std::move(content),
+        false
+    );
+}
+
+/**
+ *
+ */
+std::future<bool> AsyncFileWriter::append(
+    const std::string& path,
+    std::vector<char> content
+) const &
+{
+    return impl->push(
+        path,
+        std::move(content),
+        true
+    );
+}
+
+}
+}
@@ -118,13 +118,13 @@ Button::Button(
 void Button::display(const utils::Context& context)
 {
     /* draw the button background */
-    context.getSfmlWindow().draw(back);
+    context.getRenderTarget().draw(back);
 
     /* draw the button icon */
-    context.getSfmlWindow().draw(icon);
+    context.getRenderTarget().draw(icon);
 
     /* get the current cursor position */
-    sf::Vector2<int> cursorPosition = sf::Mouse::getPosition();
+    const sf::Vector2f cursorPosition = context.getMousePosition();
 
     /* change the color of the border if the mouse is hover the button */
     if (
@@ -155,10 +155,10 @@ void Button::display(const utils::Context& context)
     }
 
     /* draw the button borders */
-    context.getSfmlWindow().draw(left);
-    context.getSfmlWindow().draw(top);
-    context.getSfmlWindow().draw(right);
-    context.getSfmlWindow().draw(bottom);
+    context.getRenderTarget().draw(left);
+    context.getRenderTarget().draw(top);
+    context.getRenderTarget().draw(right);
+    context.getRenderTarget().draw(bottom);
 }
 
 /**
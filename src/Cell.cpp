@@ -65,12 +65,17 @@ Cell::Cell(
 ) :
     type(cellType),
     impl(
-        std::make_unique<Impl>(
-            hPosition,
-            vPosition
-        )
+        hPosition,
+        vPosition
     )
 {
+    /* Impl is two floats, 8 bytes on every platform, so its storage has no
+       headroom */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The Cell implementation does not fit its storage"
+    );
+
     setPosition(
         hPosition,
         vPosition
@@ -82,11 +87,7 @@ Cell::Cell(
 /**
  *
  */
-Cell::Cell(const Cell& cell)
-{
-    setType(cell.getType());
-    setIsVisible(cell.isVisible());
-}
+Cell::Cell(const Cell& cell) = default;
 
 /**
  *
@@ -205,11 +206,11 @@ void Cell::display(
        by the given unique pointer reference */
     if (transform != nullptr)
     {
-        context.getSfmlWindow().draw(sprite, *transform);
+        context.getRenderTarget().draw(sprite, *transform);
     }
     else
     {
-        context.getSfmlWindow().draw(sprite);
+        context.getRenderTarget().draw(sprite);
     }
 }
 
@@ -221,20 +222,20 @@ void Cell::displayWithMouseHover(
     aliases::ConstTransformUniquePtrRef transform
 )
 {
-    if (isMouseHover() && !highlight)
+    if (isMouseHover(context) && !highlight)
     {
         highlight = true;
 
         sprite.setColor(context.getColorsManager().getColorDarkGrey());
     }
-    else if(!isMouseHover() && highlight)
+    else if(!isMouseHover(context) && highlight)
     {
         highlight = false;
 
         sprite.setColor(context.getColorsManager().getColorWhite());
     }
 
-    context.getSfmlWindow().draw(sprite);
+    context.getRenderTarget().draw(sprite);
 }
 
 /**
@@ -308,6 +309,14 @@ void Cell::setCellColor(const sf::Color& color)
     sprite.setColor(color);
 }
 
+/**
+ *
+ */
+const sf::Color& Cell::getCellColor() const &
+{
+    return sprite.getColor();
+}
+
 /**
  *
  */
@@ -336,10 +345,10 @@ void Cell::setIsVisible(const bool& visibility) & noexcept
 /**
  *
  */
-const bool Cell::isMouseHover() const
+const bool Cell::isMouseHover(const utils::Context& context) const
 {
     /* get the position of the cursor */
-    sf::Vector2<int> cursorPosition = sf::Mouse::getPosition();
+    const sf::Vector2f cursorPosition = context.getMousePosition();
 
     if (
         cursorPosition.x > horizontalPosition &&
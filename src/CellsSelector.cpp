@@ -228,7 +228,7 @@ void CellsSelector::display(const utils::Context& context) &
     impl->diagonalCell.displayWithMouseHover(context);
     impl->quarterRotationCell.displayWithMouseHover(context);
 
-    context.getSfmlWindow().draw(impl->selectedCellImage);
+    context.getRenderTarget().draw(impl->selectedCellImage);
 }
 
 /**
@@ -236,7 +236,7 @@ void CellsSelector::display(const utils::Context& context) &
  */
 void CellsSelector::selectCell(const utils::Context& context) &
 {
-    if (impl->emptyCell.isMouseHover())
+    if (impl->emptyCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -246,7 +246,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::EMPTY_CELL;
     }
-    else if (impl->departureCell.isMouseHover())
+    else if (impl->departureCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -256,7 +256,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::DEPARTURE_CELL;
     }
-    else if (impl->arrivalCell.isMouseHover())
+    else if (impl->arrivalCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -266,7 +266,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::ARRIVAL_CELL;
     }
-    else if (impl->starCell.isMouseHover())
+    else if (impl->starCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -276,7 +276,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::STAR_CELL;
     }
-    else if (impl->moreLifeCell.isMouseHover())
+    else if (impl->moreLifeCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -286,7 +286,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::MORE_LIFE_CELL;
     }
-    else if (impl->lessLifeCell.isMouseHover())
+    else if (impl->lessLifeCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -296,7 +296,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::LESS_LIFE_CELL;
     }
-    else if (impl->moreTimeCell.isMouseHover())
+    else if (impl->moreTimeCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -306,7 +306,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::MORE_TIME_CELL;
     }
-    else if (impl->lessTimeCell.isMouseHover())
+    else if (impl->lessTimeCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -316,7 +316,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::LESS_TIME_CELL;
     }
-    else if (impl->wallCell.isMouseHover())
+    else if (impl->wallCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -326,7 +326,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::WALL_CELL;
     }
-    else if (impl->stairsUpCell.isMouseHover())
+    else if (impl->stairsUpCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -336,7 +336,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::STAIRS_UP_CELL;
     }
-    else if (impl->stairsDownCell.isMouseHover())
+    else if (impl->stairsDownCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -346,7 +346,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::STAIRS_DOWN_CELL;
     }
-    else if (impl->horizontalMirrorCell.isMouseHover())
+    else if (impl->horizontalMirrorCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -356,7 +356,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::HORIZONTAL_MIRROR_CELL;
     }
-    else if (impl->verticalMirrorCell.isMouseHover())
+    else if (impl->verticalMirrorCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -366,7 +366,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::VERTICAL_MIRROR_CELL;
     }
-    else if (impl->leftRotationCell.isMouseHover())
+    else if (impl->leftRotationCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -376,7 +376,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::LEFT_ROTATION_CELL;
     }
-    else if (impl->rightRotationCell.isMouseHover())
+    else if (impl->rightRotationCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -386,7 +386,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::RIGHT_ROTATION_CELL;
     }
-    else if (impl->elevatorUpCell.isMouseHover())
+    else if (impl->elevatorUpCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -396,7 +396,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::ELEVATOR_UP_CELL;
     }
-    else if (impl->elevatorDownCell.isMouseHover())
+    else if (impl->elevatorDownCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -406,7 +406,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::ELEVATOR_DOWN_CELL;
     }
-    else if (impl->diagonalCell.isMouseHover())
+    else if (impl->diagonalCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -416,7 +416,7 @@ void CellsSelector::selectCell(const utils::Context& context) &
 
         impl->selectedCellType = cells::DIAGONAL_CELL;
     }
-    else if (impl->quarterRotationCell.isMouseHover())
+    else if (impl->quarterRotationCell.isMouseHover(context))
     {
         impl->selectedCellImage.setTexture(
             context.getCellsTexturesManager().getTextureReferenceByCellType(
@@ -32,10 +32,21 @@
 #include "ShapesManager.hpp"
 #include "PlayingSerieManager.hpp"
 #include "EditingLevelManager.hpp"
+#include "LeaderboardManager.hpp"
+#include "LevelTemplatesManager.hpp"
 #include "window.hpp"
 #include "Game.hpp"
+#include "AsyncFileWriter.hpp"
+#include "ThumbnailsGenerator.hpp"
+#include "InputActionsQueue.hpp"
+#include "ResourcesRegistry.hpp"
+#include "AssetPack.hpp"
+#include "LeaderboardClient.hpp"
+#include "FramePresenter.hpp"
+#include "GameClock.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Window/Mouse.hpp>
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 
@@ -49,14 +60,27 @@ class Context::Impl
 
 public:
 
-    managers::TexturesManager texturesManager;
-    managers::SoundsManager soundsManager;
+    /* declared first: the assets are read from the pack by the managers and
+       by the music during the whole execution */
+    AssetPack assetPack {"res/resources.pack"};
+
+    /* the textures and sounds managers only keep handles to the resources of
+       the registry */
+    managers::ResourcesRegistry resourcesRegistry {
+        "res/resources.manifest",
+        assetPack
+    };
+
+    managers::TexturesManager texturesManager {resourcesRegistry};
+    managers::SoundsManager soundsManager {resourcesRegistry};
     managers::ColorsManager colorsManager;
-    managers::FontsManager fontsManager;
-    managers::CellsTexturesManager cellsTexturesManager;
+    managers::FontsManager fontsManager {assetPack};
+    managers::CellsTexturesManager cellsTexturesManager {resourcesRegistry};
     managers::ShapesManager shapesManager;
     managers::PlayingSerieManager playingSerieManager;
     managers::EditingLevelManager editingLevelManager;
+    managers::LeaderboardManager leaderboardManager;
+    managers::LevelTemplatesManager levelTemplatesManager;
 
     sf::RenderWindow sfmlWindow =
     {
@@ -69,21 +93,41 @@ public:
         sf::Style::Fullscreen
     };
 
+    /* declared after the window, so destroyed before it */
+    FramePresenter framePresenter {sfmlWindow};
+
     sf::Music music;
 
-    /* unique SFML clock for time management in every controller
+    /* unique clock for time management in every controller, split into
+     * timelines (animations, levels timers)
      *
-     * NOTE: we use an unique clock for all the animation and time
-     * management of the game; the clock is restarted everytime the
-     * controller is modified; the maximum time returned in milliseconds
-     * is equal to 49 days... so this is a safe method */
-    sf::Clock clock;
+     * NOTE: the timelines are restarted everytime the controller is
+     * modified; the maximum time returned in milliseconds is equal to 49
+     * days... so this is a safe method */
+    GameClock clock;
 
     /* we could use a pointer to dynamically creates the game object only
        when it is really necessary during the program execution; in order to
        avoid multiple tests on existing pointers, we just create a permanent
        game object */
     entities::Game game;
+
+    /* the results are uploaded from a separated thread, the connection to
+       the leaderboard service is only opened when a result is uploaded */
+    network::LeaderboardClient leaderboardClient;
+
+    /* the thumbnails are generated by worker threads, the lists never wait
+       for them */
+    ThumbnailsGenerator thumbnailsGenerator;
+
+    InputActionsQueue inputActionsQueue;
+
+    /* the files written by the game (snapshots...) are written on a separated
+       thread in order to never block the rendering; declared last, so this is
+       the first destroyed attribute: all the pending files are written before
+       the other attributes are destroyed; only the main thread adds files,
+       none of the other workers use the writer */
+    AsyncFileWriter asyncFileWriter;
 };
 
 /**
@@ -103,6 +147,15 @@ Context::Context() : impl(std::make_unique<Impl>())
  */
 Context::~Context() = default;
 
+/**
+ *
+ */
+const managers::ResourcesRegistry& Context::getResourcesRegistry() const &
+noexcept
+{
+    return impl->resourcesRegistry;
+}
+
 /**
  *
  */
@@ -170,6 +223,24 @@ noexcept
     return impl->editingLevelManager;
 }
 
+/**
+ *
+ */
+managers::LeaderboardManager& Context::getLeaderboardManager() const &
+noexcept
+{
+    return impl->leaderboardManager;
+}
+
+/**
+ *
+ */
+const managers::LevelTemplatesManager& Context::getLevelTemplatesManager()
+const & noexcept
+{
+    return impl->levelTemplatesManager;
+}
+
 /**
  *
  */
@@ -178,12 +249,56 @@ sf::RenderWindow& Context::getSfmlWindow() const & noexcept
     return impl->sfmlWindow;
 }
 
+/**
+ *
+ */
+sf::RenderTarget& Context::getRenderTarget() const & noexcept
+{
+    return impl->framePresenter.getRenderTarget();
+}
+
+/**
+ *
+ */
+void Context::display() const &
+{
+    impl->framePresenter.display();
+}
+
+/**
+ *
+ */
+void Context::closeWindow() const &
+{
+    impl->framePresenter.stop();
+
+    impl->sfmlWindow.close();
+}
+
+/**
+ *
+ */
+const sf::Vector2f Context::getMousePosition() const &
+{
+    const auto& sfmlWindow = impl->sfmlWindow;
+
+    return sfmlWindow.mapPixelToCoords(sf::Mouse::getPosition(sfmlWindow));
+}
+
 /**
  *
  */
 const sf::Int32 Context::getClockMillisecondsTime() const &
 {
-    return impl->clock.getElapsedTime().asMilliseconds();
+    return impl->clock.getMilliseconds(GameClock::Timeline::ANIMATION);
+}
+
+/**
+ *
+ */
+const GameClock& Context::getGameClock() const & noexcept
+{
+    return impl->clock;
 }
 
 /**
@@ -198,7 +313,13 @@ void Context::loadMusicFile(const std::string& path) const &
 
     stopMusic();
 
-    if(impl->music.openFromFile(path))
+    const AssetView asset = impl->assetPack.getAsset(path);
+
+    const bool opened = asset.data != nullptr ?
+        impl->music.openFromMemory(asset.data, asset.size) :
+        impl->music.openFromFile(path);
+
+    if(opened)
     {
         impl->music.play();
         impl->music.setLoop(true);
@@ -232,5 +353,38 @@ const entities::Game& Context::getGame() const & noexcept
     return impl->game;
 }
 
+/**
+ *
+ */
+const AsyncFileWriter& Context::getAsyncFileWriter() const & noexcept
+{
+    return impl->asyncFileWriter;
+}
+
+/**
+ *
+ */
+const network::LeaderboardClient& Context::getLeaderboardClient() const &
+noexcept
+{
+    return impl->leaderboardClient;
+}
+
+/**
+ *
+ */
+const ThumbnailsGenerator& Context::getThumbnailsGenerator() const & noexcept
+{
+    return impl->thumbnailsGenerator;
+}
+
+/**
+ *
+ */
+const InputActionsQueue& Context::getInputActionsQueue() const & noexcept
+{
+    return impl->inputActionsQueue;
+}
+
 }
 }
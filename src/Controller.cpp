@@ -27,9 +27,12 @@
 #include "window.hpp"
 #include "ColorsManager.hpp"
 #include "Context.hpp"
+#include "latency.hpp"
+#include "GameClock.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/System/Sleep.hpp>
 
 namespace memoris
 {
@@ -37,6 +40,26 @@ namespace memoris
 namespace controllers
 {
 
+namespace
+{
+
+/**
+ * @brief returns the time of the real timeline; the idle delays are measured
+ * with it, so they still elapse when the animations are paused
+ *
+ * @param context constant reference to the current context to use
+ *
+ * @return const sf::Int32
+ */
+const sf::Int32 getRealTime(const utils::Context& context)
+{
+    return context.getGameClock().getMilliseconds(
+        utils::GameClock::Timeline::REAL
+    );
+}
+
+}
+
 class Controller::Impl
 {
 
@@ -57,6 +80,9 @@ public:
         transitionSurface.setFillColor(transitionSurfaceColor);
     }
 
+    /* declared first, so destroyed last */
+    allocators::MonotonicArena arena;
+
     sf::Int32 lastScreenTransitionTime {0};
 
     sf::Uint8 transitionStep {5};
@@ -65,7 +91,15 @@ public:
 
     sf::RectangleShape transitionSurface;
 
+    /* time of the last received event or of the last transition step */
+    sf::Int32 lastActivityTime {0};
+
+    /* the event received during the idle wait, not handled yet */
+    sf::Event pendingEvent;
+
     bool openingScreen {true};
+
+    bool hasPendingEvent {false};
 };
 
 /**
@@ -81,6 +115,113 @@ Controller::Controller(const utils::Context& context) :
  */
 Controller::~Controller() noexcept = default;
 
+/**
+ *
+ */
+allocators::MonotonicArena& Controller::getArena() const & noexcept
+{
+    return impl->arena;
+}
+
+/**
+ *
+ */
+const bool Controller::isIdle(const utils::Context& context) const &
+{
+    return
+        !expectedControllerId &&
+        !impl->openingScreen &&
+        !impl->hasPendingEvent &&
+        getRealTime(context) - impl->lastActivityTime >
+            IDLE_DELAY &&
+        getStaticDuration(context) != ANIMATED_SCREEN;
+}
+
+/**
+ *
+ */
+void Controller::waitForUpdate(const utils::Context& context) &
+{
+    auto& window = context.getSfmlWindow();
+
+    const sf::Int32 duration = getStaticDuration(context);
+
+    if (duration == STATIC_SCREEN)
+    {
+        impl->hasPendingEvent = window.waitEvent(impl->pendingEvent);
+
+        return;
+    }
+
+    const sf::Int32 endTime = getRealTime(context) + duration;
+
+    while (!window.pollEvent(impl->pendingEvent))
+    {
+        const sf::Int32 remainingTime =
+            endTime - getRealTime(context);
+
+        if (remainingTime <= 0)
+        {
+            return;
+        }
+
+        /* not std::min(): it takes references, the static constant would
+           have to be defined out of the class */
+        sf::sleep(
+            sf::milliseconds(
+                remainingTime < EVENTS_POLLING_INTERVAL ?
+                    remainingTime : EVENTS_POLLING_INTERVAL
+            )
+        );
+    }
+
+    impl->hasPendingEvent = true;
+}
+
+/**
+ *
+ */
+const bool Controller::pollEvent(const utils::Context& context) &
+{
+    if (impl->hasPendingEvent)
+    {
+        event = impl->pendingEvent;
+
+        impl->hasPendingEvent = false;
+    }
+    else if (
+        !context.getSfmlWindow().pollEvent(event) &&
+        !latency::pollInjectedEvent(event)
+    )
+    {
+        return false;
+    }
+
+    /* the level timers and the animations do not run when the player is
+       not in front of the game */
+    if (
+        event.type == sf::Event::LostFocus ||
+        event.type == sf::Event::GainedFocus
+    )
+    {
+        context.getGameClock().setFocused(
+            event.type == sf::Event::GainedFocus
+        );
+    }
+
+    impl->lastActivityTime = getRealTime(context);
+
+    return true;
+}
+
+/**
+ *
+ */
+const sf::Int32 Controller::getStaticDuration(const utils::Context&) const &
+{
+    return ANIMATED_SCREEN;
+}
+
 /**
  *
  */
@@ -96,7 +237,7 @@ const unsigned short Controller::animateScreenTransition(
     impl->transitionSurfaceColor.a = impl->transitionStep * COLOR_UPDATE_STEP;
     impl->transitionSurface.setFillColor(impl->transitionSurfaceColor);
 
-    context.getSfmlWindow().draw(impl->transitionSurface);
+    context.getRenderTarget().draw(impl->transitionSurface);
 
     if (
         context.getClockMillisecondsTime() -
@@ -115,6 +256,8 @@ const unsigned short Controller::animateScreenTransition(
         impl->lastScreenTransitionTime = context.getClockMillisecondsTime();
     }
 
+    impl->lastActivityTime = getRealTime(context);
+
     if (impl->transitionStep > TRANSITION_STEPS_MAX)
     {
         return expectedControllerId;
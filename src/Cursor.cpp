@@ -27,7 +27,6 @@
 #include "TexturesManager.hpp"
 #include "Context.hpp"
 
-#include <SFML/Window/Mouse.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
@@ -60,7 +59,7 @@ Cursor::Cursor(const utils::Context& context) :
     /* we force the position of the cursor surface during the initialization;
        the surface is visually directly at the same position as the real
        cursor one */
-    updateCursorPosition();
+    updateCursorPosition(context);
 }
 
 /**
@@ -75,7 +74,7 @@ void Cursor::render(const utils::Context& context)
 {
     auto& sprite = impl->sprite;
 
-    context.getSfmlWindow().draw(sprite);
+    context.getRenderTarget().draw(sprite);
 
     const auto& currentTime = context.getClockMillisecondsTime();
     auto& lastCursorPositionUpdateTime = impl->lastCursorPositionUpdateTime;
@@ -85,7 +84,7 @@ void Cursor::render(const utils::Context& context)
         return;
     }
 
-    updateCursorPosition();
+    updateCursorPosition(context);
 
     lastCursorPositionUpdateTime = currentTime;
 }
@@ -93,12 +92,9 @@ void Cursor::render(const utils::Context& context)
 /**
  *
  */
-void Cursor::updateCursorPosition() const &
+void Cursor::updateCursorPosition(const utils::Context& context) const &
 {
-    impl->sprite.setPosition(
-        sf::Mouse::getPosition().x,
-        sf::Mouse::getPosition().y
-    );
+    impl->sprite.setPosition(context.getMousePosition());
 }
 
 }
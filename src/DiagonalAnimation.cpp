@@ -154,10 +154,10 @@ void DiagonalAnimation::displayLevelAndSeparator(
         &entities::Cell::display
     );
 
-    context.getSfmlWindow().draw(
+    context.getRenderTarget().draw(
         context.getShapesManager().getHorizontalSeparator()
     );
-    context.getSfmlWindow().draw(
+    context.getRenderTarget().draw(
         context.getShapesManager().getVerticalSeparator()
     );
 }
@@ -208,7 +208,7 @@ void DiagonalAnimation::applyPurpleColorOnCellsQuarters(
             )
         )
         {
-            level->getCells()[index]->setCellColor(color);
+            level->getCell(index).setCellColor(color);
         }
     }
 }
@@ -283,20 +283,20 @@ void DiagonalAnimation::invertCells(
     const short& difference
 ) &
 {
-    char type = level->getCells()[source + difference]->getType();
-    bool visible = level->getCells()[source + difference]->isVisible();
+    char type = level->getCell(source + difference).getType();
+    bool visible = level->getCell(source + difference).isVisible();
 
-    level->getCells()[source + difference]->setType(
-        level->getCells()[source]->getType()
+    level->getCell(source + difference).setType(
+        level->getCell(source).getType()
     );
 
-    level->getCells()[source]->setType(type);
+    level->getCell(source).setType(type);
 
     showOrHideCell(
         context,
         level,
         source + difference,
-        level->getCells()[source]->isVisible()
+        level->getCell(source).isVisible()
     );
 
     showOrHideCell(
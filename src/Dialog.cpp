@@ -187,17 +187,17 @@ void Dialog::displayParentContent(
     const utils::Context& context
 ) const &
 {
-    context.getSfmlWindow().draw(impl->background);
+    context.getRenderTarget().draw(impl->background);
 
-    context.getSfmlWindow().draw(impl->titleBackground);
-    context.getSfmlWindow().draw(impl->titleSeparator);
+    context.getRenderTarget().draw(impl->titleBackground);
+    context.getRenderTarget().draw(impl->titleSeparator);
 
-    context.getSfmlWindow().draw(impl->top);
-    context.getSfmlWindow().draw(impl->bottom);
-    context.getSfmlWindow().draw(impl->left);
-    context.getSfmlWindow().draw(impl->right);
+    context.getRenderTarget().draw(impl->top);
+    context.getRenderTarget().draw(impl->bottom);
+    context.getRenderTarget().draw(impl->left);
+    context.getRenderTarget().draw(impl->right);
 
-    context.getSfmlWindow().draw(impl->title);
+    context.getRenderTarget().draw(impl->title);
 }
 
 }
@@ -33,6 +33,7 @@ namespace widgets
 {
 
 constexpr char DoubleSelectionListWidget::PERSONAL_LEVELS_PATH[];
+constexpr char DoubleSelectionListWidget::LEVELS_EXTENSION[];
 
 class DoubleSelectionListWidget::Impl
 {
@@ -49,6 +50,18 @@ public:
             890.f
         )
     {
+        const std::string levelsDirectory =
+            std::string(PERSONAL_LEVELS_PATH) + "/";
+
+        allLevelsList.setThumbnailsFiles(
+            levelsDirectory,
+            LEVELS_EXTENSION
+        );
+        serieLevelsList.setThumbnailsFiles(
+            levelsDirectory,
+            LEVELS_EXTENSION
+        );
+
         /* this class is generic for any kind of double selection list,
            for organization purposes, we just load the lists content here */
         allLevelsList.setList(
@@ -67,8 +80,14 @@ public:
 DoubleSelectionListWidget::DoubleSelectionListWidget(
     const utils::Context& context
 ) :
-    impl(std::make_unique<Impl>(context))
+    impl(context)
 {
+    /* Impl is two selection lists, whose size is their own storage, so this
+       storage is exactly twice the one of SelectionListWidget.hpp */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The DoubleSelectionListWidget implementation does not fit its storage"
+    );
 }
 
 /**
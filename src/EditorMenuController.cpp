@@ -66,28 +66,22 @@ EditorMenuController::EditorMenuController(const utils::Context& context) :
     AbstractMenuController(context),
     impl(std::make_unique<Impl>(context))
 {
-    std::unique_ptr<items::MenuItem> level(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Level",
-            200.f
-        )
+    auto level = getArena().create<items::MenuItem>(
+        context,
+        "Level",
+        200.f
     );
 
-    std::unique_ptr<items::MenuItem> serie(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Serie",
-            350.f
-        )
+    auto serie = getArena().create<items::MenuItem>(
+        context,
+        "Serie",
+        350.f
     );
 
-    std::unique_ptr<items::MenuItem> back(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Back",
-            800.f
-        )
+    auto back = getArena().create<items::MenuItem>(
+        context,
+        "Back",
+        800.f
     );
 
     level->select(context);
@@ -107,13 +101,13 @@ EditorMenuController::~EditorMenuController() noexcept = default;
  */
 const unsigned short& EditorMenuController::render(const utils::Context& context) &
 {
-    context.getSfmlWindow().draw(impl->title);
+    context.getRenderTarget().draw(impl->title);
 
     renderAllMenuItems(context);
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -92,11 +92,11 @@ ErrorController::~ErrorController() noexcept = default;
  */
 const unsigned short& ErrorController::render(const utils::Context& context) &
 {
-    context.getSfmlWindow().draw(impl->text);
+    context.getRenderTarget().draw(impl->text);
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -130,5 +130,15 @@ const unsigned short& ErrorController::render(const utils::Context& context) &
     return nextControllerId;
 }
 
+/**
+ *
+ */
+const sf::Int32 ErrorController::getStaticDuration(
+    const utils::Context&
+) const &
+{
+    return STATIC_SCREEN;
+}
+
 }
 }
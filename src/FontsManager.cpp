@@ -25,6 +25,8 @@
 
 #include "FontsManager.hpp"
 
+#include "AssetPack.hpp"
+
 #include <SFML/Graphics/Font.hpp>
 
 namespace memoris
@@ -45,11 +47,11 @@ public:
 /**
  *
  */
-FontsManager::FontsManager() :
+FontsManager::FontsManager(const utils::AssetPack& pack) :
     impl(std::make_unique<Impl>())
 {
-    loadFontFromFile(impl->titleFont, "crystal_regular.ttf");
-    loadFontFromFile(impl->textFont, "hi.otf");
+    loadFont(pack, impl->titleFont, "crystal_regular.ttf");
+    loadFont(pack, impl->textFont, "hi.otf");
 }
 
 /**
@@ -76,12 +78,23 @@ const sf::Font& FontsManager::getTextFont() const & noexcept
 /**
  *
  */
-void FontsManager::loadFontFromFile(
+void FontsManager::loadFont(
+    const utils::AssetPack& pack,
     sf::Font& font,
     const std::string& path
 )
 {
-    if(!font.loadFromFile("res/fonts/" + path))
+    const std::string filePath = "res/fonts/" + path;
+
+    /* the font reads its data while it is used; the pack data stays valid
+       until the end of the program */
+    const utils::AssetView asset = pack.getAsset(filePath);
+
+    const bool loaded = asset.data != nullptr ?
+        font.loadFromMemory(asset.data, asset.size) :
+        font.loadFromFile(filePath);
+
+    if(!loaded)
     {
         throw std::invalid_argument("Cannot load font " + path);
     }
@@ -0,0 +1,325 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file FramePresenter.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "FramePresenter.hpp"
+
+#include "window.hpp"
+#include "latency.hpp"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/OpenGL.hpp>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace memoris
+{
+namespace utils
+{
+
+class FramePresenter::Impl
+{
+
+public:
+
+    Impl(sf::RenderWindow& renderWindow) :
+        window(renderWindow)
+    {
+    }
+
+    /**
+     * @brief presenting thread loop; waits for a new frame, draws it into the
+     * window and displays it; the display is executed without the lock, so
+     * the main thread can publish the next frame during the display
+     */
+    void run() noexcept
+    {
+        window.setActive(true);
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true)
+        {
+            condition.wait(
+                lock,
+                [this]()
+                {
+                    return stopped || newFrame;
+                }
+            );
+
+            if (stopped)
+            {
+                break;
+            }
+
+            newFrame = false;
+            presenting = true;
+
+            latency::framePresenting();
+
+            lock.unlock();
+
+            window.draw(windowSprite);
+
+            /* the front scene is read by the GPU before the main thread can
+               publish the next frame into it */
+            glFinish();
+
+            lock.lock();
+
+            presenting = false;
+
+            condition.notify_all();
+
+            lock.unlock();
+
+            window.display();
+
+            latency::framePresented();
+
+            lock.lock();
+        }
+
+        window.setActive(false);
+    }
+
+    /**
+     * @brief stops and joins the presenting thread
+     */
+    void stopThread() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+
+        condition.notify_all();
+        thread.join();
+    }
+
+    sf::RenderWindow& window;
+
+    /* drawn by the main thread only; not created if the frames are
+       directly drawn into the window */
+    sf::RenderTexture scene;
+
+    /* the last published frame, read by the presenting thread; only created
+       if the presenting thread is enabled */
+    sf::RenderTexture frontScene;
+
+    /* draws the front scene (presenting thread) or the scene (main thread)
+       on the whole window */
+    sf::Sprite windowSprite;
+
+    /* the window if the frames are directly drawn into it */
+    sf::RenderTarget* renderTarget {&window};
+
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    bool newFrame {false};
+    bool presenting {false};
+    bool stopped {false};
+
+    /* only started if the scenes have been created */
+    std::thread thread;
+};
+
+/**
+ *
+ */
+FramePresenter::FramePresenter(sf::RenderWindow& window) :
+    impl(std::make_unique<Impl>(window))
+{
+    /* nothing to upscale and no thread, the frames are directly drawn and
+       displayed into the window, without any copy */
+    if (window::RENDER_SCALE == 100 && !window::PRESENTING_THREAD)
+    {
+        return;
+    }
+
+    const unsigned int sceneWidth = window::WIDTH * window::RENDER_SCALE / 100;
+    const unsigned int sceneHeight =
+        window::HEIGHT * window::RENDER_SCALE / 100;
+
+    auto& scene = impl->scene;
+
+    /* the game is still playable without the scene, only slower, so the
+       frames are directly drawn into the window if it cannot be created */
+    if (!scene.create(sceneWidth, sceneHeight))
+    {
+        return;
+    }
+
+    /* the screens keep drawing with the design coordinates, the view
+       downscales them into the scene */
+    scene.setView(
+        sf::View(
+            sf::FloatRect(
+                0.f,
+                0.f,
+                window::WIDTH,
+                window::HEIGHT
+            )
+        )
+    );
+
+    /* without the presenting thread (or without the second scene), the main
+       thread upscales the scene itself to the window */
+    sf::RenderTexture* presentedScene = &scene;
+
+    auto& frontScene = impl->frontScene;
+
+    if (
+        window::PRESENTING_THREAD &&
+        frontScene.create(sceneWidth, sceneHeight)
+    )
+    {
+        presentedScene = &frontScene;
+    }
+
+    presentedScene->setSmooth(true);
+
+    auto& windowSprite = impl->windowSprite;
+    windowSprite.setTexture(presentedScene->getTexture());
+    windowSprite.setScale(
+        static_cast<float>(window::WIDTH) / sceneWidth,
+        static_cast<float>(window::HEIGHT) / sceneHeight
+    );
+
+    impl->renderTarget = &scene;
+
+    if (presentedScene == &scene)
+    {
+        return;
+    }
+
+    /* one OpenGL context can only be active into one thread */
+    window.setActive(false);
+
+    impl->thread = std::thread(&Impl::run, impl.get());
+}
+
+/**
+ *
+ */
+FramePresenter::~FramePresenter() noexcept
+{
+    if (impl->thread.joinable())
+    {
+        impl->stopThread();
+    }
+}
+
+/**
+ *
+ */
+sf::RenderTarget& FramePresenter::getRenderTarget() const & noexcept
+{
+    return *impl->renderTarget;
+}
+
+/**
+ *
+ */
+void FramePresenter::display() const &
+{
+    auto& window = impl->window;
+    auto& scene = impl->scene;
+
+    if (!impl->thread.joinable())
+    {
+        if (impl->renderTarget != &window)
+        {
+            scene.display();
+
+            window.draw(impl->windowSprite);
+        }
+
+        latency::framePublished();
+        latency::framePresenting();
+
+        window.display();
+
+        latency::framePresented();
+
+        return;
+    }
+
+    auto& frontScene = impl->frontScene;
+
+    scene.display();
+
+    {
+        std::unique_lock<std::mutex> lock(impl->mutex);
+
+        impl->condition.wait(
+            lock,
+            [this]()
+            {
+                return !impl->presenting;
+            }
+        );
+
+        /* the previous frame is replaced even if it has not been presented
+           yet: only the last frame is displayed */
+        frontScene.draw(sf::Sprite(scene.getTexture()));
+        frontScene.display();
+
+        /* the frame is completely written before the presenting thread reads
+           it from the window context */
+        glFinish();
+
+        impl->newFrame = true;
+
+        latency::framePublished();
+    }
+
+    impl->condition.notify_all();
+}
+
+/**
+ *
+ */
+void FramePresenter::stop() const &
+{
+    if (!impl->thread.joinable())
+    {
+        return;
+    }
+
+    impl->stopThread();
+
+    impl->window.setActive(true);
+
+    impl->renderTarget = &impl->window;
+}
+
+}
+}
@@ -25,8 +25,11 @@
 #include "Game.hpp"
 
 #include "files.hpp"
+#include "AsyncFileWriter.hpp"
 
 #include <string>
+#include <iterator>
+#include <stdexcept>
 
 namespace memoris
 {
@@ -47,21 +50,98 @@ Game::Game() :
 /**
  *
  */
-void Game::loadGameFromFile(const std::string& gameName) const & noexcept
+void Game::loadGameFromFile(const std::string& gameName) const &
 {
     impl->gameName = gameName;
+    impl->hasSnapshot = false;
+
+    std::ifstream file(
+        getFilePath(),
+        std::ios::binary
+    );
+
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    /* the whole file is read at once, the snapshot is small (less than four
+       kilobytes with a level section) */
+    const std::vector<char> bytes(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+
+    if (bytes.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        impl->snapshot = snapshots::deserialize(bytes);
+        impl->hasSnapshot = true;
+    }
+    catch(std::invalid_argument&)
+    {
+        /* a corrupted snapshot is ignored, the game is simply opened without
+           any in-progress serie */
+    }
 }
 
 /**
  *
  */
-void Game::deleteGameFile() const &
+void Game::saveSnapshot(
+    const utils::AsyncFileWriter& writer,
+    const snapshots::SerieSnapshot& snapshot
+) const &
+{
+    impl->snapshot = snapshot;
+    impl->hasSnapshot = true;
+
+    writer.write(
+        getFilePath(),
+        snapshots::serialize(snapshot)
+    );
+}
+
+/**
+ *
+ */
+void Game::clearSnapshot(const utils::AsyncFileWriter& writer) const &
 {
-    std::string filePath =
-        GAMES_FILES_DIRECTORY + impl->gameName + GAMES_FILES_EXTENSION;
+    impl->hasSnapshot = false;
 
+    writer.write(
+        getFilePath(),
+        std::vector<char>()
+    );
+}
+
+/**
+ *
+ */
+const bool& Game::hasSnapshot() const & noexcept
+{
+    return impl->hasSnapshot;
+}
+
+/**
+ *
+ */
+const snapshots::SerieSnapshot& Game::getSnapshot() const & noexcept
+{
+    return impl->snapshot;
+}
+
+/**
+ *
+ */
+void Game::deleteGameFile() const &
+{
     /* TODO: #931 check if the file deletion succeeds */
-    std::remove(filePath.c_str());
+    std::remove(getFilePath().c_str());
 }
 
 /**
@@ -69,11 +149,13 @@ void Game::deleteGameFile() const &
  */
 void Game::createFile() const &
 {
+    impl->hasSnapshot = false;
+
     std::ofstream file;
     utils::applyFailbitAndBadbitExceptions(file);
 
     file.open(
-        GAMES_FILES_DIRECTORY + impl->gameName + GAMES_FILES_EXTENSION,
+        getFilePath(),
         std::fstream::out
     );
 
@@ -88,5 +170,13 @@ const std::string& Game::getName() const & noexcept
     return impl->gameName;
 }
 
+/**
+ *
+ */
+const std::string Game::getFilePath() const &
+{
+    return GAMES_FILES_DIRECTORY + impl->gameName + GAMES_FILES_EXTENSION;
+}
+
 }
 }
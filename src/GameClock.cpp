@@ -0,0 +1,245 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file GameClock.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "GameClock.hpp"
+
+#include <SFML/System/Clock.hpp>
+
+#include <array>
+
+namespace memoris
+{
+namespace utils
+{
+
+namespace
+{
+
+constexpr size_t TIMELINES_AMOUNT {
+    static_cast<size_t>(GameClock::Timeline::TIMELINES_AMOUNT)
+};
+
+/**
+ * the state of one timeline; the elapsed time is only accumulated when the
+ * timeline state changes, so the real time is never added twice
+ */
+struct TimelineState
+{
+    sf::Int64 elapsed; /** < microseconds before the anchor */
+    sf::Int64 anchor; /** < source time of the last state change */
+    float scale;
+    unsigned short pausesAmount;
+};
+
+}
+
+class GameClock::Impl
+{
+
+public:
+
+    Impl() noexcept
+    {
+        timelines.fill({0, 0, 1.f, 0});
+    }
+
+    /**
+     * @brief indicates if the given timeline currently runs
+     *
+     * @param index the index of the timeline
+     *
+     * @return const bool
+     */
+    const bool isRunning(const size_t& index) const & noexcept
+    {
+        if (index == static_cast<size_t>(Timeline::REAL))
+        {
+            return true;
+        }
+
+        return focused && timelines[index].pausesAmount == 0;
+    }
+
+    /**
+     * @brief returns the elapsed microseconds of the given timeline at the
+     * given source time
+     *
+     * @param index the index of the timeline
+     * @param sourceTime the current time of the source clock
+     *
+     * @return const sf::Int64
+     */
+    const sf::Int64 getElapsed(
+        const size_t& index,
+        const sf::Int64& sourceTime
+    ) const & noexcept
+    {
+        const TimelineState& timeline = timelines[index];
+
+        if (!isRunning(index))
+        {
+            return timeline.elapsed;
+        }
+
+        const sf::Int64 delta = sourceTime - timeline.anchor;
+
+        /* the real speed is added without any conversion, so it is exact */
+        return timeline.elapsed + (
+            timeline.scale == 1.f ?
+                delta :
+                static_cast<sf::Int64>(delta * timeline.scale)
+        );
+    }
+
+    /**
+     * @brief accumulates the elapsed time of all the timelines, called before
+     * any state change
+     *
+     * not 'noexcept' because it calls SFML functions that are not noexcept
+     */
+    void accumulate() &
+    {
+        const sf::Int64 sourceTime = source.getElapsedTime().asMicroseconds();
+
+        for (size_t index {0}; index < TIMELINES_AMOUNT; index++)
+        {
+            TimelineState& timeline = timelines[index];
+            timeline.elapsed = getElapsed(index, sourceTime);
+            timeline.anchor = sourceTime;
+        }
+    }
+
+    /* never restarted, so it is monotonic */
+    sf::Clock source;
+
+    std::array<TimelineState, TIMELINES_AMOUNT> timelines;
+
+    bool focused {true};
+};
+
+/**
+ *
+ */
+GameClock::GameClock() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+GameClock::~GameClock() noexcept = default;
+
+/**
+ *
+ */
+const sf::Int32 GameClock::getMilliseconds(const Timeline& timeline) const &
+{
+    return static_cast<sf::Int32>(
+        impl->getElapsed(
+            static_cast<size_t>(timeline),
+            impl->source.getElapsedTime().asMicroseconds()
+        ) / 1000
+    );
+}
+
+/**
+ *
+ */
+void GameClock::pause(const Timeline& timeline) const &
+{
+    impl->accumulate();
+
+    impl->timelines[static_cast<size_t>(timeline)].pausesAmount++;
+}
+
+/**
+ *
+ */
+void GameClock::resume(const Timeline& timeline) const &
+{
+    auto& pausesAmount =
+        impl->timelines[static_cast<size_t>(timeline)].pausesAmount;
+
+    if (pausesAmount == 0)
+    {
+        return;
+    }
+
+    impl->accumulate();
+
+    pausesAmount--;
+}
+
+/**
+ *
+ */
+void GameClock::setScale(
+    const Timeline& timeline,
+    const float& scale
+) const &
+{
+    if (timeline == Timeline::REAL)
+    {
+        return;
+    }
+
+    impl->accumulate();
+
+    impl->timelines[static_cast<size_t>(timeline)].scale = scale;
+}
+
+/**
+ *
+ */
+void GameClock::setFocused(const bool& focused) const &
+{
+    if (impl->focused == focused)
+    {
+        return;
+    }
+
+    impl->accumulate();
+
+    impl->focused = focused;
+}
+
+/**
+ *
+ */
+void GameClock::restart() const &
+{
+    const sf::Int64 sourceTime =
+        impl->source.getElapsedTime().asMicroseconds();
+
+    for (TimelineState& timeline : impl->timelines)
+    {
+        timeline.elapsed = 0;
+        timeline.anchor = sourceTime;
+        timeline.pausesAmount = 0;
+    }
+}
+
+}
+}
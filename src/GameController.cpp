@@ -25,23 +25,31 @@
 #include "GameController.hpp"
 
 #include "cells.hpp"
+#include "Cell.hpp"
 #include "window.hpp"
 #include "fonts.hpp"
 #include "controllers.hpp"
-#include "animations.hpp"
 #include "PlayingSerieManager.hpp"
 #include "SoundsManager.hpp"
 #include "FontsManager.hpp"
 #include "ColorsManager.hpp"
 #include "GameDashboard.hpp"
 #include "TimerWidget.hpp"
+#include "NumericText.hpp"
 #include "WinLevelEndingScreen.hpp"
 #include "LoseLevelEndingScreen.hpp"
 #include "WatchingTimer.hpp"
 #include "PickUpEffectsManager.hpp"
+#include "LevelAnimationsPool.hpp"
+#include "LevelAnimation.hpp"
 #include "TexturesManager.hpp"
 #include "Level.hpp"
 #include "EditingLevelManager.hpp"
+#include "Game.hpp"
+#include "snapshots.hpp"
+#include "InputActionsQueue.hpp"
+#include "latency.hpp"
+#include "GameClock.hpp"
 
 namespace memoris
 {
@@ -74,7 +82,6 @@ public:
     sf::Uint32 playerCellAnimationTime {0};
     sf::Uint32 leftLevelsAmountLastAnimationTime {0};
     sf::Uint32 endPeriodStartTime {0};
-    sf::Uint32 lastWatchingTimeUpdate {0};
 
     unsigned short floor {0};
     unsigned short displayedWatchingTime {0};
@@ -82,6 +89,9 @@ public:
 
     bool watchingPeriod {true};
     bool playingPeriod {false};
+    /* the game timeline is paused during the level animations */
+    bool gameTimePaused {false};
+
     bool movePlayerToNextFloor {false};
     bool movePlayerToPreviousFloor {false};
     bool win {false};
@@ -92,10 +102,15 @@ public:
 
     sf::Int8 leftLevelsAmountDirection {-17};
 
-    sf::Int32 lastTimerUpdateTime {0};
+    /* game timeline times of the next seconds of the level timer and of
+       the watching timer */
+    sf::Int32 nextTimerTickTime {ONE_SECOND};
+    sf::Int32 nextWatchingTickTime {ONE_SECOND};
 
     std::unique_ptr<utils::LevelEndingScreen> endingScreen {nullptr};
-    std::unique_ptr<animations::LevelAnimation> animation {nullptr};
+
+    /* points to the playing animation of the animations pool */
+    animations::LevelAnimation* animation {nullptr};
 
     /* use a pointer here for two reasons: this is faster to copy from one
        method to another, especially after creation into controllers.cpp; we
@@ -110,7 +125,11 @@ public:
 
     utils::PickUpEffectsManager pickUpEffectsManager;
 
-    const sf::Text& timerText;
+    /* all the animations are created with the controller (when the level
+       starts), so finding an animated cell never allocates anything */
+    animations::LevelAnimationsPool animationsPool;
+
+    const widgets::NumericText& timerText;
 };
 
 /**
@@ -149,6 +168,10 @@ GameController::GameController(
         level->getSeconds()
     );
 
+    /* the movements pressed during the previous level are never executed
+       into the new one */
+    context.getInputActionsQueue().clear();
+
     if (not watchLevel)
     {
         level->hideAllCellsExceptDeparture(context);
@@ -188,15 +211,43 @@ const unsigned short& GameController::render(
     dashboard.display();
 
     auto& timerWidget = dashboard.getTimerWidget();
-    auto& lastTimerUpdateTime = impl->lastTimerUpdateTime;
 
-    if (
-        impl->playingPeriod and
-        (
-            context.getClockMillisecondsTime() -
-            lastTimerUpdateTime > ONE_SECOND
-        )
-    )
+    const auto& gameClock = context.getGameClock();
+
+    /* the player cannot move during the animations, so the level time is
+       not counted */
+    const bool animating =
+        impl->animation != nullptr ||
+        impl->level->getAnimateFloorTransition();
+
+    if (animating != impl->gameTimePaused)
+    {
+        if (animating)
+        {
+            gameClock.pause(utils::GameClock::Timeline::GAME);
+        }
+        else
+        {
+            gameClock.resume(utils::GameClock::Timeline::GAME);
+        }
+
+        impl->gameTimePaused = animating;
+    }
+
+    const sf::Int32 gameTime =
+        gameClock.getMilliseconds(utils::GameClock::Timeline::GAME);
+
+    auto& nextTimerTickTime = impl->nextTimerTickTime;
+
+    /* the next tick is exactly one second after the previous one, whatever
+       the frame that renders it, so the timer never drifts; the ticks only
+       start one second after the playing period started */
+    if (!impl->playingPeriod)
+    {
+        nextTimerTickTime = gameTime + ONE_SECOND;
+    }
+
+    while (impl->playingPeriod and gameTime >= nextTimerTickTime)
     {
         if (impl->watchLevel)
         {
@@ -205,10 +256,10 @@ const unsigned short& GameController::render(
 
         impl->playingTime++;
 
-        lastTimerUpdateTime = context.getClockMillisecondsTime();
+        nextTimerTickTime += ONE_SECOND;
     }
 
-    context.getSfmlWindow().draw(impl->timerText);
+    context.getRenderTarget().draw(impl->timerText);
 
     if (impl->level->getAnimateFloorTransition())
     {
@@ -241,7 +292,7 @@ const unsigned short& GameController::render(
                 impl->movePlayerToPreviousFloor = false;
             }
 
-            impl->animation.reset();
+            impl->animation = nullptr;
         }
     }
     else
@@ -293,11 +344,14 @@ const unsigned short& GameController::render(
         }
     }
 
-    if (
-        impl->watchingPeriod and
-        context.getClockMillisecondsTime() -
-        impl->lastWatchingTimeUpdate > 1000
-    )
+    auto& nextWatchingTickTime = impl->nextWatchingTickTime;
+
+    if (!impl->watchingPeriod)
+    {
+        nextWatchingTickTime = gameTime + ONE_SECOND;
+    }
+
+    while (impl->watchingPeriod and gameTime >= nextWatchingTickTime)
     {
         if (impl->displayedWatchingTime == 1)
         {
@@ -310,7 +364,7 @@ const unsigned short& GameController::render(
 
         impl->watchingTimer.updateDisplayedAmount(impl->displayedWatchingTime);
 
-        impl->lastWatchingTimeUpdate = context.getClockMillisecondsTime();
+        nextWatchingTickTime += ONE_SECOND;
     }
 
     impl->pickUpEffectsManager.renderAllEffects(context);
@@ -322,51 +376,34 @@ const unsigned short& GameController::render(
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    const auto& inputActionsQueue = context.getInputActionsQueue();
+
+    while(pollEvent(context))
     {
         switch(event.type)
         {
         case sf::Event::KeyPressed:
         {
-            switch(event.key.code)
-            {
-            case sf::Keyboard::Up:
-            {
-                handlePlayerMovement(
-                    context,
-                    -16
-                );
+            const auto action = inputActionsQueue.getAction(event.key.code);
 
-                break;
-            }
-            case sf::Keyboard::Down:
+            switch(action)
             {
-                handlePlayerMovement(
-                    context,
-                    16
-                );
-
-                break;
-            }
-            case sf::Keyboard::Left:
+            case utils::InputActionsQueue::Action::MOVE_UP:
+            case utils::InputActionsQueue::Action::MOVE_DOWN:
+            case utils::InputActionsQueue::Action::MOVE_LEFT:
+            case utils::InputActionsQueue::Action::MOVE_RIGHT:
             {
-                handlePlayerMovement(
-                    context,
-                    -1
+                /* the movements are not executed immediately: they are
+                   buffered and executed once the current animation is
+                   finished */
+                inputActionsQueue.push(
+                    action,
+                    context.getClockMillisecondsTime()
                 );
 
                 break;
             }
-            case sf::Keyboard::Right:
-            {
-                handlePlayerMovement(
-                    context,
-                    1
-                );
-
-                break;
-            }
-            case sf::Keyboard::Escape:
+            case utils::InputActionsQueue::Action::EXIT:
             {
                 if (context.getEditingLevelManager().getLevel() != nullptr)
                 {
@@ -375,12 +412,14 @@ const unsigned short& GameController::render(
                     break;
                 }
 
+                saveSnapshot(context);
+
                 expectedControllerId = MAIN_MENU_CONTROLLER_ID;
 
                 break;
             }
             /* TODO: #825 for cheating and dev purposes ;) */
-            case sf::Keyboard::P:
+            case utils::InputActionsQueue::Action::RESTART:
             {
                 expectedControllerId = controllers::GAME_CONTROLLER_ID;
 
@@ -399,9 +438,82 @@ const unsigned short& GameController::render(
         }
     }
 
+    executeQueuedMovements(context);
+
     return nextControllerId;
 }
 
+/**
+ *
+ */
+void GameController::executeQueuedMovements(const utils::Context& context)
+{
+    const auto& inputActionsQueue = context.getInputActionsQueue();
+
+    if (
+        !impl->playingPeriod ||
+        impl->endPeriodStartTime
+    )
+    {
+        inputActionsQueue.clear();
+
+        return;
+    }
+
+    /* one movement may start an animation or a floor transition, the next
+       movements stay into the queue until it is finished */
+    while (
+        impl->animation == nullptr &&
+        !impl->level->getAnimateFloorTransition() &&
+        !impl->endPeriodStartTime
+    )
+    {
+        switch(inputActionsQueue.pop(context.getClockMillisecondsTime()))
+        {
+        case utils::InputActionsQueue::Action::MOVE_UP:
+        {
+            handlePlayerMovement(
+                context,
+                -16
+            );
+
+            break;
+        }
+        case utils::InputActionsQueue::Action::MOVE_DOWN:
+        {
+            handlePlayerMovement(
+                context,
+                16
+            );
+
+            break;
+        }
+        case utils::InputActionsQueue::Action::MOVE_LEFT:
+        {
+            handlePlayerMovement(
+                context,
+                -1
+            );
+
+            break;
+        }
+        case utils::InputActionsQueue::Action::MOVE_RIGHT:
+        {
+            handlePlayerMovement(
+                context,
+                1
+            );
+
+            break;
+        }
+        default:
+        {
+            return;
+        }
+        }
+    }
+}
+
 /**
  *
  */
@@ -445,6 +557,8 @@ void GameController::handlePlayerMovement(
         movement
     );
 
+    latency::stateChanged();
+
     executePlayerCellAction(context);
 }
 
@@ -457,9 +571,9 @@ void GameController::executePlayerCellAction(
 {
     const char& newPlayerCellType = impl->level->getPlayerCellType();
 
-    switch(newPlayerCellType)
+    switch(cells::getCellTraits(newPlayerCellType).action)
     {
-    case cells::STAR_CELL:
+    case cells::CellAction::FIND_STAR:
     {
         context.getSoundsManager().playFoundStarSound();
 
@@ -473,7 +587,7 @@ void GameController::executePlayerCellAction(
 
         break;
     }
-    case cells::MORE_LIFE_CELL:
+    case cells::CellAction::MORE_LIFE:
     {
         context.getSoundsManager().playFoundLifeOrTimeSound();
 
@@ -481,7 +595,7 @@ void GameController::executePlayerCellAction(
 
         break;
     }
-    case cells::LESS_LIFE_CELL:
+    case cells::CellAction::LESS_LIFE:
     {
         context.getSoundsManager().playFoundDeadOrLessTimeSound();
 
@@ -497,7 +611,7 @@ void GameController::executePlayerCellAction(
 
         break;
     }
-    case cells::MORE_TIME_CELL:
+    case cells::CellAction::MORE_TIME:
     {
         context.getSoundsManager().playFoundLifeOrTimeSound();
 
@@ -505,7 +619,7 @@ void GameController::executePlayerCellAction(
 
         break;
     }
-    case cells::LESS_TIME_CELL:
+    case cells::CellAction::LESS_TIME:
     {
         context.getSoundsManager().playFoundDeadOrLessTimeSound();
 
@@ -517,46 +631,35 @@ void GameController::executePlayerCellAction(
 
         break;
     }
-    case cells::STAIRS_UP_CELL:
-    case cells::ELEVATOR_UP_CELL:
+    case cells::CellAction::FLOOR_UP:
     {
         if (impl->level->movePlayerToNextFloor(context))
         {
-            impl->animation = animations::getAnimationByCellType(
-                                  context,
-                                  newPlayerCellType
-                              );
+            impl->animation = impl->animationsPool.startAnimation(
+                context,
+                newPlayerCellType
+            );
 
             impl->movePlayerToNextFloor = true;
         }
 
         break;
     }
-    case cells::STAIRS_DOWN_CELL:
-    case cells::ELEVATOR_DOWN_CELL:
+    case cells::CellAction::FLOOR_DOWN:
     {
         if (impl->level->movePlayerToPreviousFloor(context))
         {
-            impl->animation = animations::getAnimationByCellType(
-                                  context,
-                                  newPlayerCellType
-                              );
+            impl->animation = impl->animationsPool.startAnimation(
+                context,
+                newPlayerCellType
+            );
 
             impl->movePlayerToPreviousFloor = true;
         }
 
         break;
     }
-    case cells::QUARTER_ROTATION_CELL:
-    {
-        impl->animation = animations::getAnimationByCellType(
-            context,
-            newPlayerCellType
-        );
-
-        break;
-    }
-    case cells::ARRIVAL_CELL:
+    case cells::CellAction::ARRIVE:
     {
         if (
             impl->dashboard.getFoundStarsAmount() ==
@@ -586,25 +689,27 @@ void GameController::executePlayerCellAction(
             }
             else
             {
+                context.getGame().clearSnapshot(context.getAsyncFileWriter());
+
                 expectedControllerId = controllers::WIN_SERIE_CONTROLLER_ID;
             }
         }
 
         break;
     }
-    case cells::HORIZONTAL_MIRROR_CELL:
-    case cells::VERTICAL_MIRROR_CELL:
-    case cells::DIAGONAL_CELL:
-    case cells::LEFT_ROTATION_CELL:
-    case cells::RIGHT_ROTATION_CELL:
+    case cells::CellAction::TRANSFORM_FLOOR:
     {
-        impl->animation = animations::getAnimationByCellType(
-                              context,
-                              newPlayerCellType
-                          );
+        impl->animation = impl->animationsPool.startAnimation(
+            context,
+            newPlayerCellType
+        );
 
         break;
     }
+    case cells::CellAction::NONE:
+    {
+        break;
+    }
     }
 }
 
@@ -615,14 +720,8 @@ void GameController::emptyPlayerCell(
     const utils::Context& context
 )
 {
-    const char& playerCellType = impl->level->getPlayerCellType();
-
     if (
-        playerCellType == cells::EMPTY_CELL ||
-        playerCellType == cells::DEPARTURE_CELL ||
-        playerCellType == cells::STAIRS_UP_CELL ||
-        playerCellType == cells::STAIRS_DOWN_CELL ||
-        playerCellType == cells::ARRIVAL_CELL
+        !cells::getCellTraits(impl->level->getPlayerCellType()).emptiedOnLeave
     )
     {
         return;
@@ -690,9 +789,22 @@ void GameController::endLevel(const utils::Context& context)
         serieManager.incrementLevelIndex();
         serieManager.setWatchingTime(dashboard.getWatchingTime());
         serieManager.setLifesAmount(dashboard.getLifes());
+
+        /* the serie is resumed from the next level */
+        context.getGame().saveSnapshot(
+            context.getAsyncFileWriter(),
+            serieManager.getSnapshot(false)
+        );
     }
     else
     {
+        /* the serie is lost, there is nothing to resume; a tested edited
+           level is not part of the game progress */
+        if (context.getEditingLevelManager().getLevel() == nullptr)
+        {
+            context.getGame().clearSnapshot(context.getAsyncFileWriter());
+        }
+
         context.stopMusic();
 
         context.getSoundsManager().playTimeOverSound();
@@ -706,5 +818,96 @@ void GameController::endLevel(const utils::Context& context)
     impl->endPeriodStartTime = context.getClockMillisecondsTime();
 }
 
+/**
+ *
+ */
+void GameController::resumeLevel(
+    const utils::Context& context,
+    const snapshots::LevelSnapshot& snapshot
+) &
+{
+    auto& level = impl->level;
+
+    /* the types are set first because the cells textures are selected
+       according to the types when the cells are shown */
+    level->setCellsFromCharactersList(snapshot.cells);
+    level->setCellsFromVisibilitiesList(
+        context,
+        snapshot.visibilities
+    );
+    level->setPlayerCellIndex(snapshot.playerIndex);
+
+    impl->watchingPeriod = false;
+    impl->playingPeriod = true;
+    impl->playingTime = snapshot.playingTime;
+
+    auto& dashboard = impl->dashboard;
+
+    for (
+        unsigned short star {0};
+        star < snapshot.foundStars;
+        star++
+    )
+    {
+        dashboard.incrementFoundStars();
+    }
+
+    impl->floor = level->getPlayerFloor();
+    dashboard.updateCurrentFloor(impl->floor);
+
+    auto& timerWidget = dashboard.getTimerWidget();
+    timerWidget.setMinutesAndSeconds(
+        snapshot.minutes,
+        snapshot.seconds
+    );
+    timerWidget.start();
+}
+
+/**
+ *
+ */
+void GameController::saveSnapshot(const utils::Context& context) const &
+{
+    /* the level is already finished, the snapshot has already been saved or
+       cleared by endLevel() */
+    if (impl->win || impl->endingScreen != nullptr)
+    {
+        return;
+    }
+
+    snapshots::SerieSnapshot snapshot =
+        context.getPlayingSerieManager().getSnapshot(true);
+
+    auto& level = impl->level;
+
+    if (
+        impl->playingPeriod &&
+        impl->animation == nullptr &&
+        !level->getAnimateFloorTransition()
+    )
+    {
+        const auto& dashboard = impl->dashboard;
+        const auto& timerWidget = dashboard.getTimerWidget();
+
+        snapshots::LevelSnapshot& levelSnapshot = snapshot.level;
+        levelSnapshot.cells = level->getCharactersList();
+        levelSnapshot.visibilities = level->getVisibilitiesList();
+        levelSnapshot.playerIndex = level->getPlayerCellIndex();
+        levelSnapshot.minutes = timerWidget.getMinutes();
+        levelSnapshot.seconds = timerWidget.getSeconds();
+        levelSnapshot.foundStars = dashboard.getFoundStarsAmount();
+        levelSnapshot.lifes = dashboard.getLifes();
+        levelSnapshot.watchingTime = dashboard.getWatchingTime();
+        levelSnapshot.playingTime = impl->playingTime;
+
+        snapshot.hasLevel = true;
+    }
+
+    context.getGame().saveSnapshot(
+        context.getAsyncFileWriter(),
+        snapshot
+    );
+}
+
 }
 }
@@ -32,8 +32,8 @@
 #include "TexturesManager.hpp"
 #include "LevelSeparators.hpp"
 #include "TimerWidget.hpp"
+#include "NumericText.hpp"
 
-#include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
@@ -42,47 +42,62 @@ namespace memoris
 namespace utils
 {
 
+namespace
+{
+
+/* the counters are right aligned, with three digits at most */
+constexpr const char* COUNTERS_DIGITS {"###"};
+
+}
+
 class GameDashboard::Impl
 {
 
 public:
 
     Impl(const utils::Context& context) :
-        window(context.getSfmlWindow()),
+        window(context.getRenderTarget()),
+        foundStarsAmount(
+            context.getFontsManager().getTextFont(),
+            fonts::TEXT_SIZE,
+            context.getColorsManager().getColorWhite(),
+            COUNTERS_DIGITS
+        ),
+        target(
+            context.getFontsManager().getTextFont(),
+            fonts::TEXT_SIZE,
+            context.getColorsManager().getColorWhite(),
+            COUNTERS_DIGITS
+        ),
+        floor(
+            context.getFontsManager().getTextFont(),
+            fonts::TEXT_SIZE,
+            context.getColorsManager().getColorWhite(),
+            COUNTERS_DIGITS
+        ),
+        lifesAmount(
+            context.getFontsManager().getTextFont(),
+            fonts::TEXT_SIZE,
+            context.getColorsManager().getColorWhite(),
+            COUNTERS_DIGITS
+        ),
+        time(
+            context.getFontsManager().getTextFont(),
+            fonts::TEXT_SIZE,
+            context.getColorsManager().getColorWhite(),
+            COUNTERS_DIGITS
+        ),
         separators(context),
         timer(context)
     {
-        foundStarsAmount.setString("0");
-        target.setString("0");
-        floor.setString("1");
-
-        const auto& white = context.getColorsManager().getColorWhite();
-        foundStarsAmount.setColor(white);
-        lifesAmount.setColor(white);
-        target.setColor(white);
-        time.setColor(white);
-        floor.setColor(white);
-
-        const auto& fontSize = fonts::TEXT_SIZE;
-        foundStarsAmount.setCharacterSize(fontSize);
-        lifesAmount.setCharacterSize(fontSize);
-        target.setCharacterSize(fontSize);
-        time.setCharacterSize(fontSize);
-        floor.setCharacterSize(fontSize);
-
-        const auto& font = context.getFontsManager().getTextFont();
-        foundStarsAmount.setFont(font);
-        lifesAmount.setFont(font);
-        target.setFont(font);
-        time.setFont(font);
-        floor.setFont(font);
+        floor.setNumber(0, 1);
 
         const auto& playingSerie = context.getPlayingSerieManager();
         watchingTime = playingSerie.getWatchingTime();
         lifes = playingSerie.getLifesAmount();
 
-        lifesAmount.setString(std::to_string(lifes));
-        time.setString(std::to_string(watchingTime));
+        lifesAmount.setNumber(0, lifes);
+        time.setNumber(0, watchingTime);
 
         const auto& texturesManager = context.getTexturesManager();
         spriteStar.setTexture(texturesManager.getStarTexture());
@@ -126,13 +141,13 @@ public:
         );
     }
 
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
 
-    sf::Text foundStarsAmount;
-    sf::Text target;
-    sf::Text floor;
-    sf::Text lifesAmount;
-    sf::Text time;
+    widgets::NumericText foundStarsAmount;
+    widgets::NumericText target;
+    widgets::NumericText floor;
+    widgets::NumericText lifesAmount;
+    widgets::NumericText time;
 
     sf::Sprite spriteStar;
     sf::Sprite spriteTarget;
@@ -158,8 +173,8 @@ GameDashboard::GameDashboard(const utils::Context& context) :
     /* we set the positions of the text surfaces in this class constructor
        and not in the implementation constructor; in fact, the method
        getHorizontalPositionLessWidth() is necessary for this horizontal
-       position calculation; this method is also necessary as a class method
-       in order to be used when the content of the surface changes */
+       position calculation; the counters have a fixed width, so they are
+       positioned only once */
 
     auto& foundStarsAmount = impl->foundStarsAmount;
     constexpr float FOUND_STARS_HORIZONTAL_POSITION {1230.f};
@@ -280,101 +295,80 @@ const unsigned short& GameDashboard::getFoundStarsAmount() const & noexcept
 /**
  *
  */
-void GameDashboard::incrementFoundStars() const &
+void GameDashboard::incrementFoundStars() const & noexcept
 {
     auto& foundStars = impl->foundStars;
     foundStars++;
 
     auto& foundStarsAmount = impl->foundStarsAmount;
-    updateSfmlTextByNumericValue(
-        foundStarsAmount,
-        foundStars
-    );
+    foundStarsAmount.setNumber(0, foundStars);
 }
 
 /**
  *
  */
-void GameDashboard::incrementLifes() const &
+void GameDashboard::incrementLifes() const & noexcept
 {
     auto& lifes = impl->lifes;
     lifes++;
 
     auto& lifesAmount = impl->lifesAmount;
-    updateSfmlTextByNumericValue(
-        lifesAmount,
-        lifes
-    );
+    lifesAmount.setNumber(0, lifes);
 }
 
 /**
  *
  */
-void GameDashboard::decrementLifes() const &
+void GameDashboard::decrementLifes() const & noexcept
 {
     auto& lifes = impl->lifes;
     lifes--;
 
     auto& lifesAmount = impl->lifesAmount;
-    updateSfmlTextByNumericValue(
-        lifesAmount,
-        lifes
-    );
+    lifesAmount.setNumber(0, lifes);
 }
 
 /**
  *
  */
-void GameDashboard::increaseWatchingTime() const &
+void GameDashboard::increaseWatchingTime() const & noexcept
 {
     auto& watchingTime = impl->watchingTime;
     watchingTime += WATCHING_TIME_UPDATE_STEP;
 
     auto& time = impl->time;
-    updateSfmlTextByNumericValue(
-        time,
-        watchingTime
-    );
+    time.setNumber(0, watchingTime);
 }
 
 /**
  *
  */
-void GameDashboard::decreaseWatchingTime() const &
+void GameDashboard::decreaseWatchingTime() const & noexcept
 {
     auto& watchingTime = impl->watchingTime;
     watchingTime -= WATCHING_TIME_UPDATE_STEP;
 
     auto& time = impl->time;
-    updateSfmlTextByNumericValue(
-        time,
-        watchingTime
-    );
+    time.setNumber(0, watchingTime);
 }
 
 /**
  *
  */
 void GameDashboard::updateTotalStarsAmountSurface(const unsigned short& amount)
-    const &
+    const & noexcept
 {
-    updateSfmlTextByNumericValue(
-        impl->target,
-        amount
-    );
+    impl->target.setNumber(0, amount);
 }
 
 /**
  *
  */
 void GameDashboard::updateCurrentFloor(const unsigned short& floorIndex)
-    const &
+    const & noexcept
 {
     constexpr unsigned short DISPLAYED_FLOOR_OFFSET {1};
-    updateSfmlTextByNumericValue(
-        impl->floor,
-        floorIndex + DISPLAYED_FLOOR_OFFSET
-    );
+    impl->floor.setNumber(0, floorIndex + DISPLAYED_FLOOR_OFFSET);
 }
 
 /**
@@ -390,21 +384,10 @@ widgets::TimerWidget& GameDashboard::getTimerWidget() const & noexcept
  */
 const float GameDashboard::getHorizontalPositionLessWidth(
     const float& rightSideHorizontalPosition,
-    const sf::Text& sfmlSurface
-) const &
-{
-    return rightSideHorizontalPosition - sfmlSurface.getLocalBounds().width;
-}
-
-/**
- *
- */
-void GameDashboard::updateSfmlTextByNumericValue(
-    sf::Text& sfmlText,
-    const unsigned short& numericValue
-) const &
+    const widgets::NumericText& sfmlSurface
+) const & noexcept
 {
-    sfmlText.setString(std::to_string(numericValue));
+    return rightSideHorizontalPosition - sfmlSurface.getWidth();
 }
 
 }
@@ -0,0 +1,93 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file Gradient.cpp
+ * @package others
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "Gradient.hpp"
+
+#include "Context.hpp"
+
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+
+namespace memoris
+{
+namespace others
+{
+
+class Gradient::Impl
+{
+
+public:
+
+    sf::VertexArray vertices {sf::TrianglesStrip};
+};
+
+/**
+ *
+ */
+Gradient::Gradient(
+    const sf::Color& color,
+    const GradientAxis& axis,
+    const float& crossPosition,
+    const float& crossSize,
+    std::initializer_list<GradientStop> stops
+) :
+    impl(std::make_unique<Impl>())
+{
+    sf::Color vertexColor = color;
+
+    /* two vertices per stop, one on each border of the surface; every new
+       pair of vertices closes the two triangles of one more band */
+    for (const GradientStop& stop : stops)
+    {
+        vertexColor.a = stop.alpha;
+
+        for (const float& border : {crossPosition, crossPosition + crossSize})
+        {
+            impl->vertices.append(
+                sf::Vertex(
+                    axis == GradientAxis::HORIZONTAL ?
+                        sf::Vector2f(stop.position, border) :
+                        sf::Vector2f(border, stop.position),
+                    vertexColor
+                )
+            );
+        }
+    }
+}
+
+/**
+ *
+ */
+Gradient::~Gradient() noexcept = default;
+
+/**
+ *
+ */
+void Gradient::render(const utils::Context& context) const &
+{
+    context.getRenderTarget().draw(impl->vertices);
+}
+
+}
+}
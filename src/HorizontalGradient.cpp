@@ -27,9 +27,7 @@
 #include "Context.hpp"
 #include "window.hpp"
 #include "ColorsManager.hpp"
-
-#include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include "Gradient.hpp"
 
 namespace memoris
 {
@@ -41,31 +39,37 @@ class HorizontalGradient::Impl
 
 public:
 
-    Impl(const utils::Context& context)
-    {
-        background.setSize(
-            sf::Vector2f(
-                window::WIDTH,
-                BACKGROUND_HEIGHT
-            )
-        );
-
-        background.setPosition(
+    Impl(const utils::Context& context) :
+        gradient(
+            context.getColorsManager().getColorBlack(),
+            GradientAxis::VERTICAL,
             0.f,
-            BACKGROUND_VERTICAL_POSITION
-        );
-
-        background.setFillColor(
-            context.getColorsManager().getColorBlack()
-        );
+            window::WIDTH,
+            {
+                {
+                    BACKGROUND_VERTICAL_POSITION - SIDE_HEIGHT,
+                    TRANSPARENT_ALPHA
+                },
+                {
+                    BACKGROUND_VERTICAL_POSITION,
+                    OPAQUE_ALPHA
+                },
+                {
+                    BACKGROUND_VERTICAL_POSITION + BACKGROUND_HEIGHT,
+                    OPAQUE_ALPHA
+                },
+                {
+                    BACKGROUND_VERTICAL_POSITION + BACKGROUND_HEIGHT +
+                        SIDE_HEIGHT,
+                    TRANSPARENT_ALPHA
+                }
+            }
+        )
+    {
     }
 
-    sf::RectangleShape background;
-
-    /* we use pointers in order to accelerate the execution (no object copy); 
-       we could have used move sementics, but SFML does not provides move 
-       constructors for rectangle shapes */
-    std::vector<std::unique_ptr<sf::RectangleShape>> sidesLines;
+    /* the background and its top and bottom sides are one surface */
+    Gradient gradient;
 };
 
 /**
@@ -74,7 +78,6 @@ public:
 HorizontalGradient::HorizontalGradient(const utils::Context& context) :
     impl(std::make_unique<Impl>(context))
 {
-    initializeGradientRectangles(context);
 }
 
 /**
@@ -87,71 +90,7 @@ HorizontalGradient::~HorizontalGradient() noexcept = default;
  */
 void HorizontalGradient::render(const utils::Context& context) const &
 {
-    context.getSfmlWindow().draw(impl->background);
-
-    // auto -> std::unique_ptr<sf::RectangleShape>&
-    for (auto& rectangle : impl->sidesLines)
-    {
-        context.getSfmlWindow().draw(*rectangle);
-    }
-}
-
-/**
- *
- */
-void HorizontalGradient::initializeGradientRectangles(
-    const utils::Context& context
-) const &
-{
-    float verticalPosition = BACKGROUND_VERTICAL_POSITION;
-    sf::Color effectColor = context.getColorsManager().getColorBlackCopy();
-
-    for (
-        unsigned short index = 0;
-        index < SURFACES_AMOUNT;
-        index++
-    )
-    {
-        // auto -> std::unique_ptr<sf::RectangleShape>
-        auto rectangle = std::make_unique<sf::RectangleShape>();
-
-        rectangle->setPosition(
-            0.f,
-            verticalPosition
-        );
-
-        rectangle->setSize(
-            sf::Vector2f(
-                window::WIDTH,
-                1.f
-            )
-        );
-
-        rectangle->setFillColor(effectColor);
-
-        if(index < SIDE_SURFACES_AMOUNT)
-        {
-            verticalPosition--;
-        }
-        else
-        {
-            verticalPosition++;
-        }
-
-        if (index == SIDE_SURFACES_AMOUNT)
-        {
-            verticalPosition = 
-                BACKGROUND_VERTICAL_POSITION + BACKGROUND_HEIGHT;
-            effectColor.a = DEFAULT_EFFECT_COLOR_ALPHA;
-        }
-
-        if (index % 2 == 0)
-        {
-            effectColor.a--;
-        }
-
-        impl->sidesLines.push_back(std::move(rectangle));
-    }
+    impl->gradient.render(context);
 }
 
 }
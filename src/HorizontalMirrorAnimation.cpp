@@ -166,26 +166,26 @@ void HorizontalMirrorAnimation::invertSides(
         index++
     )
     {
-        const char type = level->getCells()[index]->getType();
-        const bool visible = level->getCells()[index]->isVisible();
+        const char type = level->getCell(index).getType();
+        const bool visible = level->getCell(index).isVisible();
         const unsigned short invertedIndex =
             findInvertedIndex(
                 line,
                 index
             );
 
-        level->getCells()[index]->setType(
-            level->getCells()[invertedIndex]->getType()
+        level->getCell(index).setType(
+            level->getCell(invertedIndex).getType()
         );
 
         showOrHideCell(
             context,
             level,
             index,
-            level->getCells()[invertedIndex]->isVisible()
+            level->getCell(invertedIndex).isVisible()
         );
 
-        level->getCells()[invertedIndex]->setType(type);
+        level->getCell(invertedIndex).setType(type);
 
         showOrHideCell(
             context,
@@ -289,7 +289,7 @@ void HorizontalMirrorAnimation::displayLevelAndHorizontalSeparator(
         &entities::Cell::display
     );
 
-    context.getSfmlWindow().draw(
+    context.getRenderTarget().draw(
         context.getShapesManager().getHorizontalSeparator()
     );
 }
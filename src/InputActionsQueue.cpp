@@ -0,0 +1,227 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file InputActionsQueue.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "InputActionsQueue.hpp"
+
+#include "latency.hpp"
+
+#include <array>
+
+namespace memoris
+{
+namespace utils
+{
+
+constexpr unsigned short InputActionsQueue::MAXIMUM_BUFFERING_DEPTH;
+
+namespace
+{
+
+/**
+ * one buffered action, with the time of its key press
+ */
+struct TimedAction
+{
+    InputActionsQueue::Action action;
+    sf::Int32 time;
+};
+
+/**
+ * @brief returns the given buffering depth, at most the capacity of the ring
+ * buffer
+ *
+ * @param bufferingDepth the requested depth
+ *
+ * @return const unsigned short
+ */
+const unsigned short clampDepth(const unsigned short& bufferingDepth) noexcept
+{
+    return bufferingDepth < InputActionsQueue::MAXIMUM_BUFFERING_DEPTH ?
+        bufferingDepth : InputActionsQueue::MAXIMUM_BUFFERING_DEPTH;
+}
+
+}
+
+class InputActionsQueue::Impl
+{
+
+public:
+
+    Impl(
+        const unsigned short& depth,
+        const sf::Int32& delay
+    ) noexcept :
+        bufferingDepth(clampDepth(depth)),
+        expiry(delay)
+    {
+        bindings.fill(Action::NO_ACTION);
+    }
+
+    std::array<Action, sf::Keyboard::KeyCount> bindings;
+
+    /* ring buffer, the oldest action is at the first index and the
+       buffered actions follow it */
+    std::array<TimedAction, MAXIMUM_BUFFERING_DEPTH> actions;
+    unsigned short first {0};
+    unsigned short size {0};
+
+    unsigned short bufferingDepth;
+    sf::Int32 expiry;
+};
+
+/**
+ *
+ */
+InputActionsQueue::InputActionsQueue(
+    const unsigned short& bufferingDepth,
+    const sf::Int32& expiry
+) :
+    impl(std::make_unique<Impl>(bufferingDepth, expiry))
+{
+    bindKey(sf::Keyboard::Up, Action::MOVE_UP);
+    bindKey(sf::Keyboard::Down, Action::MOVE_DOWN);
+    bindKey(sf::Keyboard::Left, Action::MOVE_LEFT);
+    bindKey(sf::Keyboard::Right, Action::MOVE_RIGHT);
+    bindKey(sf::Keyboard::Escape, Action::EXIT);
+    bindKey(sf::Keyboard::P, Action::RESTART);
+}
+
+/**
+ *
+ */
+InputActionsQueue::~InputActionsQueue() noexcept = default;
+
+/**
+ *
+ */
+void InputActionsQueue::bindKey(
+    const sf::Keyboard::Key& key,
+    const Action& action
+) const & noexcept
+{
+    if (key < 0 || key >= sf::Keyboard::KeyCount)
+    {
+        return;
+    }
+
+    impl->bindings[key] = action;
+}
+
+/**
+ *
+ */
+const InputActionsQueue::Action InputActionsQueue::getAction(
+    const sf::Keyboard::Key& key
+) const & noexcept
+{
+    if (key < 0 || key >= sf::Keyboard::KeyCount)
+    {
+        return Action::NO_ACTION;
+    }
+
+    return impl->bindings[key];
+}
+
+/**
+ *
+ */
+void InputActionsQueue::setBuffering(
+    const unsigned short& bufferingDepth,
+    const sf::Int32& expiry
+) const & noexcept
+{
+    impl->bufferingDepth = clampDepth(bufferingDepth);
+    impl->expiry = expiry;
+
+    if (impl->size > impl->bufferingDepth)
+    {
+        impl->size = impl->bufferingDepth;
+    }
+}
+
+/**
+ *
+ */
+void InputActionsQueue::push(
+    const Action& action,
+    const sf::Int32& time
+) const & noexcept
+{
+    /* when the queue is full, the newest action is dropped: the player
+       expects the first pressed movements to be executed first */
+    if (
+        action == Action::NO_ACTION ||
+        impl->size >= impl->bufferingDepth
+    )
+    {
+        return;
+    }
+
+    impl->actions[(impl->first + impl->size) % MAXIMUM_BUFFERING_DEPTH] =
+        {action, time};
+
+    impl->size++;
+
+    latency::inputQueued();
+}
+
+/**
+ *
+ */
+const InputActionsQueue::Action InputActionsQueue::pop(
+    const sf::Int32& time
+) const & noexcept
+{
+    while (impl->size != 0)
+    {
+        const TimedAction timedAction = impl->actions[impl->first];
+
+        impl->first = (impl->first + 1) % MAXIMUM_BUFFERING_DEPTH;
+        impl->size--;
+
+        if (time - timedAction.time <= impl->expiry)
+        {
+            latency::inputDequeued();
+
+            return timedAction.action;
+        }
+
+        latency::inputDropped();
+    }
+
+    return Action::NO_ACTION;
+}
+
+/**
+ *
+ */
+void InputActionsQueue::clear() const & noexcept
+{
+    impl->size = 0;
+
+    latency::inputsCleared();
+}
+
+}
+}
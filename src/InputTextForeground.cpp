@@ -97,7 +97,7 @@ InputTextForeground::~InputTextForeground() noexcept = default;
  */
 void InputTextForeground::render(const utils::Context& context) const &
 {
-    context.getSfmlWindow().draw(impl->explanation);
+    context.getRenderTarget().draw(impl->explanation);
 
     impl->inputTextLevelName.display(context);
 }
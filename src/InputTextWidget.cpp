@@ -40,6 +40,13 @@ namespace memoris
 namespace widgets
 {
 
+namespace
+{
+
+constexpr sf::Int32 CURSOR_FLASH_INTERVAL {200};
+
+}
+
 class InputTextWidget::Impl
 {
 
@@ -162,15 +169,20 @@ InputTextWidget::InputTextWidget(
     const size_t& maxCharacters
 ) noexcept :
 impl(
-    std::make_unique<Impl>(
-        context,
-        hPosition,
-        vPosition,
-        lineWidth,
-        maxCharacters
-    )
+    context,
+    hPosition,
+    vPosition,
+    lineWidth,
+    maxCharacters
 )
 {
+    /* Impl is 2120 bytes with SFML 2.5 on 64 bits (one text and five
+       rectangles); the storage keeps a quarter of headroom for the other
+       SFML versions */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The InputTextWidget implementation does not fit its storage"
+    );
 }
 
 /**
@@ -191,22 +203,22 @@ void InputTextWidget::setDisplayedText(const sf::String& inputTextData) &
  */
 void InputTextWidget::display(const utils::Context& context) &
 {
-    context.getSfmlWindow().draw(impl->boxTop);
-    context.getSfmlWindow().draw(impl->boxBottom);
-    context.getSfmlWindow().draw(impl->boxLeft);
-    context.getSfmlWindow().draw(impl->boxRight);
-    context.getSfmlWindow().draw(impl->displayedText);
+    context.getRenderTarget().draw(impl->boxTop);
+    context.getRenderTarget().draw(impl->boxBottom);
+    context.getRenderTarget().draw(impl->boxLeft);
+    context.getRenderTarget().draw(impl->boxRight);
+    context.getRenderTarget().draw(impl->displayedText);
 
     if(impl->displayCursor)
     {
-        context.getSfmlWindow().draw(impl->cursor);
+        context.getRenderTarget().draw(impl->cursor);
     }
 
     if(
         (
             context.getClockMillisecondsTime() -
             impl->cursorLastFlashAnimation
-        ) > 200
+        ) > CURSOR_FLASH_INTERVAL
     )
     {
         impl->displayCursor = !impl->displayCursor;
@@ -215,6 +227,22 @@ void InputTextWidget::display(const utils::Context& context) &
     }
 }
 
+/**
+ *
+ */
+const sf::Int32 InputTextWidget::getNextFlashDelay(
+    const utils::Context& context
+) const &
+{
+    /* the flash happens during the first display strictly after the
+       interval, so one more millisecond is waited */
+    const sf::Int32 delay =
+        impl->cursorLastFlashAnimation + CURSOR_FLASH_INTERVAL + 1 -
+        context.getClockMillisecondsTime();
+
+    return delay > 0 ? delay : 0;
+}
+
 /**
  *
  */
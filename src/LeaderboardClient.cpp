@@ -0,0 +1,432 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LeaderboardClient.cpp
+ * @package network
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "LeaderboardClient.hpp"
+
+#include "network.hpp"
+#include "SerieResult.hpp"
+
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+namespace memoris
+{
+namespace network
+{
+
+namespace
+{
+
+constexpr sf::Int32 CONNECTION_TIMEOUT {500};
+
+/* the whole exchange of one batch (sending and acknowledgement) must be
+   finished before this delay, a stalled server never blocks the thread */
+constexpr std::chrono::milliseconds EXCHANGE_TIMEOUT {2000};
+
+/* the socket is not blocking, the sending is tried again at this interval
+   while the socket buffer is full */
+constexpr std::chrono::milliseconds SENDING_INTERVAL {10};
+
+constexpr std::chrono::milliseconds FIRST_RETRY_DELAY {1000};
+constexpr std::chrono::milliseconds MAXIMUM_RETRY_DELAY {60000};
+
+/* the oldest results are dropped if the server is down for a long time,
+   the queue never grows forever */
+constexpr size_t MAXIMUM_QUEUE_SIZE {256};
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * one result waiting into the sending queue; the sequence number identifies
+ * the result even if the front of the queue is dropped during the sending
+ */
+struct QueuedMessage
+{
+    unsigned long long sequence;
+    ResultMessage message;
+};
+
+/**
+ * @brief returns the time left before the given deadline
+ *
+ * @param deadline the deadline
+ *
+ * @return const sf::Time negative or zero once the deadline is passed
+ */
+const sf::Time getRemainingTime(const Clock::time_point& deadline) noexcept
+{
+    return sf::milliseconds(
+        static_cast<sf::Int32>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - Clock::now()
+            ).count()
+        )
+    );
+}
+
+}
+
+class LeaderboardClient::Impl
+{
+
+public:
+
+    /**
+     * @brief sending thread loop; sends the queued results by batches and
+     * waits before retrying when the server cannot be reached
+     */
+    void run() noexcept
+    {
+        std::chrono::milliseconds retryDelay {FIRST_RETRY_DELAY};
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true)
+        {
+            condition.wait(
+                lock,
+                [this]()
+                {
+                    return stopped || !queue.empty();
+                }
+            );
+
+            if (stopped)
+            {
+                return;
+            }
+
+            const size_t batchSize = std::min(
+                queue.size(),
+                static_cast<size_t>(MAXIMUM_BATCH_SIZE)
+            );
+
+            std::vector<ResultMessage> batch;
+            batch.reserve(batchSize);
+
+            std::for_each(
+                queue.cbegin(),
+                queue.cbegin() + batchSize,
+                [&batch](const QueuedMessage& queued)
+                {
+                    batch.push_back(queued.message);
+                }
+            );
+
+            const unsigned long long lastSequence =
+                queue[batchSize - 1].sequence;
+
+            /* the network operations are executed without the lock, so the
+               frame thread can still add results during the sending */
+            lock.unlock();
+
+            const bool sent = sendBatch(batch);
+
+            lock.lock();
+
+            if (sent)
+            {
+                /* the front of the queue may have been dropped during the
+                   sending, the sent results are found by their sequence
+                   numbers and not by their positions */
+                while (
+                    !queue.empty() &&
+                    queue.front().sequence <= lastSequence
+                )
+                {
+                    queue.pop_front();
+                }
+
+                retryDelay = FIRST_RETRY_DELAY;
+
+                continue;
+            }
+
+            condition.wait_for(
+                lock,
+                retryDelay,
+                [this]()
+                {
+                    return stopped;
+                }
+            );
+
+            retryDelay = std::min(
+                retryDelay * 2,
+                MAXIMUM_RETRY_DELAY
+            );
+        }
+    }
+
+    /**
+     * @brief sends one batch and waits for its acknowledgement; the socket
+     * is only used by the sending thread; the socket is not blocking once
+     * connected, so a server that stops in the middle of a packet never
+     * blocks the thread after the exchange timeout
+     *
+     * @param batch the messages to send
+     *
+     * @return const bool true if the server acknowledged the whole batch
+     */
+    const bool sendBatch(const std::vector<ResultMessage>& batch)
+    {
+        if (!connected)
+        {
+            /* the connection timeout only applies to a blocking socket */
+            socket.setBlocking(true);
+
+            if (
+                socket.connect(
+                    sf::IpAddress(SERVER_ADDRESS),
+                    SERVER_PORT,
+                    sf::milliseconds(CONNECTION_TIMEOUT)
+                ) != sf::Socket::Done
+            )
+            {
+                return false;
+            }
+
+            socket.setBlocking(false);
+
+            connected = true;
+        }
+
+        const Clock::time_point deadline = Clock::now() + EXCHANGE_TIMEOUT;
+
+        sf::Packet packet;
+        writeBatch(
+            packet,
+            batch
+        );
+
+        if (
+            !sendPacket(packet, deadline) ||
+            !receiveAcknowledgement(batch.size(), deadline)
+        )
+        {
+            disconnect();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief sends the whole packet before the deadline; the packet keeps
+     * track of its sent bytes, so a partial sending continues where it
+     * stopped
+     *
+     * @param packet the packet to send
+     * @param deadline the end of the exchange
+     *
+     * @return const bool
+     */
+    const bool sendPacket(
+        sf::Packet& packet,
+        const Clock::time_point& deadline
+    )
+    {
+        while (true)
+        {
+            const sf::Socket::Status status = socket.send(packet);
+
+            if (status == sf::Socket::Done)
+            {
+                return true;
+            }
+
+            if (
+                (
+                    status != sf::Socket::Partial &&
+                    status != sf::Socket::NotReady
+                ) ||
+                Clock::now() >= deadline
+            )
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(SENDING_INTERVAL);
+        }
+    }
+
+    /**
+     * @brief waits for the acknowledgement of the whole batch before the
+     * deadline; the socket keeps the received bytes of a partial packet
+     * until the packet is complete
+     *
+     * @param messages the amount of sent messages
+     * @param deadline the end of the exchange
+     *
+     * @return const bool
+     */
+    const bool receiveAcknowledgement(
+        const size_t& messages,
+        const Clock::time_point& deadline
+    )
+    {
+        sf::SocketSelector selector;
+        selector.add(socket);
+
+        sf::Packet answer;
+
+        while (true)
+        {
+            const sf::Time remainingTime = getRemainingTime(deadline);
+
+            if (
+                remainingTime <= sf::Time::Zero ||
+                !selector.wait(remainingTime)
+            )
+            {
+                return false;
+            }
+
+            const sf::Socket::Status status = socket.receive(answer);
+
+            if (status == sf::Socket::Done)
+            {
+                break;
+            }
+
+            if (
+                status != sf::Socket::Partial &&
+                status != sf::Socket::NotReady
+            )
+            {
+                return false;
+            }
+        }
+
+        sf::Uint16 acknowledgedMessages {0};
+
+        return
+            readAcknowledgement(answer, acknowledgedMessages) &&
+            acknowledgedMessages == messages;
+    }
+
+    /**
+     * @brief closes the connection, a new one is opened for the next batch
+     */
+    void disconnect()
+    {
+        socket.disconnect();
+
+        connected = false;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    std::deque<QueuedMessage> queue;
+
+    /* the sequence number of the next uploaded result */
+    unsigned long long nextSequence {0};
+
+    bool stopped {false};
+
+    /* only used by the sending thread */
+    sf::TcpSocket socket;
+    bool connected {false};
+
+    /* declared last: the thread is started once all the other attributes
+       have been initialized */
+    std::thread thread {&Impl::run, this};
+};
+
+/**
+ *
+ */
+LeaderboardClient::LeaderboardClient() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+LeaderboardClient::~LeaderboardClient() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopped = true;
+    }
+
+    /* the thread waits at most for the connection and exchange timeouts
+       before it can be stopped */
+    impl->condition.notify_one();
+    impl->thread.join();
+}
+
+/**
+ *
+ */
+void LeaderboardClient::upload(
+    const std::string& serieName,
+    const entities::SerieResult& result
+) const &
+{
+    ResultMessage message;
+    message.serieName = serieName;
+    message.gameName = result.getName();
+    message.time = result.getTime();
+    message.levelsTimes.assign(
+        result.getLevelsTimes().cbegin(),
+        result.getLevelsTimes().cend()
+    );
+
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+
+        auto& queue = impl->queue;
+        queue.push_back(
+            {
+                impl->nextSequence++,
+                std::move(message)
+            }
+        );
+
+        if (queue.size() > MAXIMUM_QUEUE_SIZE)
+        {
+            queue.pop_front();
+        }
+    }
+
+    impl->condition.notify_one();
+}
+
+}
+}
@@ -0,0 +1,581 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LeaderboardManager.cpp
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "LeaderboardManager.hpp"
+
+#include "SerieResult.hpp"
+#include "AsyncFileWriter.hpp"
+#include "files.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <vector>
+#include <future>
+#include <chrono>
+
+namespace memoris
+{
+namespace managers
+{
+
+namespace
+{
+
+/* the results file format is:
+ *
+ * - the "MRLB" magic and the format version (one byte)
+ * - the results, one after the other; one result is the name (prefixed by
+ *   its length, one byte), the total time, the amount of levels times, the
+ *   levels times (all these integers are two bytes, little endian) and the
+ *   FNV-1a checksum of the result (four bytes)
+ *
+ * the results are only appended at the end of the file; a compaction
+ * rewrites the file with all the results sorted by time */
+
+constexpr char RESULTS_FILES_DIRECTORY[] {"data/results/"};
+constexpr char RESULTS_FILES_EXTENSION[] {".results"};
+
+constexpr char HEADER[] {'M', 'R', 'L', 'B', 1};
+constexpr size_t HEADER_LENGTH {5};
+
+constexpr size_t MAXIMUM_NAME_LENGTH {255};
+
+/**
+ * @brief appends one unsigned short (two bytes) at the end of the bytes
+ *
+ * @param bytes the bytes to update
+ * @param value the value to append
+ */
+void writeShort(
+    std::vector<char>& bytes,
+    const unsigned short& value
+)
+{
+    bytes.push_back(static_cast<char>(value & 0xFF));
+    bytes.push_back(static_cast<char>((value >> 8) & 0xFF));
+}
+
+/**
+ * @brief reads one unsigned short (two bytes) at the given position
+ *
+ * @param bytes the bytes to read
+ * @param position the position of the first byte
+ *
+ * @return const unsigned short
+ */
+const unsigned short readShort(
+    const std::vector<char>& bytes,
+    const size_t& position
+) noexcept
+{
+    const unsigned short low = static_cast<unsigned char>(bytes[position]);
+    const unsigned short high =
+        static_cast<unsigned char>(bytes[position + 1]);
+
+    return low | (high << 8);
+}
+
+/**
+ * @brief appends the binary representation of one result
+ *
+ * @param bytes the bytes to update
+ * @param result the result to append
+ */
+void writeResult(
+    std::vector<char>& bytes,
+    const entities::SerieResult& result
+)
+{
+    const size_t start = bytes.size();
+
+    const std::string& name = result.getName();
+    const size_t nameLength = std::min(
+        name.size(),
+        MAXIMUM_NAME_LENGTH
+    );
+
+    bytes.push_back(static_cast<char>(nameLength));
+    bytes.insert(
+        bytes.end(),
+        name.cbegin(),
+        name.cbegin() + nameLength
+    );
+
+    writeShort(bytes, result.getTime());
+
+    const auto& levelsTimes = result.getLevelsTimes();
+
+    writeShort(
+        bytes,
+        static_cast<unsigned short>(levelsTimes.size())
+    );
+
+    for (const unsigned short& time : levelsTimes)
+    {
+        writeShort(bytes, time);
+    }
+
+    const uint32_t hash = utils::getChecksum(
+        bytes.data() + start,
+        bytes.size() - start
+    );
+
+    writeShort(bytes, static_cast<unsigned short>(hash & 0xFFFF));
+    writeShort(bytes, static_cast<unsigned short>(hash >> 16));
+}
+
+/**
+ * @brief reads the result at the given position; the position is updated
+ * to the beginning of the next result
+ *
+ * @param bytes the content of the results file
+ * @param position the position of the result, updated if the result is
+ * valid
+ * @param results the container where the result is added
+ *
+ * @return const bool false if the result is truncated or corrupted
+ */
+const bool readResult(
+    const std::vector<char>& bytes,
+    size_t& position,
+    std::vector<entities::SerieResult>& results
+)
+{
+    const size_t size = bytes.size();
+
+    size_t cursor = position;
+
+    if (cursor >= size)
+    {
+        return false;
+    }
+
+    const size_t nameLength = static_cast<unsigned char>(bytes[cursor]);
+    cursor++;
+
+    /* the name, the time and the amount of levels times */
+    if (size - cursor < nameLength + 4)
+    {
+        return false;
+    }
+
+    std::string name(
+        bytes.cbegin() + cursor,
+        bytes.cbegin() + cursor + nameLength
+    );
+    cursor += nameLength;
+
+    const unsigned short time = readShort(bytes, cursor);
+    const unsigned short timesAmount = readShort(bytes, cursor + 2);
+    cursor += 4;
+
+    /* the levels times and the checksum */
+    if (size - cursor < timesAmount * 2u + 4)
+    {
+        return false;
+    }
+
+    std::vector<unsigned short> levelsTimes;
+    levelsTimes.reserve(timesAmount);
+
+    for (unsigned short index {0}; index < timesAmount; index++)
+    {
+        levelsTimes.push_back(readShort(bytes, cursor));
+        cursor += 2;
+    }
+
+    const uint32_t low = readShort(bytes, cursor);
+    const uint32_t high = readShort(bytes, cursor + 2);
+
+    if (
+        utils::getChecksum(
+            bytes.data() + position,
+            cursor - position
+        ) != (low | (high << 16))
+    )
+    {
+        return false;
+    }
+
+    results.emplace_back(
+        name,
+        time,
+        levelsTimes
+    );
+
+    position = cursor + 4;
+
+    return true;
+}
+
+/**
+ * @brief comparison used to sort the results index
+ *
+ * @param first the first result to compare
+ * @param second the second result to compare
+ *
+ * @return const bool
+ */
+const bool isFaster(
+    const entities::SerieResult& first,
+    const entities::SerieResult& second
+) noexcept
+{
+    return first.getTime() < second.getTime();
+}
+
+}
+
+constexpr unsigned short LeaderboardManager::COMPACTION_INTERVAL;
+
+class LeaderboardManager::Impl
+{
+
+public:
+
+    /**
+     * one writing of a results file queued on the writing thread
+     */
+    struct PendingWrite
+    {
+        std::string filePath;
+        std::future<bool> result;
+    };
+
+    /**
+     * @brief keeps the given writing of the loaded results file, so the file
+     * is not read again before the writing is finished; the finished
+     * writings are forgotten
+     *
+     * @param result the future of the writing
+     */
+    void addPendingWrite(std::future<bool> result)
+    {
+        pendingWrites.erase(
+            std::remove_if(
+                pendingWrites.begin(),
+                pendingWrites.end(),
+                [](const PendingWrite& pendingWrite)
+                {
+                    return pendingWrite.result.wait_for(
+                        std::chrono::seconds(0)
+                    ) == std::future_status::ready;
+                }
+            ),
+            pendingWrites.end()
+        );
+
+        pendingWrites.push_back({filePath, std::move(result)});
+    }
+
+    /**
+     * @brief waits for the queued writings of the given results file
+     *
+     * @param path the path of the results file
+     */
+    void waitPendingWrites(const std::string& path)
+    {
+        for (PendingWrite& pendingWrite : pendingWrites)
+        {
+            if (pendingWrite.filePath == path)
+            {
+                pendingWrite.result.wait();
+            }
+        }
+    }
+
+    /* all the results of the loaded serie, sorted by time; the results with
+       the same time are sorted by insertion order */
+    std::vector<entities::SerieResult> results;
+
+    std::string serieName;
+    std::string filePath;
+
+    /* amount of results appended after the sorted part of the file */
+    unsigned short appendedResults {0};
+
+    bool loaded {false};
+
+    /* true if the end of the file is corrupted: the next results cannot be
+       appended after it, the file has to be rewritten */
+    bool corrupted {false};
+
+    /* the appends and the compactions that may not be finished yet, of any
+       results file written by this process */
+    std::vector<PendingWrite> pendingWrites;
+};
+
+/**
+ *
+ */
+LeaderboardManager::LeaderboardManager() noexcept :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+LeaderboardManager::~LeaderboardManager() noexcept = default;
+
+/**
+ *
+ */
+void LeaderboardManager::loadSerie(const std::string& serieName) &
+{
+    if (impl->loaded && impl->serieName == serieName)
+    {
+        return;
+    }
+
+    impl->results.clear();
+    impl->serieName = serieName;
+    impl->filePath =
+        RESULTS_FILES_DIRECTORY + serieName + RESULTS_FILES_EXTENSION;
+    impl->appendedResults = 0;
+    impl->corrupted = false;
+    impl->loaded = true;
+
+    /* a result of this serie may still be appended on the writing thread
+       (the serie is played again just after it has been won); a partially
+       written result would be read as a corrupted end of file and dropped
+       by the next compaction */
+    impl->waitPendingWrites(impl->filePath);
+
+    std::ifstream file(
+        impl->filePath,
+        std::ios::binary
+    );
+
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    const std::vector<char> bytes(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+
+    if (
+        bytes.size() < HEADER_LENGTH ||
+        !std::equal(
+            HEADER,
+            HEADER + HEADER_LENGTH,
+            bytes.cbegin()
+        )
+    )
+    {
+        impl->corrupted = true;
+
+        return;
+    }
+
+    auto& results = impl->results;
+
+    size_t position {HEADER_LENGTH};
+
+    while (position != bytes.size())
+    {
+        if (
+            !readResult(
+                bytes,
+                position,
+                results
+            )
+        )
+        {
+            impl->corrupted = true;
+
+            break;
+        }
+    }
+
+    /* the file starts with the sorted results written by the last
+       compaction; only the results appended after it have to be sorted and
+       merged, the index is rebuilt in linear time for a compacted file */
+    const auto sortedEnd = std::is_sorted_until(
+        results.begin(),
+        results.end(),
+        isFaster
+    );
+
+    impl->appendedResults = static_cast<unsigned short>(
+        std::min(
+            static_cast<size_t>(std::distance(sortedEnd, results.end())),
+            static_cast<size_t>(COMPACTION_INTERVAL)
+        )
+    );
+
+    std::stable_sort(
+        sortedEnd,
+        results.end(),
+        isFaster
+    );
+
+    std::inplace_merge(
+        results.begin(),
+        sortedEnd,
+        results.end(),
+        isFaster
+    );
+}
+
+/**
+ *
+ */
+const size_t LeaderboardManager::addResult(
+    const utils::AsyncFileWriter& writer,
+    entities::SerieResult result
+) &
+{
+    auto& results = impl->results;
+
+    /* the new result is inserted after the results with the same time */
+    const auto position = std::upper_bound(
+        results.begin(),
+        results.end(),
+        result,
+        isFaster
+    );
+
+    std::vector<char> bytes;
+    writeResult(
+        bytes,
+        result
+    );
+
+    const size_t rank = std::distance(results.begin(), position) + 1;
+
+    results.insert(
+        position,
+        std::move(result)
+    );
+
+    impl->appendedResults++;
+
+    if (
+        impl->corrupted ||
+        impl->appendedResults >= COMPACTION_INTERVAL
+    )
+    {
+        compact(writer);
+
+        return rank;
+    }
+
+    /* the header is written with the first result */
+    if (results.size() == 1)
+    {
+        bytes.insert(
+            bytes.begin(),
+            HEADER,
+            HEADER + HEADER_LENGTH
+        );
+    }
+
+    impl->addPendingWrite(
+        writer.append(
+            impl->filePath,
+            std::move(bytes)
+        )
+    );
+
+    return rank;
+}
+
+/**
+ *
+ */
+const size_t LeaderboardManager::getRank(const unsigned short& time) const &
+    noexcept
+{
+    const auto& results = impl->results;
+
+    const auto position = std::upper_bound(
+        results.cbegin(),
+        results.cend(),
+        time,
+        [](
+            const unsigned short& value,
+            const entities::SerieResult& result
+        )
+        {
+            return value < result.getTime();
+        }
+    );
+
+    return std::distance(results.cbegin(), position) + 1;
+}
+
+/**
+ *
+ */
+const size_t LeaderboardManager::getResultsAmount() const & noexcept
+{
+    return impl->results.size();
+}
+
+/**
+ *
+ */
+const entities::SerieResult& LeaderboardManager::getResult(
+    const size_t& position
+) const & noexcept
+{
+    return impl->results[position];
+}
+
+/**
+ *
+ */
+void LeaderboardManager::compact(const utils::AsyncFileWriter& writer) const &
+{
+    std::vector<char> bytes(
+        HEADER,
+        HEADER + HEADER_LENGTH
+    );
+
+    for (const auto& result : impl->results)
+    {
+        writeResult(
+            bytes,
+            result
+        );
+    }
+
+    impl->addPendingWrite(
+        writer.write(
+            impl->filePath,
+            std::move(bytes)
+        )
+    );
+
+    impl->appendedResults = 0;
+    impl->corrupted = false;
+}
+
+}
+}
@@ -27,12 +27,15 @@
 
 #include "Context.hpp"
 #include "cells.hpp"
+#include "Cell.hpp"
 #include "allocators.hpp"
 #include "dimensions.hpp"
 #include "PlayingSerieManager.hpp"
+#include "LevelTemplatesManager.hpp"
 
-#include <fstream>
 #include <algorithm>
+#include <array>
+#include <functional>
 
 namespace memoris
 {
@@ -44,7 +47,148 @@ class Level::Impl
 
 public:
 
-    std::vector<std::unique_ptr<Cell>> cells;
+    /* the cells of one floor are stored contiguously, so creating a floor
+       allocates its cells buffer only (the cells implementations are stored
+       into the cells) */
+    using Floor = std::vector<Cell>;
+
+    Impl(const utils::Context& context) :
+        context(context)
+    {
+        const std::string walls(CELLS_PER_FLOOR, cells::WALL_CELL);
+
+        wallsFloor = createFloor(walls.cbegin());
+    }
+
+    /**
+     * @brief creates the cells of one floor
+     *
+     * @param types iterator to the type of the first cell of the floor
+     *
+     * @return Floor
+     */
+    Floor createFloor(std::string::const_iterator types) const
+    {
+        Floor floor;
+        floor.reserve(CELLS_PER_FLOOR);
+
+        for (
+            unsigned short index {0};
+            index < CELLS_PER_FLOOR;
+            index++, types++
+        )
+        {
+            const unsigned short horizontalPosition = index % CELLS_PER_LINE;
+            const unsigned short verticalPosition = index / CELLS_PER_LINE;
+
+            floor.emplace_back(
+                context,
+                cells::HORIZONTAL_POSITION_ORIGIN +
+                cells::CELL_DIMENSIONS * horizontalPosition,
+                cells::VERTICAL_POSITION_ORIGIN +
+                cells::CELL_DIMENSIONS * verticalPosition,
+                *types
+            );
+        }
+
+        return floor;
+    }
+
+    /**
+     * @brief returns the cell at the given index without allocating its
+     * floor; the cells of a not allocated floor are the walls floor cells,
+     * so they must not be modified for one floor only
+     *
+     * @param index the index of the cell into the level
+     *
+     * @return Cell&
+     */
+    Cell& getCell(const unsigned short& index) noexcept
+    {
+        const auto& floor = floors[index / CELLS_PER_FLOOR];
+
+        return (floor != nullptr ? *floor : wallsFloor)[
+            index % CELLS_PER_FLOOR
+        ];
+    }
+
+    /**
+     * @brief returns the cell at the given index, allocates its floor if
+     * necessary; the allocated floor starts with the current visibilities and
+     * colors of the walls floor, so nothing changes on the screen
+     *
+     * @param index the index of the cell into the level
+     *
+     * @return Cell&
+     */
+    Cell& getAllocatedCell(const unsigned short& index)
+    {
+        auto& floor = floors[index / CELLS_PER_FLOOR];
+
+        if (floor == nullptr)
+        {
+            const std::string walls(CELLS_PER_FLOOR, cells::WALL_CELL);
+
+            floor = std::make_unique<Floor>(createFloor(walls.cbegin()));
+
+            for (
+                unsigned short cell {0};
+                cell < CELLS_PER_FLOOR;
+                cell++
+            )
+            {
+                const Cell& wall = wallsFloor[cell];
+                Cell& copy = (*floor)[cell];
+
+                if (!wall.isVisible())
+                {
+                    copy.hide(context);
+                }
+
+                copy.setCellColor(wall.getCellColor());
+            }
+        }
+
+        return (*floor)[index % CELLS_PER_FLOOR];
+    }
+
+    /**
+     * @brief calls the given function on every cell of the allocated floors
+     * and on every cell of the walls floor (so once for all the other
+     * floors); used for the modifications applied on the whole level
+     *
+     * @param function the function to call with every cell
+     */
+    void forEachStoredCell(const std::function<void(Cell&)>& function)
+    {
+        for (const auto& floor : floors)
+        {
+            if (floor == nullptr)
+            {
+                continue;
+            }
+
+            for (auto& cell : *floor)
+            {
+                function(cell);
+            }
+        }
+
+        for (auto& cell : wallsFloor)
+        {
+            function(cell);
+        }
+    }
+
+    const utils::Context& context;
+
+    /* only the floors the player can reach are allocated; the null floors
+       are displayed with the walls floor, that is shared by all of them; the
+       memory and the loading time of a level depend on the amount of floors
+       it really uses */
+    std::array<std::unique_ptr<Floor>, MAX_FLOOR + 1> floors;
+
+    Floor wallsFloor;
 
     unsigned short playerIndex {0};
     unsigned short starsAmount {0};
@@ -58,37 +202,23 @@ public:
 
     unsigned short animationColumn {0};
     unsigned short animationFloor {0};
-    unsigned short horizontalPositionCursor {0};
-    unsigned short verticalPositionCursor {0};
 
     std::unique_ptr<sf::Transform> transform {nullptr};
-
-    bool emptyFloor {true};
 };
 
 /**
  *
  */
 Level::Level(const utils::Context& context) :
-    impl(std::make_unique<Impl>())
-{
-    for(
-        unsigned short index {0};
-        index < CELLS_PER_LEVEL;
-        index++
-    )
-    {
-        std::unique_ptr<Cell> cell = cells::getCellByType(
-            context,
-            impl->horizontalPositionCursor,
-            impl->verticalPositionCursor,
-            cells::WALL_CELL
-        );
-
-        updateCursors();
-
-        impl->cells.push_back(std::move(cell));
-    }
+    impl(context)
+{
+    /* Impl is 144 bytes with libstdc++ on 64 bits (containers and unique
+       pointers); the storage keeps a quarter of headroom for the other
+       standard libraries */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The Level implementation does not fit its storage"
+    );
 }
 
 /**
@@ -96,76 +226,52 @@ Level::Level(const utils::Context& context) :
  */
 Level::Level(
     const utils::Context& context,
-    const std::string& fileName
+    const managers::LevelTemplate& levelTemplate
 ) :
-    impl(std::make_unique<Impl>())
+    impl(context)
 {
-    std::ifstream file(fileName);
+    impl->minutes = levelTemplate.minutes;
+    impl->seconds = levelTemplate.seconds;
+    impl->playerIndex = levelTemplate.playerIndex;
+    impl->starsAmount = levelTemplate.starsAmount;
+    impl->playableFloors = levelTemplate.playableFloors;
 
-    if (!file.is_open())
-    {
-        /* TODO: #561 - check PlayingSerieManager.cpp for details */
-        throw std::invalid_argument("Cannot open the given level file");
-    }
-
-    /* FIXME: if the minutes/seconds are not specified or partially specified,
-       the behavior is unmanaged */
-    std::string min, sec;
-    getline(file, min, '\n');
-    getline(file, sec, '\n');
+    /* the player only reaches a floor through the stairs of the floor below
+       or above it, so he never goes higher than the floor over the highest
+       used floor; every floor he can reach is allocated now, even if it only
+       contains walls, so a move never allocates a floor during the game */
+    unsigned short reachableFloors {0};
 
-    impl->minutes = static_cast<unsigned short>(std::stoi(min));
-    impl->seconds = static_cast<unsigned short>(std::stoi(sec));
-
-    for(
-        unsigned short index {0}; 
-        index < CELLS_PER_LEVEL; 
-        index++
+    for (
+        unsigned short floor {0};
+        floor <= MAX_FLOOR;
+        floor++
     )
     {
-        char cellType = cells::EMPTY_CELL;
-
-        if (!file.eof())
-        {
-            cellType = file.get();
-        }
-
-        std::unique_ptr<Cell> cell = cells::getCellByType(
-            context,
-            impl->horizontalPositionCursor,
-            impl->verticalPositionCursor,
-            cellType
-        );
-
-        switch(cellType)
-        {
-        case cells::DEPARTURE_CELL:
-        {
-            impl->playerIndex = index;
-
-            break;
-        }
-        case cells::STAR_CELL:
+        if (levelTemplate.usedFloors[floor])
         {
-            impl->starsAmount++;
-
-            break;
-        }
-        }
-
-        if (
-            (
-                cellType != cells::EMPTY_CELL &&
-                cellType != cells::WALL_CELL
-            ) && impl->emptyFloor
-        )
-        {
-            impl->emptyFloor = false;
+            reachableFloors = std::min(
+                floor + 2,
+                MAX_FLOOR + 1
+            );
         }
+    }
 
-        updateCursors();
+    const std::string walls(CELLS_PER_FLOOR, cells::WALL_CELL);
 
-        impl->cells.push_back(std::move(cell));
+    for (
+        unsigned short floor {0};
+        floor < reachableFloors;
+        floor++
+    )
+    {
+        impl->floors[floor] = std::make_unique<Impl::Floor>(
+            impl->createFloor(
+                levelTemplate.usedFloors[floor] ?
+                    levelTemplate.cells.cbegin() + floor * CELLS_PER_FLOOR :
+                    walls.cbegin()
+            )
+        );
     }
 }
 
@@ -196,7 +302,7 @@ void Level::display(
         index++
     )
     {
-        ((*impl->cells[index]).*display)(context, impl->transform);
+        (impl->getCell(index).*display)(context, impl->transform);
     }
 }
 
@@ -207,19 +313,17 @@ void Level::hideAllCellsExceptDeparture(
     const utils::Context& context
 )
 {
-    std::for_each(
-        impl->cells.begin(),
-        impl->cells.end(),
-        [&context](const std::unique_ptr<Cell>& cell)
+    impl->forEachStoredCell(
+        [&context](Cell& cell)
     {
-        if (cell->getType() == cells::DEPARTURE_CELL)
+        if (cell.getType() == cells::DEPARTURE_CELL)
         {
-            cell->show(context);
+            cell.show(context);
 
             return;
         }
 
-        cell->hide(context);
+        cell.hide(context);
     }
     );
 }
@@ -232,7 +336,7 @@ void Level::setPlayerCellTransparency(
     const sf::Uint8& alpha
 )
 {
-    (*impl->cells[impl->playerIndex]).setCellColorTransparency(
+    impl->getAllocatedCell(impl->playerIndex).setCellColorTransparency(
         context,
         alpha
     );
@@ -253,7 +357,7 @@ void Level::movePlayer(
 
     impl->playerIndex += movement;
 
-    (*impl->cells[impl->playerIndex]).show(context);
+    impl->getAllocatedCell(impl->playerIndex).show(context);
 }
 
 /**
@@ -291,11 +395,11 @@ bool Level::detectWalls(
 ) const
 {
     if(
-        (*impl->cells[impl->playerIndex + movement]).getType() ==
+        impl->getCell(impl->playerIndex + movement).getType() ==
         cells::WALL_CELL
     )
     {
-        (*impl->cells[impl->playerIndex + movement]).show(context);
+        impl->getAllocatedCell(impl->playerIndex + movement).show(context);
 
         return true;
     }
@@ -308,7 +412,7 @@ bool Level::detectWalls(
  */
 const char& Level::getPlayerCellType() const
 {
-    return (*impl->cells[impl->playerIndex]).getType();
+    return impl->getCell(impl->playerIndex).getType();
 }
 
 /**
@@ -316,8 +420,8 @@ const char& Level::getPlayerCellType() const
  */
 void Level::emptyPlayerCell(const utils::Context& context)
 {
-    (*impl->cells[impl->playerIndex]).empty();
-    (*impl->cells[impl->playerIndex]).show(context);
+    impl->getAllocatedCell(impl->playerIndex).empty();
+    impl->getAllocatedCell(impl->playerIndex).show(context);
 }
 
 /**
@@ -336,7 +440,7 @@ bool Level::movePlayerToNextFloor(
 
     impl->playerIndex = newIndex;
 
-    (*impl->cells[impl->playerIndex]).show(context);
+    impl->getAllocatedCell(impl->playerIndex).show(context);
 
     return true;
 }
@@ -357,7 +461,7 @@ bool Level::movePlayerToPreviousFloor(
 
     impl->playerIndex = static_cast<unsigned short>(newIndex);
 
-    (*impl->cells[impl->playerIndex]).show(context);
+    impl->getAllocatedCell(impl->playerIndex).show(context);
 
     return true;
 }
@@ -401,7 +505,7 @@ void Level::playFloorTransitionAnimation(
     {
         if (i % 16 < impl->animationColumn)
         {
-            (*impl->cells[impl->animationFloor * 256 + i + 256]).display(
+            impl->getCell(impl->animationFloor * 256 + i + 256).display(
                 context
             );
 
@@ -410,10 +514,12 @@ void Level::playFloorTransitionAnimation(
 
         if (i % 16 == impl->animationColumn)
         {
-            (*impl->cells[impl->animationFloor * 256 + i]).hide(context);
+            impl->getAllocatedCell(impl->animationFloor * 256 + i).hide(
+                context
+            );
         }
 
-        (*impl->cells[impl->animationFloor * 256 + i]).display(context);
+        impl->getCell(impl->animationFloor * 256 + i).display(context);
     }
 
     if (
@@ -493,16 +599,15 @@ void Level::setCellsTransparency(
     const unsigned short& floor
 ) &
 {
-    const unsigned short firstCellIndex = floor * 256;
-    const unsigned short lastCellIndex = firstCellIndex + 256;
+    /* the transparency is applied on the whole floor, so the walls floor
+       is directly updated if the floor is not allocated: two floors of walls
+       are never displayed with different transparencies at the same time */
+    auto& cells = impl->floors[floor] != nullptr ?
+        *impl->floors[floor] : impl->wallsFloor;
 
-    for (
-        unsigned short index = firstCellIndex;
-        index < lastCellIndex;
-        index++
-    )
+    for (auto& cell : cells)
     {
-        impl->cells[index]->setCellColorTransparency(
+        cell.setCellColorTransparency(
             context,
             transparency
         );
@@ -512,9 +617,9 @@ void Level::setCellsTransparency(
 /**
  *
  */
-const std::vector<std::unique_ptr<Cell>>& Level::getCells() const & noexcept
+Cell& Level::getCell(const unsigned short& index) const &
 {
-    return impl->cells;
+    return impl->getAllocatedCell(index);
 }
 
 /**
@@ -545,33 +650,6 @@ void Level::deleteTransform()
     allocators::deleteDynamicObject(impl->transform);
 }
 
-/**
- *
- */
-void Level::updateCursors() const & noexcept
-{
-    impl->horizontalPositionCursor++;
-
-    if (impl->horizontalPositionCursor % CELLS_PER_LINE == 0)
-    {
-        impl->horizontalPositionCursor = 0;
-
-        impl->verticalPositionCursor++;
-
-        if (impl->verticalPositionCursor % CELLS_PER_LINE == 0)
-        {
-            impl->verticalPositionCursor = 0;
-
-            if (!impl->emptyFloor)
-            {
-                impl->playableFloors++;
-
-                impl->emptyFloor = true;
-            }
-        }
-    }
-}
-
 /**
  *
  */
@@ -587,32 +665,31 @@ const bool Level::updateSelectedCellType(
     bool updated = false;
 
     for(
-        std::vector<std::unique_ptr<entities::Cell>>::const_iterator iterator =
-            impl->cells.cbegin() + firstCellIndex;
-        iterator != impl->cells.cbegin() + lastCellIndex;
-        iterator++
+        unsigned short index = firstCellIndex;
+        index < lastCellIndex;
+        index++
     )
     {
-        if (!(*iterator)->isMouseHover())
+        const Cell& hoveredCell = impl->getCell(index);
+
+        if (!hoveredCell.isMouseHover(context))
         {
             continue;
         }
 
-        if ((*iterator)->getType() == type)
+        if (hoveredCell.getType() == type)
         {
             break;
         }
 
         if (type == cells::DEPARTURE_CELL)
         {
-            impl->playerIndex = std::distance(
-                impl->cells.cbegin(),
-                iterator
-            );
+            impl->playerIndex = index;
         }
 
-        (*iterator)->setType(type);
-        (*iterator)->show(context);
+        Cell& cell = impl->getAllocatedCell(index);
+        cell.setType(type);
+        cell.show(context);
 
         updated = true;
 
@@ -627,15 +704,16 @@ const bool Level::updateSelectedCellType(
  */
 void Level::refresh(const utils::Context& context) &
 {
-    std::for_each(
-        impl->cells.begin(),
-        impl->cells.end(),
-        [&context](const auto& cell) // auto -> std::unique_ptr<entities::Cell>
+    /* all the floors are only made of walls again */
+    for (auto& floor : impl->floors)
     {
-        cell->setType(cells::WALL_CELL);
-        cell->show(context);
+        floor.reset();
+    }
+
+    for (auto& cell : impl->wallsFloor)
+    {
+        cell.show(context);
     }
-    );
 }
 
 /**
@@ -643,7 +721,7 @@ void Level::refresh(const utils::Context& context) &
  */
 const float& Level::getPlayerCellHorizontalPosition() const & noexcept
 {
-    return (*impl->cells[impl->playerIndex]).getHorizontalPosition();
+    return impl->getCell(impl->playerIndex).getHorizontalPosition();
 }
 
 /**
@@ -651,7 +729,7 @@ const float& Level::getPlayerCellHorizontalPosition() const & noexcept
  */
 const float& Level::getPlayerCellVerticalPosition() const & noexcept
 {
-    return (*impl->cells[impl->playerIndex]).getVerticalPosition();
+    return impl->getCell(impl->playerIndex).getVerticalPosition();
 }
 
 /**
@@ -659,12 +737,12 @@ const float& Level::getPlayerCellVerticalPosition() const & noexcept
  */
 void Level::showAllCells(const utils::Context& context) const &
 {
-    auto& cells = impl->cells;
-
-    for (auto& cell : cells)
-    {
-        cell->show(context);
-    }
+    impl->forEachStoredCell(
+        [&context](Cell& cell)
+        {
+            cell.show(context);
+        }
+    );
 }
 
 /**
@@ -675,10 +753,11 @@ const bool Level::hasOneDepartureAndOneArrival() const & noexcept
     unsigned short departureCellsAmount {0};
     unsigned short arrivalCellsAmount {0};
 
-    const auto& cells = impl->cells;
-    for (const auto& cell : cells)
+    /* the walls floor contains neither departure nor arrival */
+    impl->forEachStoredCell(
+        [&departureCellsAmount, &arrivalCellsAmount](Cell& cell)
     {
-        const auto& type = cell->getType();
+        const auto& type = cell.getType();
 
         if (type == cells::DEPARTURE_CELL)
         {
@@ -689,6 +768,7 @@ const bool Level::hasOneDepartureAndOneArrival() const & noexcept
             arrivalCellsAmount++;
         }
     }
+    );
 
     return (
         departureCellsAmount == 1 and
@@ -701,28 +781,28 @@ const bool Level::hasOneDepartureAndOneArrival() const & noexcept
  */
 void Level::initializeEditedLevel() const & noexcept
 {
-    using CellsIterator =
-        std::vector<std::unique_ptr<entities::Cell>>::const_iterator;
-
     auto& starsAmount = impl->starsAmount;
     starsAmount = 0;
 
-    auto& cells = impl->cells;
-
     for (
-        CellsIterator iterator = cells.cbegin();
-        iterator != cells.cend();
-        ++iterator
+        unsigned short index {0};
+        index < CELLS_PER_LEVEL;
+        index++
     )
     {
-        switch((*iterator)->getType())
+        /* the walls floor cells are skipped as soon as possible */
+        if (impl->floors[index / CELLS_PER_FLOOR] == nullptr)
+        {
+            index += CELLS_PER_FLOOR - 1;
+
+            continue;
+        }
+
+        switch(impl->getCell(index).getType())
         {
         case cells::DEPARTURE_CELL:
         {
-            impl->playerIndex = std::distance(
-                cells.cbegin(),
-                iterator
-            );
+            impl->playerIndex = index;
 
             break;
         }
@@ -745,11 +825,15 @@ void Level::initializeEditedLevel() const & noexcept
 const std::vector<char> Level::getCharactersList() const & noexcept
 {
     std::vector<char> characters;
+    characters.reserve(CELLS_PER_LEVEL);
 
-    const auto& cells = impl->cells;
-    for (const auto& cell : cells)
+    for (
+        unsigned short index {0};
+        index < CELLS_PER_LEVEL;
+        index++
+    )
     {
-        characters.push_back(cell->getType());
+        characters.push_back(impl->getCell(index).getType());
     }
 
     return characters;
@@ -763,17 +847,111 @@ void Level::setCellsFromCharactersList(const std::vector<char>& characters)
 {
     unsigned short index {0};
 
-    auto& cells = impl->cells;
+    auto& level = *impl;
     std::for_each(
         characters.cbegin(),
         characters.cend(),
-        [&index, &cells](const char& character)
+        [&index, &level](const char& character)
         {
-            cells[index]->setType(character);
+            /* the walls of the not allocated floors are already set */
+            if (
+                character != cells::WALL_CELL ||
+                level.floors[index / CELLS_PER_FLOOR] != nullptr
+            )
+            {
+                level.getAllocatedCell(index).setType(character);
+            }
+
             index++;
         }
     );
 }
 
+/**
+ *
+ */
+const std::vector<bool> Level::getVisibilitiesList() const & noexcept
+{
+    std::vector<bool> visibilities;
+    visibilities.reserve(CELLS_PER_LEVEL);
+
+    for (
+        unsigned short index {0};
+        index < CELLS_PER_LEVEL;
+        index++
+    )
+    {
+        visibilities.push_back(impl->getCell(index).isVisible());
+    }
+
+    return visibilities;
+}
+
+/**
+ *
+ */
+void Level::setCellsFromVisibilitiesList(
+    const utils::Context& context,
+    const std::vector<bool>& visibilities
+) const &
+{
+    /* a not allocated floor with the same visibility for all its cells
+       only updates the walls floor, once; the other floors are allocated */
+    bool wallsFloorUpdated {false};
+
+    for (
+        unsigned short floor {0};
+        floor <= MAX_FLOOR;
+        floor++
+    )
+    {
+        const auto first = visibilities.cbegin() + floor * CELLS_PER_FLOOR;
+        const auto last = first + CELLS_PER_FLOOR;
+
+        if (
+            impl->floors[floor] == nullptr &&
+            std::adjacent_find(first, last, std::not_equal_to<bool>()) ==
+                last &&
+            (
+                !wallsFloorUpdated ||
+                impl->wallsFloor.front().isVisible() == *first
+            )
+        )
+        {
+            for (auto& cell : impl->wallsFloor)
+            {
+                if (*first)
+                {
+                    cell.show(context);
+                }
+                else
+                {
+                    cell.hide(context);
+                }
+            }
+
+            wallsFloorUpdated = true;
+
+            continue;
+        }
+
+        unsigned short index = floor * CELLS_PER_FLOOR;
+
+        for (auto iterator = first; iterator != last; ++iterator, index++)
+        {
+            Cell& cell = impl->getAllocatedCell(index);
+
+            if (*iterator)
+            {
+                cell.show(context);
+            }
+            else
+            {
+                cell.hide(context);
+            }
+        }
+    }
+}
+
 }
 }
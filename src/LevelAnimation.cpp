@@ -38,6 +38,19 @@ namespace animations
  */
 LevelAnimation::~LevelAnimation() noexcept = default;
 
+/**
+ *
+ */
+void LevelAnimation::start(const utils::Context& context) &
+{
+    lastAnimationUpdateTime = 0;
+    animationSteps = 0;
+    finished = false;
+    updatedPlayerIndex = -1;
+
+    resetAnimation(context);
+}
+
 /**
  *
  */
@@ -46,6 +59,13 @@ const bool& LevelAnimation::isFinished() const & noexcept
     return finished;
 }
 
+/**
+ *
+ */
+void LevelAnimation::resetAnimation(const utils::Context&) &
+{
+}
+
 /**
  *
  */
@@ -58,11 +78,11 @@ void LevelAnimation::showOrHideCell(
 {
     if (visible)
     {
-        level->getCells()[index]->show(context);
+        level->getCell(index).show(context);
     }
     else
     {
-        level->getCells()[index]->hide(context);
+        level->getCell(index).hide(context);
     }
 }
 
@@ -85,7 +105,72 @@ void LevelAnimation::movePlayer(
 ) const &
 {
     level->setPlayerCellIndex(updatedPlayerIndex);
-    level->getCells()[updatedPlayerIndex]->show(context);
+    level->getCell(updatedPlayerIndex).show(context);
+}
+
+/**
+ *
+ */
+void LevelAnimation::transformFloor(
+    const utils::Context& context,
+    const Level& level,
+    const unsigned short& floor,
+    const transforms::FloorTransform& transform
+) const &
+{
+    const unsigned short firstIndex = floor * CELLS_PER_FLOOR;
+
+    transforms::PackedFloor types;
+    transforms::PackedFloor visibilities;
+
+    for (
+        unsigned short index {0};
+        index < CELLS_PER_FLOOR;
+        index++
+    )
+    {
+        const entities::Cell& cell = level->getCell(firstIndex + index);
+
+        types[index] = cell.getType();
+        visibilities[index] = cell.isVisible();
+    }
+
+    transforms::applyFloorTransformInPlace(
+        transform,
+        types,
+        visibilities
+    );
+
+    for (
+        unsigned short index {0};
+        index < CELLS_PER_FLOOR;
+        index++
+    )
+    {
+        level->getCell(firstIndex + index).setType(types[index]);
+
+        showOrHideCell(
+            context,
+            level,
+            firstIndex + index,
+            static_cast<bool>(visibilities[index])
+        );
+    }
+
+    const unsigned short& playerIndex = level->getPlayerCellIndex();
+
+    if (playerIndex / CELLS_PER_FLOOR != floor)
+    {
+        return;
+    }
+
+    level->setPlayerCellIndex(
+        firstIndex +
+        transforms::getTransformedIndex(
+            transform,
+            playerIndex % CELLS_PER_FLOOR
+        )
+    );
 }
 
 }
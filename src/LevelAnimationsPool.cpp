@@ -0,0 +1,144 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LevelAnimationsPool.cpp
+ * @package animations
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "LevelAnimationsPool.hpp"
+
+#include "HorizontalMirrorAnimation.hpp"
+#include "VerticalMirrorAnimation.hpp"
+#include "StairsAnimation.hpp"
+#include "DiagonalAnimation.hpp"
+#include "RotateFloorAnimation.hpp"
+#include "QuarterRotationAnimation.hpp"
+#include "cells.hpp"
+
+namespace memoris
+{
+namespace animations
+{
+
+class LevelAnimationsPool::Impl
+{
+
+public:
+
+    StairsAnimation stairsUp {1};
+    StairsAnimation stairsDown {-1};
+    HorizontalMirrorAnimation horizontalMirror;
+    VerticalMirrorAnimation verticalMirror;
+    DiagonalAnimation diagonal;
+    RotateFloorAnimation leftRotation {-1};
+    RotateFloorAnimation rightRotation {1};
+    QuarterRotationAnimation quarterRotation;
+};
+
+/**
+ *
+ */
+LevelAnimationsPool::LevelAnimationsPool() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+LevelAnimationsPool::~LevelAnimationsPool() noexcept = default;
+
+/**
+ *
+ */
+LevelAnimation* LevelAnimationsPool::startAnimation(
+    const utils::Context& context,
+    const char& cellType
+) &
+{
+    LevelAnimation* animation {nullptr};
+
+    switch(cells::getCellTraits(cellType).animation)
+    {
+    case cells::CellAnimation::STAIRS_UP:
+    {
+        animation = &impl->stairsUp;
+
+        break;
+    }
+    case cells::CellAnimation::STAIRS_DOWN:
+    {
+        animation = &impl->stairsDown;
+
+        break;
+    }
+    case cells::CellAnimation::HORIZONTAL_MIRROR:
+    {
+        animation = &impl->horizontalMirror;
+
+        break;
+    }
+    case cells::CellAnimation::VERTICAL_MIRROR:
+    {
+        animation = &impl->verticalMirror;
+
+        break;
+    }
+    case cells::CellAnimation::DIAGONAL:
+    {
+        animation = &impl->diagonal;
+
+        break;
+    }
+    case cells::CellAnimation::LEFT_ROTATION:
+    {
+        animation = &impl->leftRotation;
+
+        break;
+    }
+    case cells::CellAnimation::RIGHT_ROTATION:
+    {
+        animation = &impl->rightRotation;
+
+        break;
+    }
+    case cells::CellAnimation::QUARTER_ROTATION:
+    {
+        animation = &impl->quarterRotation;
+
+        break;
+    }
+    case cells::CellAnimation::NONE:
+    case cells::CellAnimation::ANIMATIONS_AMOUNT:
+    {
+        break;
+    }
+    }
+
+    if (animation != nullptr)
+    {
+        animation->start(context);
+    }
+
+    return animation;
+}
+
+}
+}
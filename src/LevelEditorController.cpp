@@ -27,7 +27,6 @@
 #include "controllers.hpp"
 #include "fonts.hpp"
 #include "dialogs.hpp"
-#include "files.hpp"
 #include "InputTextWidget.hpp"
 #include "EditorDashboard.hpp"
 #include "CellsSelector.hpp"
@@ -41,9 +40,14 @@
 #include "InputTextForeground.hpp"
 #include "SelectionListWidget.hpp"
 #include "PlayingSerieManager.hpp"
+#include "AsyncFileWriter.hpp"
+#include "ThumbnailsGenerator.hpp"
 
 #include <SFML/Graphics/Text.hpp>
 
+#include <future>
+#include <chrono>
+
 namespace memoris
 {
 namespace controllers
@@ -54,6 +58,9 @@ using Action = utils::EditorDashboard::Action;
 constexpr const char* LevelEditorController::UNNAMED_LEVEL;
 constexpr const char* LevelEditorController::SAVE_LEVEL_NAME_MESSAGE;
 constexpr const char* LevelEditorController::ERASE_LEVEL_MESSAGE;
+constexpr const char* LevelEditorController::SAVING_MESSAGE;
+constexpr const char* LevelEditorController::SAVED_MESSAGE;
+constexpr const char* LevelEditorController::SAVE_FAILED_MESSAGE;
 
 constexpr float LevelEditorController::CELLS_DEFAULT_TRANSPARENCY;
 
@@ -121,6 +128,10 @@ public:
             50.f
         );
 
+        saveStatus.setFont(font);
+        saveStatus.setColor(white);
+        saveStatus.setCharacterSize(fonts::INFORMATION_SIZE);
+
         /* if the previous controller was the game controller, so some cells
            have been hidden during the game; this function is useless when
            the editor is loaded from the menu */
@@ -153,6 +164,11 @@ public:
     sf::Text levelNameSurface;
     sf::Text floorSurface;
     sf::Text testedTime;
+    sf::Text saveStatus;
+
+    /* the result of the last level file writing, valid until the writing
+       thread has finished it */
+    std::future<bool> savedLevelFile;
 
     std::unique_ptr<foregrounds::MessageForeground>
         newLevelForeground {nullptr};
@@ -225,16 +241,19 @@ const unsigned short& LevelEditorController::render(
             &entities::Cell::displayWithMouseHover
         );
 
-        context.getSfmlWindow().draw(levelNameSurface);
-        context.getSfmlWindow().draw(impl->floorSurface);
-        context.getSfmlWindow().draw(impl->testedTime);
+        context.getRenderTarget().draw(levelNameSurface);
+        context.getRenderTarget().draw(impl->floorSurface);
+        context.getRenderTarget().draw(impl->testedTime);
+        context.getRenderTarget().draw(impl->saveStatus);
 
         impl->cursor.render(context);
     }
 
+    updateSaveStatus(context);
+
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -284,8 +303,9 @@ const unsigned short& LevelEditorController::render(
                     }
 
                     saveLevelFile(
+                        context,
                         levelName,
-                        level->getCells()
+                        level->getCharactersList()
                     );
 
                     changeLevelName(
@@ -362,8 +382,9 @@ const unsigned short& LevelEditorController::render(
                     if ((not levelName.empty() and updatedLevel) or newFile)
                     {
                         saveLevelFile(
+                            context,
                             levelName,
-                            level->getCells()
+                            level->getCharactersList()
                         );
 
                         /* remove the asterisk at the end
@@ -472,6 +493,27 @@ const unsigned short& LevelEditorController::render(
     return nextControllerId;
 }
 
+/**
+ *
+ */
+const sf::Int32 LevelEditorController::getStaticDuration(
+    const utils::Context& context
+) const &
+{
+    if (impl->savedLevelFile.valid())
+    {
+        return ANIMATED_SCREEN;
+    }
+
+    if (impl->saveLevelForeground != nullptr)
+    {
+        return impl->saveLevelForeground->getInputTextWidget()
+            .getNextFlashDelay(context);
+    }
+
+    return STATIC_SCREEN;
+}
+
 /**
  *
  */
@@ -487,34 +529,103 @@ void LevelEditorController::updateLevelNameSurfacePosition() const &
  *
  */
 void LevelEditorController::saveLevelFile(
+    const utils::Context& context,
     const std::string& name,
-    aliases::ConstUniquePtrCellsContainerRef cells
+    const std::vector<char>& characters
 ) const &
 {
-    std::ofstream file;
-    utils::applyFailbitAndBadbitExceptions(file);
+    const std::string minutes =
+        std::to_string(impl->level->getMinutes()) + '\n';
+    const std::string seconds =
+        std::to_string(impl->level->getSeconds()) + '\n';
 
-    file.open(
+    std::vector<char> content;
+    content.reserve(minutes.size() + seconds.size() + characters.size());
+
+    content.insert(content.end(), minutes.cbegin(), minutes.cend());
+    content.insert(content.end(), seconds.cbegin(), seconds.cend());
+    content.insert(content.end(), characters.cbegin(), characters.cend());
+
+    /* the file is written into a temporary file and renamed by the writing
+       thread, so the existing level is never corrupted by a failed save */
+    impl->savedLevelFile = context.getAsyncFileWriter().write(
         "data/levels/personals/" + name + ".level",
-        std::fstream::out
+        std::move(content)
     );
 
-    std::string cellsStr;
+    setSaveStatus(
+        SAVING_MESSAGE,
+        context.getColorsManager().getColorWhite()
+    );
+}
 
-    cellsStr += std::to_string(impl->level->getMinutes()) + '\n';
-    cellsStr += std::to_string(impl->level->getSeconds()) + '\n';
+/**
+ *
+ */
+void LevelEditorController::updateSaveStatus(const utils::Context& context)
+    const &
+{
+    auto& savedLevelFile = impl->savedLevelFile;
 
-    for (
-        std::vector<std::unique_ptr<entities::Cell>>::const_iterator iterator =
-            cells.cbegin();
-        iterator != cells.cend();
-        iterator++
+    if (
+        !savedLevelFile.valid() ||
+        savedLevelFile.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready
     )
     {
-        cellsStr += (*iterator)->getType();
+        return;
     }
 
-    file << cellsStr;
+    if (savedLevelFile.get())
+    {
+        setSaveStatus(
+            SAVED_MESSAGE,
+            context.getColorsManager().getColorWhite()
+        );
+
+        /* the thumbnails of the level and of its series are generated again
+           the next time they are displayed */
+        context.getThumbnailsGenerator().refresh();
+
+        return;
+    }
+
+    setSaveStatus(
+        SAVE_FAILED_MESSAGE,
+        context.getColorsManager().getColorRed()
+    );
+
+    /* the level is displayed as not saved again, so it can be saved again */
+    auto& levelNameSurface = impl->levelNameSurface;
+    const auto displayedName = levelNameSurface.getString().toAnsiString();
+
+    if (
+        displayedName.back() != '*' and
+        displayedName != UNNAMED_LEVEL
+    )
+    {
+        levelNameSurface.setString(displayedName + "*");
+
+        updateLevelNameSurfacePosition();
+    }
+}
+
+/**
+ *
+ */
+void LevelEditorController::setSaveStatus(
+    const std::string& message,
+    const sf::Color& color
+) const &
+{
+    auto& saveStatus = impl->saveStatus;
+
+    saveStatus.setString(message);
+    saveStatus.setColor(color);
+    saveStatus.setPosition(
+        TITLES_HORIZONTAL_POSITION - saveStatus.getLocalBounds().width,
+        100.f
+    );
 }
 
 /**
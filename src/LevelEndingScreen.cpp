@@ -66,8 +66,8 @@ LevelEndingScreen::~LevelEndingScreen() noexcept = default;
  */
 void LevelEndingScreen::render(const Context& context) &
 {
-    context.getSfmlWindow().draw(filter);
-    context.getSfmlWindow().draw(text);
+    context.getRenderTarget().draw(filter);
+    context.getRenderTarget().draw(text);
 }
 
 }
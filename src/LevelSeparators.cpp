@@ -42,7 +42,7 @@ class LevelSeparators::Impl
 public:
 
     Impl(const utils::Context& context) :
-        window(context.getSfmlWindow())
+        window(context.getRenderTarget())
     {
         constexpr float SEPARATORS_WIDTH {1.f};
         const auto separatorsSize = sf::Vector2f(
@@ -71,7 +71,7 @@ public:
         right.setFillColor(white);
     }
 
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
 
     sf::RectangleShape left;
     sf::RectangleShape right;
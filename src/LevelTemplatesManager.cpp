@@ -0,0 +1,194 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file LevelTemplatesManager.cpp
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "LevelTemplatesManager.hpp"
+
+#include "cells.hpp"
+
+#include <sys/stat.h>
+
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace memoris
+{
+namespace managers
+{
+
+class LevelTemplatesManager::Impl
+{
+
+public:
+
+    /**
+     * one cached template and the state of its file when it was parsed
+     */
+    struct Entry
+    {
+        std::shared_ptr<const LevelTemplate> levelTemplate;
+
+        time_t modificationSeconds {0};
+        long modificationNanoseconds {0};
+        off_t size {0};
+    };
+
+    /**
+     * @brief parses the given level file
+     *
+     * @param filePath the path of the level file
+     *
+     * @return std::shared_ptr<const LevelTemplate>
+     *
+     * @throw std::invalid_argument the level file cannot be opened or parsed
+     */
+    std::shared_ptr<const LevelTemplate> parse(const std::string& filePath)
+        const
+    {
+        using Level = entities::Level;
+
+        std::ifstream file(filePath);
+
+        if (!file.is_open())
+        {
+            throw std::invalid_argument("Cannot open the given level file");
+        }
+
+        auto levelTemplate = std::make_shared<LevelTemplate>();
+
+        /* FIXME: if the minutes/seconds are not specified or partially
+           specified, the behavior is unmanaged */
+        std::string minutes, seconds;
+        getline(file, minutes, '\n');
+        getline(file, seconds, '\n');
+
+        levelTemplate->minutes =
+            static_cast<unsigned short>(std::stoi(minutes));
+        levelTemplate->seconds =
+            static_cast<unsigned short>(std::stoi(seconds));
+
+        /* the missing cells at the end of the file are empty cells */
+        std::string& types = levelTemplate->cells;
+        types.assign(Level::CELLS_PER_LEVEL, cells::EMPTY_CELL);
+        file.read(&types[0], Level::CELLS_PER_LEVEL);
+
+        for (
+            unsigned short floor {0};
+            floor <= Level::MAX_FLOOR;
+            floor++
+        )
+        {
+            bool playableFloor {false};
+
+            for (
+                unsigned short index = floor * Level::CELLS_PER_FLOOR;
+                index < (floor + 1) * Level::CELLS_PER_FLOOR;
+                index++
+            )
+            {
+                const cells::CellTraits& traits =
+                    cells::getCellTraits(types[index]);
+
+                if (traits.type == cells::DEPARTURE_CELL)
+                {
+                    levelTemplate->playerIndex = index;
+                }
+
+                levelTemplate->starsAmount +=
+                    traits.action == cells::CellAction::FIND_STAR;
+
+                /* the floors that only contain walls are not allocated, the
+                   floors that only contain walls and empty cells cannot be
+                   played */
+                if (!traits.blocking)
+                {
+                    levelTemplate->usedFloors[floor] = true;
+
+                    playableFloor |= traits.type != cells::EMPTY_CELL;
+                }
+            }
+
+            if (playableFloor)
+            {
+                levelTemplate->playableFloors++;
+            }
+        }
+
+        return levelTemplate;
+    }
+
+    std::unordered_map<std::string, Entry> templates;
+};
+
+/**
+ *
+ */
+LevelTemplatesManager::LevelTemplatesManager() noexcept :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+LevelTemplatesManager::~LevelTemplatesManager() noexcept = default;
+
+/**
+ *
+ */
+std::shared_ptr<const LevelTemplate> LevelTemplatesManager::getTemplate(
+    const std::string& filePath
+) const &
+{
+    struct stat status;
+
+    if (stat(filePath.c_str(), &status) != 0)
+    {
+        impl->templates.erase(filePath);
+
+        throw std::invalid_argument("Cannot open the given level file");
+    }
+
+    auto& entry = impl->templates[filePath];
+
+    if (
+        entry.levelTemplate == nullptr ||
+        entry.modificationSeconds != status.st_mtim.tv_sec ||
+        entry.modificationNanoseconds != status.st_mtim.tv_nsec ||
+        entry.size != status.st_size
+    )
+    {
+        /* the entry is only updated if the parsing succeeded */
+        entry.levelTemplate = impl->parse(filePath);
+        entry.modificationSeconds = status.st_mtim.tv_sec;
+        entry.modificationNanoseconds = status.st_mtim.tv_nsec;
+        entry.size = status.st_size;
+    }
+
+    return entry.levelTemplate;
+}
+
+}
+}
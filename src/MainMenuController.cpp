@@ -91,36 +91,28 @@ MainMenuController::MainMenuController(const utils::Context& context) :
         100.f
     );
 
-    std::unique_ptr<items::MenuItem> newGame(
-        std::make_unique<items::MenuItem>(
-            context,
-            "New game",
-            320.f
-        )
+    auto newGame = getArena().create<items::MenuItem>(
+        context,
+        "New game",
+        320.f
     );
 
-    std::unique_ptr<items::MenuItem> loadGame(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Load game",
-            450.f
-        )
+    auto loadGame = getArena().create<items::MenuItem>(
+        context,
+        "Load game",
+        450.f
     );
 
-    std::unique_ptr<items::MenuItem> editor (
-        std::make_unique<items::MenuItem>(
-            context,
-            "Editor",
-            580.f
-        )
+    auto editor = getArena().create<items::MenuItem>(
+        context,
+        "Editor",
+        580.f
     );
 
-    std::unique_ptr<items::MenuItem> exit(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Exit",
-            710.f
-        )
+    auto exit = getArena().create<items::MenuItem>(
+        context,
+        "Exit",
+        710.f
     );
 
     newGame->select(context);
@@ -164,14 +156,14 @@ const unsigned short& MainMenuController::render(
         impl->titleLastAnimationTime = context.getClockMillisecondsTime();
     }
 
-    context.getSfmlWindow().draw(impl->title);
-    context.getSfmlWindow().draw(impl->spriteGithub);
+    context.getRenderTarget().draw(impl->title);
+    context.getRenderTarget().draw(impl->spriteGithub);
 
     renderAllMenuItems(context);
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
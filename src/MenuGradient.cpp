@@ -27,9 +27,7 @@
 #include "Context.hpp"
 #include "window.hpp"
 #include "ColorsManager.hpp"
-
-#include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include "Gradient.hpp"
 
 namespace memoris
 {
@@ -41,30 +39,37 @@ class MenuGradient::Impl
 
 public:
 
-    Impl(const utils::Context& context)
+    Impl(const utils::Context& context) :
+        gradient(
+            context.getColorsManager().getColorBlack(),
+            GradientAxis::HORIZONTAL,
+            0.f,
+            window::HEIGHT,
+            {
+                {
+                    BACKGROUND_HORIZONTAL_POSITION - SIDE_WIDTH,
+                    TRANSPARENT_ALPHA
+                },
+                {
+                    BACKGROUND_HORIZONTAL_POSITION,
+                    OPAQUE_ALPHA
+                },
+                {
+                    BACKGROUND_HORIZONTAL_POSITION + BACKGROUND_WIDTH,
+                    OPAQUE_ALPHA
+                },
+                {
+                    BACKGROUND_HORIZONTAL_POSITION + BACKGROUND_WIDTH +
+                        SIDE_WIDTH,
+                    TRANSPARENT_ALPHA
+                }
+            }
+        )
     {
-        menuBackground.setSize(
-            sf::Vector2f(
-                BACKGROUND_WIDTH,
-                window::HEIGHT
-            )
-        );
-
-        menuBackground.setPosition(
-            BACKGROUND_HORIZONTAL_POSITION,
-            0.f
-        );
-        menuBackground.setFillColor(
-            context.getColorsManager().getColorBlack()
-        );
     }
 
-    sf::RectangleShape menuBackground;
-
-    /* we use pointers in order to accelerate the execution (no object copy);
-       we could have used move sementics, but SFML does not provides move
-       constructors for rectangle shapes */
-    std::vector<std::unique_ptr<sf::RectangleShape>> sidesLines;
+    /* the menu background and its two sides are one surface */
+    Gradient gradient;
 };
 
 /**
@@ -73,12 +78,6 @@ public:
 MenuGradient::MenuGradient(const utils::Context& context) :
     impl(std::make_unique<Impl>(context))
 {
-    /** the creation of the rectangles can be done directly inside the
-     * constructor of the class; in fact, there are many local variables
-     * to use to create these surfaces; in order to improve the code
-     * organization and clarity, we create these surfaces into a dedicated
-     * function. */
-    initializeGradientRectangles(context);
 }
 
 /**
@@ -91,70 +90,7 @@ MenuGradient::~MenuGradient() noexcept = default;
  */
 void MenuGradient::display(const utils::Context& context) const &
 {
-    context.getSfmlWindow().draw(impl->menuBackground);
-
-    // auto -> std::unique_ptr<sf::RectangleShape>&
-    for (auto& rectangle : impl->sidesLines)
-    {
-        context.getSfmlWindow().draw(*rectangle);
-    }
-}
-
-/**
- *
- */
-void MenuGradient::initializeGradientRectangles(
-    const utils::Context& context
-) &
-{
-    float horizontalPosition = LEFT_SIDE_HORIZONTAL_POSITION;
-    sf::Color effectColor = context.getColorsManager().getColorBlackCopy();
-
-    for (
-        unsigned short index = SURFACES_AMOUNT;
-        index > 0;
-        index--
-    )
-    {
-        // auto -> std::unique_ptr<sf::RectangleShape>
-        auto rectangle = std::make_unique<sf::RectangleShape>();
-
-        rectangle->setPosition(
-            horizontalPosition,
-            0.f
-        );
-
-        rectangle->setSize(
-            sf::Vector2f(
-                1.f,
-                window::HEIGHT
-            )
-        );
-
-        rectangle->setFillColor(effectColor);
-
-        if(index >= SIDE_SURFACES_AMOUNT)
-        {
-            horizontalPosition--;
-        }
-        else
-        {
-            horizontalPosition++;
-        }
-
-        if (index == SIDE_SURFACES_AMOUNT)
-        {
-            horizontalPosition = RIGHT_SIDE_HORIZONTAL_POSITION;
-            effectColor.a = DEFAULT_EFFECT_COLOR_ALPHA;
-        }
-
-        if (index % 2 == 0)
-        {
-            effectColor.a--;
-        }
-
-        impl->sidesLines.push_back(std::move(rectangle));
-    }
+    impl->gradient.render(context);
 }
 
 }
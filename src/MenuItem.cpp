@@ -159,7 +159,7 @@ void MenuItem::select(const utils::Context& context) const &
  */
 void MenuItem::display(const utils::Context& context) const &
 {
-    context.getSfmlWindow().draw(impl->text);
+    context.getRenderTarget().draw(impl->text);
 }
 
 }
@@ -89,7 +89,7 @@ MessageForeground::~MessageForeground() = default;
  */
 void MessageForeground::render(const utils::Context& context) const &
 {
-    context.getSfmlWindow().draw(impl->explanation);
+    context.getRenderTarget().draw(impl->explanation);
 }
 
 }
@@ -104,14 +104,14 @@ const unsigned short& NewGameController::render(
     const utils::Context& context
 ) &
 {
-    context.getSfmlWindow().draw(impl->title);
-    context.getSfmlWindow().draw(impl->explanation);
+    context.getRenderTarget().draw(impl->title);
+    context.getRenderTarget().draw(impl->explanation);
 
     impl->inputTextGameName.display(context);
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -159,5 +159,15 @@ const unsigned short& NewGameController::render(
     return nextControllerId;
 }
 
+/**
+ *
+ */
+const sf::Int32 NewGameController::getStaticDuration(
+    const utils::Context& context
+) const &
+{
+    return impl->inputTextGameName.getNextFlashDelay(context);
+}
+
 }
 }
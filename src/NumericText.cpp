@@ -0,0 +1,373 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file NumericText.cpp
+ * @package widgets
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "NumericText.hpp"
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Glyph.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+namespace memoris
+{
+namespace widgets
+{
+
+namespace
+{
+
+constexpr unsigned short DIGITS_AMOUNT {10};
+
+/* the index of the empty quad, displayed instead of the leading zeros */
+constexpr unsigned short BLANK_DIGIT {DIGITS_AMOUNT};
+
+constexpr unsigned short VERTICES_PER_QUAD {4};
+
+/**
+ * the quad of one glyph, relative to the pen position on the baseline
+ */
+struct GlyphQuad
+{
+    sf::FloatRect bounds;
+    sf::FloatRect textureRect;
+};
+
+/**
+ * one digit position of the text
+ */
+struct Slot
+{
+    size_t firstVertex;
+    float horizontalPosition;
+
+    /* the displayed digit, updated only when it changes */
+    unsigned short digit;
+};
+
+/**
+ * a sequence of digits of the same kind
+ */
+struct Field
+{
+    unsigned short firstSlot;
+    unsigned short slotsAmount;
+    bool zeroPadded;
+};
+
+}
+
+constexpr char NumericText::ZERO_PADDED_DIGIT;
+constexpr char NumericText::BLANK_PADDED_DIGIT;
+
+class NumericText::Impl
+{
+
+public:
+
+    Impl(
+        const sf::Font& textFont,
+        const unsigned int& size
+    ) :
+        font(textFont),
+        characterSize(size)
+    {
+    }
+
+    /**
+     * @brief sets the positions and the texture coordinates of one quad
+     *
+     * @param firstVertex the first vertex of the quad
+     * @param horizontalPosition the pen position
+     * @param quad the glyph to display
+     */
+    void setQuad(
+        const size_t& firstVertex,
+        const float& horizontalPosition,
+        const GlyphQuad& quad
+    ) noexcept
+    {
+        /* the baseline is placed as SFML does for sf::Text */
+        const float baseline = static_cast<float>(characterSize);
+
+        const float left = horizontalPosition + quad.bounds.left;
+        const float top = baseline + quad.bounds.top;
+        const float right = left + quad.bounds.width;
+        const float bottom = top + quad.bounds.height;
+
+        const sf::FloatRect& texture = quad.textureRect;
+        const float textureRight = texture.left + texture.width;
+        const float textureBottom = texture.top + texture.height;
+
+        vertices[firstVertex].position = sf::Vector2f(left, top);
+        vertices[firstVertex].texCoords =
+            sf::Vector2f(texture.left, texture.top);
+
+        vertices[firstVertex + 1].position = sf::Vector2f(right, top);
+        vertices[firstVertex + 1].texCoords =
+            sf::Vector2f(textureRight, texture.top);
+
+        vertices[firstVertex + 2].position = sf::Vector2f(right, bottom);
+        vertices[firstVertex + 2].texCoords =
+            sf::Vector2f(textureRight, textureBottom);
+
+        vertices[firstVertex + 3].position = sf::Vector2f(left, bottom);
+        vertices[firstVertex + 3].texCoords =
+            sf::Vector2f(texture.left, textureBottom);
+    }
+
+    /**
+     * @brief displays the given digit into the given slot if it is not
+     * already displayed
+     *
+     * @param slot the slot to update
+     * @param digit the digit, BLANK_DIGIT to display nothing
+     */
+    void setDigit(
+        Slot& slot,
+        const unsigned short& digit
+    ) noexcept
+    {
+        if (slot.digit == digit)
+        {
+            return;
+        }
+
+        slot.digit = digit;
+
+        setQuad(
+            slot.firstVertex,
+            slot.horizontalPosition,
+            digits[digit]
+        );
+    }
+
+    const sf::Font& font;
+
+    unsigned int characterSize;
+
+    sf::VertexArray vertices {sf::Quads};
+
+    /* the ten digits quads, followed by the empty quad */
+    std::array<GlyphQuad, DIGITS_AMOUNT + 1> digits;
+
+    std::vector<Slot> slots;
+    std::vector<Field> fields;
+
+    float width {0.f};
+};
+
+/**
+ *
+ */
+NumericText::NumericText(
+    const sf::Font& font,
+    const unsigned int& characterSize,
+    const sf::Color& color,
+    const std::string& layout
+) :
+    impl(std::make_unique<Impl>(font, characterSize))
+{
+    /* the digits slots all have the width of the widest digit, so the width
+       of the text never changes */
+    float digitAdvance {0.f};
+
+    for (unsigned short digit {0}; digit < DIGITS_AMOUNT; digit++)
+    {
+        digitAdvance = std::max(
+            digitAdvance,
+            static_cast<float>(
+                font.getGlyph('0' + digit, characterSize, false).advance
+            )
+        );
+    }
+
+    for (unsigned short digit {0}; digit < DIGITS_AMOUNT; digit++)
+    {
+        const sf::Glyph& glyph = font.getGlyph(
+            '0' + digit,
+            characterSize,
+            false
+        );
+
+        GlyphQuad& quad = impl->digits[digit];
+        quad.bounds = sf::FloatRect(glyph.bounds);
+        quad.textureRect = sf::FloatRect(glyph.textureRect);
+
+        /* every digit is centered into its slot */
+        quad.bounds.left += (digitAdvance - glyph.advance) / 2.f;
+    }
+
+    float horizontalPosition {0.f};
+    char previousCharacter {0};
+
+    for (const char& character : layout)
+    {
+        const size_t firstVertex = impl->vertices.getVertexCount();
+        impl->vertices.resize(firstVertex + VERTICES_PER_QUAD);
+
+        if (
+            character == ZERO_PADDED_DIGIT ||
+            character == BLANK_PADDED_DIGIT
+        )
+        {
+            if (character != previousCharacter)
+            {
+                impl->fields.push_back(
+                    Field {
+                        static_cast<unsigned short>(impl->slots.size()),
+                        0,
+                        character == ZERO_PADDED_DIGIT
+                    }
+                );
+            }
+
+            impl->fields.back().slotsAmount++;
+
+            impl->slots.push_back(
+                Slot {
+                    firstVertex,
+                    horizontalPosition,
+                    BLANK_DIGIT
+                }
+            );
+
+            horizontalPosition += digitAdvance;
+        }
+        else
+        {
+            const sf::Glyph& glyph = font.getGlyph(
+                static_cast<unsigned char>(character),
+                characterSize,
+                false
+            );
+
+            impl->setQuad(
+                firstVertex,
+                horizontalPosition,
+                GlyphQuad {
+                    sf::FloatRect(glyph.bounds),
+                    sf::FloatRect(glyph.textureRect)
+                }
+            );
+
+            horizontalPosition += glyph.advance;
+        }
+
+        previousCharacter = character;
+    }
+
+    impl->width = horizontalPosition;
+
+    for (size_t index {0}; index < impl->vertices.getVertexCount(); index++)
+    {
+        impl->vertices[index].color = color;
+    }
+
+    for (unsigned short field {0}; field < impl->fields.size(); field++)
+    {
+        setNumber(field, 0);
+    }
+}
+
+/**
+ *
+ */
+NumericText::~NumericText() noexcept = default;
+
+/**
+ *
+ */
+void NumericText::setNumber(
+    const unsigned short& field,
+    const unsigned int& number
+) const & noexcept
+{
+    if (field >= impl->fields.size())
+    {
+        return;
+    }
+
+    const Field& updatedField = impl->fields[field];
+    const unsigned short lastSlot =
+        updatedField.firstSlot + updatedField.slotsAmount - 1;
+
+    unsigned int remainingNumber = number;
+
+    /* the digits are written from the right */
+    for (
+        unsigned short offset {0};
+        offset < updatedField.slotsAmount;
+        offset++
+    )
+    {
+        const bool displayed =
+            updatedField.zeroPadded ||
+            remainingNumber != 0 ||
+            offset == 0;
+
+        impl->setDigit(
+            impl->slots[lastSlot - offset],
+            displayed ?
+                static_cast<unsigned short>(remainingNumber % 10) :
+                BLANK_DIGIT
+        );
+
+        remainingNumber /= 10;
+    }
+}
+
+/**
+ *
+ */
+const float NumericText::getWidth() const & noexcept
+{
+    return impl->width;
+}
+
+/**
+ *
+ */
+void NumericText::draw(
+    sf::RenderTarget& target,
+    sf::RenderStates states
+) const
+{
+    states.transform *= getTransform();
+
+    /* the page is requested on every draw, as sf::Text does: the page
+       texture of the font grows when new glyphs are added */
+    states.texture = &impl->font.getTexture(impl->characterSize);
+
+    target.draw(
+        impl->vertices,
+        states
+    );
+}
+
+}
+}
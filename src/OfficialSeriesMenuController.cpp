@@ -31,9 +31,12 @@
 #include "PlayingSerieManager.hpp"
 #include "MenuItem.hpp"
 #include "window.hpp"
+#include "ThumbnailsGenerator.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
 
 namespace memoris
 {
@@ -60,6 +63,9 @@ public:
 
     sf::Text title;
 
+    /* the thumbnail of the first level of the selected serie */
+    sf::Sprite thumbnail;
+
     /* we use a constant reference here because we want to be able to access
        the context in the selectMenuItem() method; but this method is
        override from AbstractMenuController and does not have any
@@ -78,52 +84,40 @@ OfficialSeriesMenuController::OfficialSeriesMenuController(
     AbstractMenuController(context),
     impl(std::make_unique<Impl>(context))
 {
-    std::unique_ptr<items::MenuItem> easy(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Easy",
-            270.f
-        )
+    auto easy = getArena().create<items::MenuItem>(
+        context,
+        "Easy",
+        270.f
     );
 
-    std::unique_ptr<items::MenuItem> medium(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Medium",
-            340.f
-        )
+    auto medium = getArena().create<items::MenuItem>(
+        context,
+        "Medium",
+        340.f
     );
 
-    std::unique_ptr<items::MenuItem> difficult(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Difficult",
-            410.f
-        )
+    auto difficult = getArena().create<items::MenuItem>(
+        context,
+        "Difficult",
+        410.f
     );
 
-    std::unique_ptr<items::MenuItem> hard(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Hard",
-            480.f
-        )
+    auto hard = getArena().create<items::MenuItem>(
+        context,
+        "Hard",
+        480.f
     );
 
-    std::unique_ptr<items::MenuItem> veryHard(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Very Hard",
-            560.f
-        )
+    auto veryHard = getArena().create<items::MenuItem>(
+        context,
+        "Very Hard",
+        560.f
     );
 
-    std::unique_ptr<items::MenuItem> hazardous(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Hazardous",
-            630.f
-        )
+    auto hazardous = getArena().create<items::MenuItem>(
+        context,
+        "Hazardous",
+        630.f
     );
 
     easy->select(context);
@@ -151,13 +145,38 @@ const unsigned short& OfficialSeriesMenuController::render(
     const utils::Context& context
 ) &
 {
-    context.getSfmlWindow().draw(impl->title);
+    context.getRenderTarget().draw(impl->title);
 
     renderAllMenuItems(context);
 
+    /* the thumbnail is requested when the serie is selected, it is displayed
+       as soon as it is generated */
+    const sf::Texture* texture =
+        context.getThumbnailsGenerator().getThumbnail(
+            "data/series/officials/" + getSerieNameByItemId() + ".serie"
+        );
+
+    if (texture != nullptr)
+    {
+        auto& thumbnail = impl->thumbnail;
+        thumbnail.setTexture(
+            *texture,
+            true
+        );
+        thumbnail.setPosition(
+            (
+                static_cast<float>(window::WIDTH) -
+                static_cast<float>(texture->getSize().x)
+            ) / 2,
+            THUMBNAIL_VERTICAL_POSITION
+        );
+
+        context.getRenderTarget().draw(thumbnail);
+    }
+
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
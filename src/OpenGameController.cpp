@@ -94,7 +94,7 @@ const unsigned short& OpenGameController::render(
     const utils::Context& context
 ) &
 {
-    context.getSfmlWindow().draw(impl->title);
+    context.getRenderTarget().draw(impl->title);
 
     impl->list.display(context);
 
@@ -102,7 +102,7 @@ const unsigned short& OpenGameController::render(
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -131,7 +131,7 @@ const unsigned short& OpenGameController::render(
 
             if (!gameName.empty())
             {
-                context.getGame().createGame(gameName);
+                context.getGame().loadGameFromFile(gameName);
 
                 expectedControllerId = SERIE_MAIN_MENU_CONTROLLER_ID;
 
@@ -60,6 +60,11 @@ public:
             50.f
         );
 
+        list.setThumbnailsFiles(
+            "data/series/personals/",
+            ".serie"
+        );
+
         list.setList(
             context,
             utils::getFilesFromDirectory("data/series/personals")
@@ -98,7 +103,7 @@ const unsigned short& PersonalSeriesMenuController::render(
     const utils::Context& context
 ) &
 {
-    context.getSfmlWindow().draw(impl->title);
+    context.getRenderTarget().draw(impl->title);
 
     impl->list.display(context);
 
@@ -106,7 +111,7 @@ const unsigned short& PersonalSeriesMenuController::render(
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -40,41 +40,18 @@ class PickUpEffect::Impl
 
 public:
 
-    Impl(
-        const sf::Texture& texture,
-        const float& hPosition,
-        const float& vPosition
-    )
-    {
-        sprite.setTexture(texture);
-        sprite.setPosition(
-            hPosition,
-            vPosition
-        );
-    }
-
     sf::Sprite sprite;
 
     sf::Uint32 animationLastUpdateTime {0};
 
-    sf::Uint8 alpha {255};
+    sf::Uint8 alpha {0};
 };
 
 /**
  *
  */
-PickUpEffect::PickUpEffect(
-    const sf::Texture& texture,
-    const float& hPosition,
-    const float& vPosition
-) :
-    impl(
-        std::make_unique<Impl>(
-            texture,
-            hPosition,
-            vPosition
-        )
-    )
+PickUpEffect::PickUpEffect() :
+    impl(std::make_unique<Impl>())
 {
 }
 
@@ -83,12 +60,38 @@ PickUpEffect::PickUpEffect(
  */
 PickUpEffect::~PickUpEffect() noexcept = default;
 
+/**
+ *
+ */
+void PickUpEffect::start(
+    const sf::Texture& texture,
+    const float& hPosition,
+    const float& vPosition
+) &
+{
+    auto& sprite = impl->sprite;
+
+    sprite.setTexture(texture);
+    sprite.setPosition(
+        hPosition,
+        vPosition
+    );
+    sprite.setScale(
+        1.f,
+        1.f
+    );
+    sprite.setColor(sf::Color::White);
+
+    impl->animationLastUpdateTime = 0;
+    impl->alpha = 255;
+}
+
 /**
  *
  */
 void PickUpEffect::render(const utils::Context& context) &
 {
-    context.getSfmlWindow().draw(impl->sprite);
+    context.getRenderTarget().draw(impl->sprite);
 
     if (
         context.getClockMillisecondsTime() -
@@ -26,24 +26,25 @@
 
 #include "PickUpEffect.hpp"
 
-#include <vector>
-#include <algorithm>
-#include <iterator>
+#include <array>
 
 namespace memoris
 {
 namespace utils
 {
 
+constexpr unsigned short PickUpEffectsManager::MAXIMUM_EFFECTS;
+
 class PickUpEffectsManager::Impl
 {
 
 public:
 
-    /* we store pointer to copy items into the container faster when creating
-       an effect (instead of a whole object copy); because they are smart
-       pointers, they are destroyed when the container is deleted */
-    std::vector<std::unique_ptr<PickUpEffect>> effects;
+    /* all the effects are created with the manager (when the level starts),
+       so finding an item never allocates anything */
+    std::array<PickUpEffect, MAXIMUM_EFFECTS> effects;
+
+    unsigned short nextEffect {0};
 };
 
 /**
@@ -68,13 +69,15 @@ void PickUpEffectsManager::addPickUpEffect(
     const float& vPosition
 ) &
 {
-    impl->effects.push_back(
-        std::make_unique<PickUpEffect>(
-            texture,
-            hPosition,
-            vPosition
-        )
+    auto& nextEffect = impl->nextEffect;
+
+    impl->effects[nextEffect].start(
+        texture,
+        hPosition,
+        vPosition
     );
+
+    nextEffect = (nextEffect + 1) % MAXIMUM_EFFECTS;
 }
 
 /**
@@ -83,14 +86,14 @@ void PickUpEffectsManager::addPickUpEffect(
 void PickUpEffectsManager::renderAllEffects(const utils::Context& context) &
 {
     for (auto& effect : impl->effects)
-        // auto -> std::unique_ptr<PickUpEffect>&
+        // auto -> PickUpEffect&
     {
-        if (effect->isFinished())
+        if (effect.isFinished())
         {
             continue;
         }
 
-        effect->render(context);
+        effect.render(context);
     }
 }
 
@@ -24,14 +24,13 @@
 
 #include "PlayingSerieManager.hpp"
 
-#include "SerieResult.hpp"
+#include "snapshots.hpp"
 
 #include <SFML/System/String.hpp>
 
 #include <fstream>
 #include <stdexcept>
 #include <queue>
-#include <array>
 
 namespace memoris
 {
@@ -59,7 +58,18 @@ public:
     std::string serieName;
     std::string serieType {OFFICIALS_SERIE_DIRECTORY_NAME};
 
-    std::array<entities::SerieResult, RESULTS_PER_SERIE_FILE_AMOUNT> results;
+    /* the last level popped from the queue, saved into the snapshots in
+       order to play it again when the serie is resumed */
+    std::string currentLevel;
+
+    /* the level section of the restored snapshot, applied on the next
+       created game controller */
+    snapshots::LevelSnapshot resumedLevel;
+
+    bool hasResumedLevel {false};
+
+    /* the playing time of every finished level of the serie */
+    std::vector<unsigned short> levelsTimes;
 };
 
 /**
@@ -113,6 +123,8 @@ const std::string PlayingSerieManager::getNextLevelName() & noexcept
     std::string level = impl->levels.front();
     impl->levels.pop();
 
+    impl->currentLevel = level;
+
     return level;
 }
 
@@ -132,9 +144,16 @@ void PlayingSerieManager::loadSerieFileContent(const std::string& name) &
 {
     /* clear the queue containing the levels of the previous serie */
     impl->levels = std::queue<std::string>();
+    impl->currentLevel.clear();
+    impl->hasResumedLevel = false;
 
     impl->levelIndex = 0;
 
+    /* the split times and the total time are the ones of the loaded serie
+       only, they become its result when the serie is finished */
+    impl->levelsTimes.clear();
+    impl->totalSeriePlayingTime = DEFAULT_SERIE_PLAYING_TIME;
+
     /* the name parameter is in the [personals|officials]/name format */
     std::ifstream file("data/series/" + name + ".serie");
     if (!file.is_open())
@@ -148,31 +167,18 @@ void PlayingSerieManager::loadSerieFileContent(const std::string& name) &
         throw std::invalid_argument("Cannot open the given serie file.");
     }
 
-    /* get the best results of the serie first */
-    for (entities::SerieResult& result : impl->results)
-    {
-        std::string& line = result.getString();
-
-        std::getline(file, line);
+    std::string level;
 
-        /* if the line is just a dot that means there is no record yet */
-        if (line == ".")
+    while(std::getline(file, level))
+    {
+        /* the series files created before the results store start with
+           three empty results lines ("."); the results are now saved by the
+           leaderboard manager */
+        if (level == ".")
         {
             continue;
         }
 
-        /* generates the total time of the SerieResult
-           object in integer format; not done directly
-           into a setter as we do not use setter to
-           set the std::string record attribute of the
-           SerieResult objects */
-        result.calculateTime();
-    }
-
-    std::string level;
-
-    while(std::getline(file, level))
-    {
         impl->levels.push(level);
     }
 
@@ -233,10 +239,10 @@ const unsigned short& PlayingSerieManager::getPlayingTime() const & noexcept
 /**
  *
  */
-const PlayingSerieManager::Results& PlayingSerieManager::getResults() const &
+const std::vector<unsigned short>& PlayingSerieManager::getLevelsTimes() const &
     noexcept
 {
-    return impl->results;
+    return impl->levelsTimes;
 }
 
 /**
@@ -273,6 +279,7 @@ void PlayingSerieManager::reinitialize() const & noexcept
     impl->watchingTime = DEFAULT_WATCHING_TIME;
     impl->lifes = DEFAULT_LIFES;
     impl->totalSeriePlayingTime = DEFAULT_SERIE_PLAYING_TIME;
+    impl->levelsTimes.clear();
 }
 
 /**
@@ -313,9 +320,108 @@ const sf::String PlayingSerieManager::fillMissingTimeDigits(
  */
 void PlayingSerieManager::addSecondsToPlayingSerieTime(
     const unsigned short& levelPlayingTime
-) const & noexcept
+) const &
 {
     impl->totalSeriePlayingTime += levelPlayingTime;
+    impl->levelsTimes.push_back(levelPlayingTime);
+}
+
+/**
+ *
+ */
+snapshots::SerieSnapshot PlayingSerieManager::getSnapshot(
+    const bool& includeCurrentLevel
+) const &
+{
+    snapshots::SerieSnapshot snapshot;
+
+    snapshot.serieName = impl->serieName;
+    snapshot.levelIndex = impl->levelIndex;
+    snapshot.lifes = impl->lifes;
+    snapshot.watchingTime = impl->watchingTime;
+    snapshot.totalPlayingTime = impl->totalSeriePlayingTime;
+    snapshot.levelsTimes = impl->levelsTimes;
+
+    if (includeCurrentLevel && !impl->currentLevel.empty())
+    {
+        snapshot.levels.push_back(impl->currentLevel);
+    }
+
+    /* std::queue cannot be iterated, a copy is emptied instead; the queue
+       contains only a few levels names */
+    std::queue<std::string> levels = impl->levels;
+
+    while (!levels.empty())
+    {
+        snapshot.levels.push_back(levels.front());
+        levels.pop();
+    }
+
+    return snapshot;
+}
+
+/**
+ *
+ */
+void PlayingSerieManager::restoreSnapshot(
+    const snapshots::SerieSnapshot& snapshot
+) &
+{
+    loadSerieFileContent(snapshot.serieName);
+
+    impl->levels = std::queue<std::string>();
+
+    for (const std::string& level : snapshot.levels)
+    {
+        impl->levels.push(level);
+    }
+
+    /* the serie name format is [personals|officials]/name */
+    setIsOfficialSerie(
+        snapshot.serieName.compare(
+            0,
+            std::string(OFFICIALS_SERIE_DIRECTORY_NAME).size(),
+            OFFICIALS_SERIE_DIRECTORY_NAME
+        ) == 0
+    );
+
+    impl->levelIndex = snapshot.levelIndex;
+    impl->lifes = snapshot.lifes;
+    impl->watchingTime = snapshot.watchingTime;
+    impl->totalSeriePlayingTime = snapshot.totalPlayingTime;
+    impl->levelsTimes = snapshot.levelsTimes;
+
+    impl->hasResumedLevel = snapshot.hasLevel;
+
+    if (snapshot.hasLevel)
+    {
+        impl->resumedLevel = snapshot.level;
+    }
+}
+
+/**
+ *
+ */
+const bool& PlayingSerieManager::hasResumedLevel() const & noexcept
+{
+    return impl->hasResumedLevel;
+}
+
+/**
+ *
+ */
+const snapshots::LevelSnapshot& PlayingSerieManager::getResumedLevel() const &
+    noexcept
+{
+    return impl->resumedLevel;
+}
+
+/**
+ *
+ */
+void PlayingSerieManager::clearResumedLevel() const & noexcept
+{
+    impl->hasResumedLevel = false;
 }
 
 }
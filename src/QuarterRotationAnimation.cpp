@@ -30,6 +30,8 @@
 #include "Cell.hpp"
 #include "ColorsManager.hpp"
 
+#include <array>
+
 namespace memoris
 {
 namespace animations
@@ -48,12 +50,21 @@ class QuarterRotationAnimation::Impl
 
 public:
 
+    /**
+     * the saved properties of one cell
+     */
+    struct SavedCell
+    {
+        char type;
+        bool visible;
+    };
+
     /* store one quarter of the cells floor that has to be saved when the
-       quarters rotation is applied; we could use a std::queue to automatically
-       free the space when the cells are written back on the floor, but the
-       container is directly deleted by the animation destructor when the
-       animation is finished */
-    std::vector<entities::Cell> temporaryCells;
+       quarters rotation is applied; only the type and the visibility of the
+       cells are saved, so the quarter is saved without any allocation and
+       without copying the whole cells */
+    std::array<SavedCell, CELLS_PER_FLOOR / 4> temporaryCells;
+    unsigned short savedCells {0};
 
     unsigned short translationSteps {0};
 };
@@ -61,9 +72,14 @@ public:
 /**
  *
  */
-QuarterRotationAnimation::QuarterRotationAnimation() noexcept :
-    impl(std::make_unique<Impl>())
+QuarterRotationAnimation::QuarterRotationAnimation() noexcept
 {
+    /* Impl is 64 saved cells of two bytes and two shorts, 132 bytes on every
+       platform, so its storage has no headroom */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The QuarterRotationAnimation implementation does not fit its storage"
+    );
 }
 
 /**
@@ -71,6 +87,15 @@ QuarterRotationAnimation::QuarterRotationAnimation() noexcept :
  */
 QuarterRotationAnimation::~QuarterRotationAnimation() noexcept = default;
 
+/**
+ *
+ */
+void QuarterRotationAnimation::resetAnimation(const utils::Context&) &
+{
+    impl->savedCells = 0;
+    impl->translationSteps = 0;
+}
+
 /**
  *
  */
@@ -158,7 +183,7 @@ void QuarterRotationAnimation::moveAllQuarters(
         )
         {
             direction = MovementDirection::DOWN;
-            level->getCells()[index]->moveInDirection(direction);
+            level->getCell(index).moveInDirection(direction);
         }
         else if (
             horizontalSide >= HALF_CELLS_PER_LINE and
@@ -166,7 +191,7 @@ void QuarterRotationAnimation::moveAllQuarters(
         )
         {
             direction = MovementDirection::UP;
-            level->getCells()[index]->moveInDirection(direction);
+            level->getCell(index).moveInDirection(direction);
         }
         else if (
             horizontalSide < HALF_CELLS_PER_LINE and
@@ -174,14 +199,14 @@ void QuarterRotationAnimation::moveAllQuarters(
         )
         {
             direction = MovementDirection::RIGHT;
-            level->getCells()[index]->moveInDirection(direction);
+            level->getCell(index).moveInDirection(direction);
         }
         else if (
             horizontalSide >= HALF_CELLS_PER_LINE and
             index < topSideLastIndex
         )
         {
-            level->getCells()[index]->moveInDirection(direction);
+            level->getCell(index).moveInDirection(direction);
         }
     }
 }
@@ -263,19 +288,19 @@ void QuarterRotationAnimation::updateCells(
 
     unsigned short index = floor * CELLS_PER_FLOOR;
 
-    for (const entities::Cell& cell : impl->temporaryCells)
+    for (
+        auto cell = impl->temporaryCells.cbegin();
+        cell != impl->temporaryCells.cbegin() + impl->savedCells;
+        cell++
+    )
     {
         const unsigned short newIndex = index + TOP_SIDE_LAST_CELL_INDEX;
 
-        level->getCells()[index]->resetPosition();
+        level->getCell(index).resetPosition();
 
-        level->getCells()[newIndex]->setType(
-            cell.getType()
-        );
+        level->getCell(newIndex).setType(cell->type);
 
-        level->getCells()[newIndex]->setIsVisible(
-            cell.isVisible()
-        );
+        level->getCell(newIndex).setIsVisible(cell->visible);
 
         if (index == level->getPlayerCellIndex())
         {
@@ -286,7 +311,7 @@ void QuarterRotationAnimation::updateCells(
             context,
             level,
             newIndex,
-            cell.isVisible()
+            cell->visible
         );
 
         index++;
@@ -316,14 +341,8 @@ void QuarterRotationAnimation::invertCells(
 {
     const unsigned short newIndex = index + modification;
 
-    /* TODO: this pointer declaration is bad regarding to C++14 specifications;
-       the problem is that level->getCells() is an array of unique pointers
-       that we cannot copy, and we do not want move the ownership either; as
-       we do not want do multiple calls like level->getCells()[newIndex] in the
-       body of this function, we just store the pointer this way; a solution
-       should be find for this */
-    entities::Cell* sourceCell = level->getCells().at(index).get();
-    entities::Cell* destinationCell = level->getCells().at(newIndex).get();
+    entities::Cell& sourceCell = level->getCell(index);
+    entities::Cell& destinationCell = level->getCell(newIndex);
 
     /* if the destination quarter is the top left one,
        save the old cells of this quarter */
@@ -332,7 +351,10 @@ void QuarterRotationAnimation::invertCells(
         newIndex % CELLS_PER_LINE < HALF_CELLS_PER_LINE
     )
     {
-        impl->temporaryCells.push_back(*destinationCell);
+        impl->temporaryCells[impl->savedCells++] = {
+            destinationCell.getType(),
+            destinationCell.isVisible()
+        };
     }
 
     if (index == level->getPlayerCellIndex())
@@ -340,16 +362,16 @@ void QuarterRotationAnimation::invertCells(
         updatedPlayerIndex = newIndex;
     }
 
-    destinationCell->setType(sourceCell->getType());
-    destinationCell->setIsVisible(sourceCell->isVisible());
+    destinationCell.setType(sourceCell.getType());
+    destinationCell.setIsVisible(sourceCell.isVisible());
 
-    sourceCell->resetPosition();
+    sourceCell.resetPosition();
 
     showOrHideCell(
         context,
         level,
         newIndex,
-        sourceCell->isVisible()
+        sourceCell.isVisible()
     );
 }
 
@@ -83,11 +83,11 @@ const unsigned short& RemoveGameController::render(
     const utils::Context& context
 ) &
 {
-    context.getSfmlWindow().draw(impl->message);
+    context.getRenderTarget().draw(impl->message);
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
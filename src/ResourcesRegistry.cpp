@@ -0,0 +1,437 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ResourcesRegistry.cpp
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "ResourcesRegistry.hpp"
+
+#include "Sound.hpp"
+#include "AssetPack.hpp"
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+namespace memoris
+{
+namespace managers
+{
+
+namespace
+{
+
+/* the textures are stored as RGBA pixels */
+constexpr size_t BYTES_PER_PIXEL {4};
+
+enum class ResourceType
+{
+    TEXTURE,
+    SOUND
+};
+
+/**
+ * one resource declared into the manifest
+ */
+struct Resource
+{
+    ResourceType type;
+
+    std::string path;
+
+    /* allocated once, so the sprites that use the texture always point to
+       the same object, even after an eviction */
+    std::unique_ptr<sf::Texture> texture;
+
+    std::unique_ptr<sounds::Sound> sound;
+
+    /* the amount of memory used by the loaded resource */
+    size_t size {0};
+
+    /* the collection generation during which the resource has been used for
+       the last time */
+    unsigned int lastUse {0};
+
+    unsigned short references {0};
+
+    bool loaded {false};
+};
+
+}
+
+class ResourcesRegistry::Impl
+{
+
+public:
+
+    Impl(const utils::AssetPack& assetPack) :
+        pack(assetPack)
+    {
+    }
+
+    /**
+     * @brief loads the given resource if it is not loaded yet and marks it
+     * as used during the current generation
+     *
+     * @param resource the resource to load
+     *
+     * @throw std::invalid_argument the texture file cannot be loaded
+     */
+    void load(Resource& resource)
+    {
+        resource.lastUse = generation;
+
+        if (resource.loaded)
+        {
+            return;
+        }
+
+        /* the loaded objects copy the asset content, so the pack data is
+           only read during the loading */
+        const utils::AssetView asset = pack.getAsset(resource.path);
+
+        if (resource.type == ResourceType::TEXTURE)
+        {
+            const bool loaded = asset.data != nullptr ?
+                resource.texture->loadFromMemory(asset.data, asset.size) :
+                resource.texture->loadFromFile(resource.path);
+
+            if (!loaded)
+            {
+                throw std::invalid_argument(
+                    "Cannot load texture : " + resource.path
+                );
+            }
+
+            const sf::Vector2u size = resource.texture->getSize();
+            resource.size = size.x * size.y * BYTES_PER_PIXEL;
+        }
+        else
+        {
+            resource.sound = asset.data != nullptr ?
+                std::make_unique<sounds::Sound>(asset.data, asset.size) :
+                std::make_unique<sounds::Sound>(resource.path);
+            resource.size = resource.sound->getMemorySize();
+        }
+
+        resource.loaded = true;
+        residentSize += resource.size;
+    }
+
+    /**
+     * @brief unloads the given resource
+     *
+     * @param resource the resource to unload
+     */
+    void unload(Resource& resource)
+    {
+        if (resource.type == ResourceType::TEXTURE)
+        {
+            /* the texture object is kept, only its pixels are released */
+            *resource.texture = sf::Texture();
+        }
+        else
+        {
+            resource.sound.reset();
+        }
+
+        residentSize -= resource.size;
+
+        resource.size = 0;
+        resource.loaded = false;
+    }
+
+    /**
+     * @brief returns the resource of the given handle
+     *
+     * @param handle the resource handle
+     *
+     * @return Resource&
+     *
+     * @throw std::invalid_argument the handle does not exist
+     */
+    Resource& getResource(const Handle& handle)
+    {
+        if (handle >= resources.size())
+        {
+            throw std::invalid_argument("Unknown resource handle");
+        }
+
+        return resources[handle];
+    }
+
+    const utils::AssetPack& pack;
+
+    std::vector<Resource> resources;
+
+    std::unordered_map<std::string, Handle> handles;
+
+    /* 0 if there is no budget, the resources are never evicted */
+    size_t budget {0};
+
+    size_t residentSize {0};
+
+    unsigned int generation {0};
+};
+
+/**
+ *
+ */
+ResourcesRegistry::ResourcesRegistry(
+    const std::string& manifestPath,
+    const utils::AssetPack& pack
+) :
+    impl(std::make_unique<Impl>(pack))
+{
+    const utils::AssetView asset = pack.getAsset(manifestPath);
+
+    std::istringstream packedManifest;
+    std::ifstream file;
+
+    if (asset.data != nullptr)
+    {
+        packedManifest.str(std::string(asset.data, asset.size));
+    }
+    else
+    {
+        file.open(manifestPath);
+
+        if (!file.is_open())
+        {
+            throw std::invalid_argument(
+                "Cannot open the resources manifest " + manifestPath
+            );
+        }
+    }
+
+    std::istream& manifest = asset.data != nullptr ?
+        static_cast<std::istream&>(packedManifest) :
+        static_cast<std::istream&>(file);
+
+    std::string line;
+
+    while (std::getline(manifest, line))
+    {
+        if (line.empty() || line.front() == '#')
+        {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        std::string kind;
+
+        stream >> kind;
+
+        if (kind == "budget")
+        {
+            if (!(stream >> impl->budget))
+            {
+                throw std::invalid_argument(
+                    "Invalid resources manifest line : " + line
+                );
+            }
+
+            continue;
+        }
+
+        std::string name;
+        Resource resource;
+
+        if (
+            !(stream >> name >> resource.path) ||
+            (kind != "texture" && kind != "sound") ||
+            impl->handles.find(name) != impl->handles.end()
+        )
+        {
+            throw std::invalid_argument(
+                "Invalid resources manifest line : " + line
+            );
+        }
+
+        if (kind == "texture")
+        {
+            resource.type = ResourceType::TEXTURE;
+            resource.texture = std::make_unique<sf::Texture>();
+        }
+        else
+        {
+            resource.type = ResourceType::SOUND;
+        }
+
+        impl->handles.emplace(
+            name,
+            static_cast<Handle>(impl->resources.size())
+        );
+
+        impl->resources.push_back(std::move(resource));
+    }
+}
+
+/**
+ *
+ */
+ResourcesRegistry::~ResourcesRegistry() noexcept = default;
+
+/**
+ *
+ */
+const ResourcesRegistry::Handle ResourcesRegistry::getHandle(
+    const std::string& name
+) const &
+{
+    const auto handle = impl->handles.find(name);
+
+    if (handle == impl->handles.end())
+    {
+        throw std::invalid_argument("Unknown resource : " + name);
+    }
+
+    return handle->second;
+}
+
+/**
+ *
+ */
+const bool ResourcesRegistry::hasResource(const std::string& name) const &
+noexcept
+{
+    return impl->handles.find(name) != impl->handles.end();
+}
+
+/**
+ *
+ */
+const sf::Texture& ResourcesRegistry::getTexture(const Handle& handle) const &
+{
+    Resource& resource = impl->getResource(handle);
+
+    if (resource.type != ResourceType::TEXTURE)
+    {
+        throw std::invalid_argument("The resource is not a texture");
+    }
+
+    impl->load(resource);
+
+    return *resource.texture;
+}
+
+/**
+ *
+ */
+void ResourcesRegistry::playSound(const Handle& handle) const & noexcept
+{
+    if (
+        handle >= impl->resources.size() ||
+        impl->resources[handle].type != ResourceType::SOUND
+    )
+    {
+        return;
+    }
+
+    Resource& resource = impl->resources[handle];
+
+    if (!resource.loaded)
+    {
+        return;
+    }
+
+    resource.lastUse = impl->generation;
+
+    resource.sound->play();
+}
+
+/**
+ *
+ */
+void ResourcesRegistry::acquire(const Handle& handle) const &
+{
+    Resource& resource = impl->getResource(handle);
+
+    impl->load(resource);
+
+    resource.references++;
+}
+
+/**
+ *
+ */
+void ResourcesRegistry::release(const Handle& handle) const & noexcept
+{
+    if (
+        handle < impl->resources.size() &&
+        impl->resources[handle].references != 0
+    )
+    {
+        impl->resources[handle].references--;
+    }
+}
+
+/**
+ *
+ */
+void ResourcesRegistry::collect() const &
+{
+    if (impl->budget != 0 && impl->residentSize > impl->budget)
+    {
+        std::vector<Resource*> candidates;
+
+        for (Resource& resource : impl->resources)
+        {
+            if (
+                resource.loaded &&
+                resource.references == 0 &&
+                resource.lastUse != impl->generation
+            )
+            {
+                candidates.push_back(&resource);
+            }
+        }
+
+        std::sort(
+            candidates.begin(),
+            candidates.end(),
+            [](const Resource* first, const Resource* second)
+            {
+                return first->lastUse < second->lastUse;
+            }
+        );
+
+        for (Resource* resource : candidates)
+        {
+            if (impl->residentSize <= impl->budget)
+            {
+                break;
+            }
+
+            impl->unload(*resource);
+        }
+    }
+
+    impl->generation++;
+}
+
+}
+}
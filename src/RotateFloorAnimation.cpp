@@ -52,8 +52,13 @@ public:
  */
 RotateFloorAnimation::RotateFloorAnimation(
     const short& movementDirection
-) noexcept : impl(std::make_unique<Impl>(movementDirection))
+) noexcept : impl(movementDirection)
 {
+    /* Impl is one short on every platform, so its storage has no headroom */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The RotateFloorAnimation implementation does not fit its storage"
+    );
 }
 
 /**
@@ -131,167 +136,14 @@ void RotateFloorAnimation::rotateCells(
     const unsigned short& floor
 ) &
 {
-    std::vector<std::vector<entities::Cell>> horizontalLines;
-
-    unsigned short playerColumn = 0,
-                   playerIndex = 0;
-
-    unsigned short destination = floor * 256 + 255;
-
-    if(impl->direction == -1)
-    {
-        destination = floor * 256 + 240;
-
-        for (
-            unsigned short lines = 0;
-            lines < 16;
-            lines++
-        )
-        {
-            std::vector<entities::Cell> line;
-
-            for (
-                unsigned short index = 0;
-                index < 16;
-                index++
-            )
-            {
-                entities::Cell cell(
-                    context,
-                    0.f,
-                    0.f,
-                    level->getCells()[lines * 16 + index]->getType()
-                );
-
-                cell.setIsVisible(
-                    level->getCells()[lines * 16 + index]->isVisible()
-                );
-
-                line.push_back((*level->getCells()[lines * 16 + index]));
-
-                if (lines * 16 + index == level->getPlayerCellIndex())
-                {
-                    playerColumn = lines;
-                    playerIndex = index;
-                }
-            }
-
-            horizontalLines.push_back(line);
-        }
-
-        for (unsigned short column = 0; column < 16; column++)
-        {
-            for (unsigned short index = 0; index < 16; index++)
-            {
-                level->getCells()[destination]->setType(
-                    horizontalLines[column][index].getType()
-                );
-
-                if (horizontalLines[column][index].isVisible())
-                {
-                    level->getCells()[destination]->show(context);
-                }
-                else
-                {
-                    level->getCells()[destination]->hide(context);
-                }
-
-                if (column == playerColumn && index == playerIndex)
-                {
-                    level->setPlayerCellIndex(destination);
-                }
-
-                if (destination >= 16)
-                {
-                    destination -= 16;
-                }
-            }
-
-            if (destination != 15)
-            {
-                destination += 241;
-            }
-        }
-    }
-    else
-    {
-        destination = floor * 256 + 255;
-
-        for (
-            unsigned short lines = 0;
-            lines < 16;
-            lines++
-        )
-        {
-            unsigned short offset = 0;
-
-            std::vector<entities::Cell> line;
-
-            for (
-                short index = 15;
-                index >= 0;
-                index--
-            )
-            {
-                entities::Cell cell(
-                    context,
-                    0.f,
-                    0.f,
-                    level->getCells()[lines * 16 + index]->getType()
-                );
-
-                cell.setIsVisible(
-                    level->getCells()[lines * 16 + index]->isVisible()
-                );
-
-                line.push_back((*level->getCells()[lines * 16 + index]));
-
-                if (lines * 16 + index == level->getPlayerCellIndex())
-                {
-                    playerColumn = lines;
-                    playerIndex = offset;
-                }
-
-                offset++;
-            }
-
-            horizontalLines.push_back(line);
-        }
-
-        for (short column = 0; column < 16; column++)
-        {
-            for (unsigned short index = 0; index < 16; index++)
-            {
-                level->getCells()[destination]->setType(
-                    horizontalLines[column][index].getType()
-                );
-
-                if (horizontalLines[column][index].isVisible())
-                {
-                    level->getCells()[destination]->show(context);
-                }
-                else
-                {
-                    level->getCells()[destination]->hide(context);
-                }
-
-                if (column == playerColumn && index == playerIndex)
-                {
-                    level->setPlayerCellIndex(destination);
-                }
-
-                if (destination >= 16)
-                {
-                    destination -= 16;
-                }
-            }
-
-            if (destination != 0)
-            {
-                destination += 239;
-            }
-        }
-    }
+    transformFloor(
+        context,
+        level,
+        floor,
+        impl->direction == -1 ?
+            transforms::FloorTransform::LEFT_ROTATION :
+            transforms::FloorTransform::RIGHT_ROTATION
+    );
 }
 
 }
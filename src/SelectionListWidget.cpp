@@ -29,12 +29,13 @@
 #include "FontsManager.hpp"
 #include "fonts.hpp"
 #include "TexturesManager.hpp"
+#include "ThumbnailsGenerator.hpp"
 
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Window/Mouse.hpp>
 
 namespace memoris
 {
@@ -51,7 +52,7 @@ public:
         const float& originHorizontalPosition
     ) :
         horizontalPosition(originHorizontalPosition),
-        window(context.getSfmlWindow())
+        window(context.getRenderTarget())
     {
         top.setPosition(
             horizontalPosition,
@@ -148,9 +149,14 @@ public:
 
     sf::Sprite arrowUp;
     sf::Sprite arrowDown;
+    sf::Sprite thumbnail;
 
     std::vector<sf::Text> texts;
 
+    /* empty if the items have no thumbnail */
+    std::string thumbnailsDirectory;
+    std::string thumbnailsExtension;
+
     /* signed because equals to -1 when nothing is selected */
     short selectorIndex {0};
 
@@ -180,7 +186,7 @@ public:
         255
     };
 
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
 };
 
 /**
@@ -191,12 +197,17 @@ SelectionListWidget::SelectionListWidget(
     const float& horizontalPosition
 ) :
     impl(
-        std::make_unique<Impl>(
-            context,
-            horizontalPosition
-        )
+        context,
+        horizontalPosition
     )
 {
+    /* Impl is 2712 bytes with SFML 2.5 and libstdc++ on 64 bits (five
+       rectangles, three sprites and the texts container); the storage keeps
+       a quarter of headroom for the other versions */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The SelectionListWidget implementation does not fit its storage"
+    );
 }
 
 /**
@@ -243,6 +254,42 @@ void SelectionListWidget::display(const utils::Context& context) &
         }
 
         impl->window.draw(*iterator);
+
+        if (impl->thumbnailsDirectory.empty())
+        {
+            continue;
+        }
+
+        /* the thumbnails are only requested for the displayed items, so they
+           are generated when the list is scrolled; nothing is displayed until
+           the thumbnail is generated */
+        const sf::Texture* texture =
+            context.getThumbnailsGenerator().getThumbnail(
+                impl->thumbnailsDirectory +
+                    iterator->getString().toAnsiString() +
+                    impl->thumbnailsExtension
+            );
+
+        if (texture == nullptr)
+        {
+            continue;
+        }
+
+        const sf::Vector2u dimensions = texture->getSize();
+
+        auto& thumbnail = impl->thumbnail;
+        thumbnail.setTexture(
+            *texture,
+            true
+        );
+        thumbnail.setPosition(
+            impl->horizontalPosition + WIDTH - THUMBNAIL_MARGIN -
+                static_cast<float>(dimensions.x),
+            itemVerticalPosition +
+                (ITEMS_SEPARATION - static_cast<float>(dimensions.y)) / 2
+        );
+
+        impl->window.draw(thumbnail);
     }
 
     selectArrowWhenMouseHover(
@@ -302,11 +349,10 @@ void SelectionListWidget::setList(
  */
 void SelectionListWidget::displaySelector(const utils::Context& context) &
 {
-    sf::Vector2i mousePosition = sf::Mouse::getPosition();
+    const sf::Vector2f mousePosition = context.getMousePosition();
 
-    /* explicit cast because sf::Mouse::getPosition() returns integers */
-    float mouseHorizontalPosition = static_cast<float>(mousePosition.x);
-    float mouseVerticalPosition = static_cast<float>(mousePosition.y);
+    const float& mouseHorizontalPosition = mousePosition.x;
+    const float& mouseVerticalPosition = mousePosition.y;
 
     const auto& texts = impl->texts;
 
@@ -349,6 +395,18 @@ void SelectionListWidget::displaySelector(const utils::Context& context) &
     impl->window.draw(impl->selector);
 }
 
+/**
+ *
+ */
+void SelectionListWidget::setThumbnailsFiles(
+    const std::string& directory,
+    const std::string& extension
+) const &
+{
+    impl->thumbnailsDirectory = directory;
+    impl->thumbnailsExtension = extension;
+}
+
 /**
  *
  */
@@ -375,7 +433,7 @@ void SelectionListWidget::selectArrowWhenMouseHover(
     bool& selected
 ) const &
 {
-    sf::Vector2<int> mousePosition = sf::Mouse::getPosition();
+    const sf::Vector2f mousePosition = context.getMousePosition();
 
     if (
         mousePosition.x > horizontalPosition and
@@ -39,6 +39,7 @@
 #include "InputTextWidget.hpp"
 #include "window.hpp"
 #include "files.hpp"
+#include "ThumbnailsGenerator.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
@@ -177,10 +178,10 @@ const unsigned short& SerieEditorController::render(
     }
     else
     {
-        context.getSfmlWindow().draw(impl->serieNameText);
-        context.getSfmlWindow().draw(impl->allLevels);
-        context.getSfmlWindow().draw(impl->serieLevels);
-        context.getSfmlWindow().draw(impl->explanations);
+        context.getRenderTarget().draw(impl->serieNameText);
+        context.getRenderTarget().draw(impl->allLevels);
+        context.getRenderTarget().draw(impl->serieLevels);
+        context.getRenderTarget().draw(impl->explanations);
 
         impl->buttonNew.display(context);
         impl->buttonSave.display(context);
@@ -193,7 +194,7 @@ const unsigned short& SerieEditorController::render(
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -226,7 +227,10 @@ const unsigned short& SerieEditorController::render(
                         break;
                     }
 
-                    saveSerieFile(serieNameText);
+                    saveSerieFile(
+                        context,
+                        serieNameText
+                    );
 
                     impl->serieNameText.setString(serieNameText);
 
@@ -301,7 +305,10 @@ const unsigned short& SerieEditorController::render(
                     {
                         const auto& serieName = impl->serieName;
 
-                        saveSerieFile(serieName);
+                        saveSerieFile(
+                            context,
+                            serieName
+                        );
 
                         impl->serieNameText.setString(serieName);
 
@@ -365,7 +372,33 @@ const unsigned short& SerieEditorController::render(
 /**
  *
  */
-void SerieEditorController::saveSerieFile(const std::string& name) const &
+const sf::Int32 SerieEditorController::getStaticDuration(
+    const utils::Context& context
+) const &
+{
+    if (impl->saveSerieForeground != nullptr)
+    {
+        return impl->saveSerieForeground->getInputTextWidget()
+            .getNextFlashDelay(context);
+    }
+
+    /* the thumbnails of the lists are displayed as soon as the workers have
+       generated them, even if the user does nothing */
+    if (context.getThumbnailsGenerator().hasPendingThumbnails())
+    {
+        return THUMBNAILS_POLLING_INTERVAL;
+    }
+
+    return STATIC_SCREEN;
+}
+
+/**
+ *
+ */
+void SerieEditorController::saveSerieFile(
+    const utils::Context& context,
+    const std::string& name
+) const &
 {
     std::ofstream file;
     utils::applyFailbitAndBadbitExceptions(file);
@@ -375,9 +408,6 @@ void SerieEditorController::saveSerieFile(const std::string& name) const &
         std::fstream::out
     );
 
-    /* write three empty best scores */
-    file << "." << std::endl << "." << std::endl << "." << std::endl;
-
     // const std::vector<sf::Text>&
     const auto& texts = impl->lists.getSerieLevelsList().getTexts();
 
@@ -385,6 +415,8 @@ void SerieEditorController::saveSerieFile(const std::string& name) const &
     {
         file << text.getString().toAnsiString() << std::endl;
     }
+
+    context.getThumbnailsGenerator().refresh();
 }
 
 /**
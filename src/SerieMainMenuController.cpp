@@ -31,21 +31,28 @@
 #include "MenuItem.hpp"
 #include "window.hpp"
 #include "Game.hpp"
+#include "PlayingSerieManager.hpp"
+#include "snapshots.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 
+#include <stdexcept>
+
 namespace memoris
 {
 namespace controllers
 {
 
+constexpr unsigned short SerieMainMenuController::RESUME_ITEM_INDEX;
+
 class SerieMainMenuController::Impl
 {
 
 public:
 
-    Impl(const utils::Context& context)
+    Impl(const utils::Context& context) :
+        contextReference(context)
     {
         title.setFont(context.getFontsManager().getTitleFont());
         title.setString("Series");
@@ -71,6 +78,14 @@ public:
 
     sf::Text title;
     sf::Text gameName;
+
+    /* true if the game has an in-progress serie; the resume item is only
+       displayed in that case, so the items indices are shifted */
+    bool resumable {false};
+
+    /* required to restore the in-progress serie from selectMenuItem() (see
+       OfficialSeriesMenuController for the same solution) */
+    const utils::Context& contextReference;
 };
 
 /**
@@ -82,43 +97,53 @@ SerieMainMenuController::SerieMainMenuController(
     AbstractMenuController(context),
     impl(std::make_unique<Impl>(context))
 {
-    std::unique_ptr<items::MenuItem> officialSeries(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Official series",
-            250.f
-        )
+    auto officialSeries = getArena().create<items::MenuItem>(
+        context,
+        "Official series",
+        250.f
     );
 
-    std::unique_ptr<items::MenuItem> personalSeries(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Personal series",
-            350.f
-        )
+    auto personalSeries = getArena().create<items::MenuItem>(
+        context,
+        "Personal series",
+        350.f
     );
 
-    std::unique_ptr<items::MenuItem> back(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Back",
-            650.f
-        )
+    const auto& game = context.getGame();
+
+    impl->resumable =
+        game.hasSnapshot() &&
+        !game.getSnapshot().levels.empty();
+
+    auto back = getArena().create<items::MenuItem>(
+        context,
+        "Back",
+        650.f
     );
 
-    std::unique_ptr<items::MenuItem> remove(
-        std::make_unique<items::MenuItem>(
-            context,
-            "Remove",
-            810.f,
-            items::MenuItem::HorizontalPosition::Left
-        )
+    auto remove = getArena().create<items::MenuItem>(
+        context,
+        "Remove",
+        810.f,
+        items::MenuItem::HorizontalPosition::Left
     );
 
     officialSeries->select(context);
 
     addMenuItem(std::move(officialSeries));
     addMenuItem(std::move(personalSeries));
+
+    if (impl->resumable)
+    {
+        auto resume = getArena().create<items::MenuItem>(
+            context,
+            "Resume",
+            450.f
+        );
+
+        addMenuItem(std::move(resume));
+    }
+
     addMenuItem(std::move(back));
     addMenuItem(std::move(remove));
 }
@@ -135,15 +160,15 @@ const unsigned short& SerieMainMenuController::render(
     const utils::Context& context
 ) &
 {
-    context.getSfmlWindow().draw(impl->title);
+    context.getRenderTarget().draw(impl->title);
 
     renderAllMenuItems(context);
 
-    context.getSfmlWindow().draw(impl->gameName);
+    context.getRenderTarget().draw(impl->gameName);
 
     nextControllerId = animateScreenTransition(context);
 
-    while (context.getSfmlWindow().pollEvent(event))
+    while (pollEvent(context))
     {
         switch(event.type)
         {
@@ -196,7 +221,16 @@ const unsigned short& SerieMainMenuController::render(
  */
 void SerieMainMenuController::selectMenuItem() & noexcept
 {
-    switch(getSelectorPosition())
+    unsigned short position = getSelectorPosition();
+
+    /* the resume item has the index 2 when it is displayed; the next items
+       indices are the same in both cases */
+    if (!impl->resumable && position >= RESUME_ITEM_INDEX)
+    {
+        position++;
+    }
+
+    switch(position)
     {
     case 0:
     {
@@ -210,13 +244,34 @@ void SerieMainMenuController::selectMenuItem() & noexcept
 
         break;
     }
-    case 2:
+    case RESUME_ITEM_INDEX:
     {
-        expectedControllerId = MAIN_MENU_CONTROLLER_ID;
+        const auto& context = impl->contextReference;
+
+        try
+        {
+            context.getPlayingSerieManager().restoreSnapshot(
+                context.getGame().getSnapshot()
+            );
+
+            expectedControllerId = GAME_CONTROLLER_ID;
+        }
+        catch(std::invalid_argument&)
+        {
+            /* the serie file has been removed or renamed since the snapshot
+               has been saved */
+            expectedControllerId = OPEN_FILE_ERROR_CONTROLLER_ID;
+        }
 
         break;
     }
     case 3:
+    {
+        expectedControllerId = MAIN_MENU_CONTROLLER_ID;
+
+        break;
+    }
+    case 4:
     {
         expectedControllerId = REMOVE_GAME_CONTROLLER_ID;
 
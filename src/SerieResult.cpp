@@ -31,26 +31,85 @@ namespace memoris
 namespace entities
 {
 
+namespace
+{
+
+constexpr unsigned short SECONDS_IN_ONE_MINUTE {60};
+
+/**
+ * @brief returns the given number with two digits at least
+ *
+ * @param value the number to convert
+ *
+ * @return const std::string
+ */
+const std::string getTwoDigitsString(const unsigned short& value)
+{
+    std::string digits = std::to_string(value);
+
+    if (value < 10)
+    {
+        digits.insert(0, "0");
+    }
+
+    return digits;
+}
+
+}
+
 class SerieResult::Impl
 {
 
 public :
 
-    std::string record;
+    Impl(
+        const std::string& name,
+        const unsigned short& time,
+        const std::vector<unsigned short>& levelsTimes
+    ) :
+        name(name),
+        levelsTimes(levelsTimes),
+        time(time)
+    {
+    }
+
+    std::string name;
+
+    std::vector<unsigned short> levelsTimes;
 
-    /* this variable is used to generate the ranking; that's why both of the
-       record string and calculated time are wrapped into this class */
-    unsigned short time {0};
+    /* this variable is used to generate the ranking; the results are sorted
+       according to this value */
+    unsigned short time;
 };
 
 /**
  *
  */
-SerieResult::SerieResult() noexcept :
-    impl(std::make_unique<Impl>())
+SerieResult::SerieResult(
+    const std::string& name,
+    const unsigned short& time,
+    const std::vector<unsigned short>& levelsTimes
+) :
+    impl(
+        std::make_unique<Impl>(
+            name,
+            time,
+            levelsTimes
+        )
+    )
 {
 }
 
+/**
+ *
+ */
+SerieResult::SerieResult(SerieResult&& other) noexcept = default;
+
+/**
+ *
+ */
+SerieResult& SerieResult::operator=(SerieResult&& other) noexcept = default;
+
 /**
  *
  */
@@ -59,50 +118,36 @@ SerieResult::~SerieResult() noexcept = default;
 /**
  *
  */
-std::string& SerieResult::getString() const & noexcept
+const std::string& SerieResult::getName() const & noexcept
 {
-    return impl->record;
+    return impl->name;
 }
 
 /**
  *
  */
-void SerieResult::calculateTime() const &
+const unsigned short& SerieResult::getTime() const & noexcept
 {
-    const std::string& record = impl->record;
-    const size_t nameTimeSeparatorIndex = record.find(",");
-
-    if (nameTimeSeparatorIndex == std::string::npos)
-    {
-        /* TODO: #949 we throw std::invalid_argument as it is caught later 
-           during serie loading process; this force the error controller to be
-           displayed instead but the error message is always the same; we
-           should use the invalid_argument message we set here in order to
-           give more details to the user */
-        throw std::invalid_argument("Incorrect serie file format.");
-    }
-
-    /* only keep string content after the comma (only time information) */
-    std::string timeString = record.substr(nameTimeSeparatorIndex + 1);
-
-    const size_t minutesSecondsSeparatorIndex = timeString.find(":");
-
-    if (minutesSecondsSeparatorIndex == std::string::npos)
-    {
-        /* TODO: #949 */
-        throw std::invalid_argument("Incorrect serie file format.");
-    }
-
-    std::string minutesString = timeString.substr(
-        0,
-        minutesSecondsSeparatorIndex
-    );
+    return impl->time;
+}
 
-    std::string secondsString = timeString.substr(
-        minutesSecondsSeparatorIndex + 1
-    );
+/**
+ *
+ */
+const std::vector<unsigned short>& SerieResult::getLevelsTimes() const &
+    noexcept
+{
+    return impl->levelsTimes;
+}
 
-    impl->time = std::stoi(secondsString) + 60 * std::stoi(minutesString);
+/**
+ *
+ */
+const std::string SerieResult::getString() const &
+{
+    return impl->name + " " +
+        getTwoDigitsString(impl->time / SECONDS_IN_ONE_MINUTE) + ":" +
+        getTwoDigitsString(impl->time % SECONDS_IN_ONE_MINUTE);
 }
 
 }
@@ -39,15 +39,20 @@ Sound::Sound(const std::string& path) noexcept :
 sound(nullptr),
       buffer(std::make_unique<sf::SoundBuffer>())
 {
-    if(buffer->loadFromFile("res/sounds/" + path + ".wav"))
-    {
-        sound = std::make_unique<sf::Sound>();
-        sound->setBuffer(*buffer);
-    }
-    else
-    {
-        buffer.reset();
-    }
+    attachBuffer(buffer->loadFromFile(path));
+}
+
+/**
+ *
+ */
+Sound::Sound(
+    const void* data,
+    const size_t& size
+) noexcept :
+sound(nullptr),
+      buffer(std::make_unique<sf::SoundBuffer>())
+{
+    attachBuffer(buffer->loadFromMemory(data, size));
 }
 
 /**
@@ -66,5 +71,34 @@ void Sound::play() const noexcept
     }
 }
 
+/**
+ *
+ */
+void Sound::attachBuffer(const bool& loaded) noexcept
+{
+    if(loaded)
+    {
+        sound = std::make_unique<sf::Sound>();
+        sound->setBuffer(*buffer);
+    }
+    else
+    {
+        buffer.reset();
+    }
+}
+
+/**
+ *
+ */
+const size_t Sound::getMemorySize() const noexcept
+{
+    if (buffer == nullptr)
+    {
+        return 0;
+    }
+
+    return buffer->getSampleCount() * sizeof(sf::Int16);
+}
+
 }
 }
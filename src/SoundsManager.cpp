@@ -27,51 +27,118 @@
 
 #include "SoundsManager.hpp"
 
-#include "Sound.hpp"
+#include "ResourcesRegistry.hpp"
+
+#include <array>
 
 namespace memoris
 {
 namespace managers
 {
 
+namespace
+{
+
+constexpr unsigned short SOUNDS_AMOUNT {12};
+
+}
+
 class SoundsManager::Impl
 {
 
 public:
 
-    sounds::Sound moveSelectorSound {"001"};
-    sounds::Sound screenTransitionSound {"002"};
-    sounds::Sound hideLevelSound {"003"};
-    sounds::Sound foundStarSound {"004"};
-    sounds::Sound foundLifeOrTimeSound {"005"};
-    sounds::Sound foundDeadOrLessTimeSound {"006"};
-    sounds::Sound collisionSound {"007"};
-    sounds::Sound floorSwitchSound {"008"};
-    sounds::Sound timeOverSound {"009"};
-    sounds::Sound mirrorAnimationSound {"010"};
-    sounds::Sound winLevelSound {"011"};
-    sounds::Sound floorMovementAnimationSound {"012"};
+    Impl(const ResourcesRegistry& resourcesRegistry) :
+        registry(resourcesRegistry)
+    {
+    }
+
+    /**
+     * @brief returns the handles of all the sounds
+     *
+     * @return const std::array<ResourcesRegistry::Handle, SOUNDS_AMOUNT>
+     */
+    const std::array<ResourcesRegistry::Handle, SOUNDS_AMOUNT> getHandles()
+        const & noexcept
+    {
+        return {{
+            moveSelectorSound,
+            screenTransitionSound,
+            hideLevelSound,
+            foundStarSound,
+            foundLifeOrTimeSound,
+            foundDeadOrLessTimeSound,
+            collisionSound,
+            floorSwitchSound,
+            timeOverSound,
+            mirrorAnimationSound,
+            winLevelSound,
+            floorMovementAnimationSound
+        }};
+    }
+
+    const ResourcesRegistry& registry;
+
+    ResourcesRegistry::Handle moveSelectorSound;
+    ResourcesRegistry::Handle screenTransitionSound;
+    ResourcesRegistry::Handle hideLevelSound;
+    ResourcesRegistry::Handle foundStarSound;
+    ResourcesRegistry::Handle foundLifeOrTimeSound;
+    ResourcesRegistry::Handle foundDeadOrLessTimeSound;
+    ResourcesRegistry::Handle collisionSound;
+    ResourcesRegistry::Handle floorSwitchSound;
+    ResourcesRegistry::Handle timeOverSound;
+    ResourcesRegistry::Handle mirrorAnimationSound;
+    ResourcesRegistry::Handle winLevelSound;
+    ResourcesRegistry::Handle floorMovementAnimationSound;
 };
 
 /**
  *
  */
-SoundsManager::SoundsManager() noexcept :
-impl(std::make_unique<Impl>())
-{
+SoundsManager::SoundsManager(const ResourcesRegistry& registry) :
+    impl(std::make_unique<Impl>(registry))
+{
+    impl->moveSelectorSound = registry.getHandle("moveSelector");
+    impl->screenTransitionSound = registry.getHandle("screenTransition");
+    impl->hideLevelSound = registry.getHandle("hideLevel");
+    impl->foundStarSound = registry.getHandle("foundStar");
+    impl->foundLifeOrTimeSound = registry.getHandle("foundLifeOrTime");
+    impl->foundDeadOrLessTimeSound = registry.getHandle("foundDeadOrLessTime");
+    impl->collisionSound = registry.getHandle("collision");
+    impl->floorSwitchSound = registry.getHandle("floorSwitch");
+    impl->timeOverSound = registry.getHandle("timeOver");
+    impl->mirrorAnimationSound = registry.getHandle("mirrorAnimation");
+    impl->winLevelSound = registry.getHandle("winLevel");
+    impl->floorMovementAnimationSound =
+        registry.getHandle("floorMovementAnimation");
+
+    /* the sounds are played during the levels, they are all loaded now and
+       never evicted, so no sound is read and decoded in the middle of a
+       frame */
+    for (const ResourcesRegistry::Handle& handle : impl->getHandles())
+    {
+        registry.acquire(handle);
+    }
 }
 
 /**
  *
  */
-SoundsManager::~SoundsManager() noexcept = default;
+SoundsManager::~SoundsManager() noexcept
+{
+    for (const ResourcesRegistry::Handle& handle : impl->getHandles())
+    {
+        impl->registry.release(handle);
+    }
+}
 
 /**
  *
  */
 void SoundsManager::playMoveSelectorSound() const & noexcept
 {
-    impl->moveSelectorSound.play();
+    impl->registry.playSound(impl->moveSelectorSound);
 }
 
 /**
@@ -79,7 +146,7 @@ void SoundsManager::playMoveSelectorSound() const & noexcept
  */
 void SoundsManager::playScreenTransitionSound() const & noexcept
 {
-    impl->screenTransitionSound.play();
+    impl->registry.playSound(impl->screenTransitionSound);
 }
 
 /**
@@ -87,7 +154,7 @@ void SoundsManager::playScreenTransitionSound() const & noexcept
  */
 void SoundsManager::playHideLevelSound() const & noexcept
 {
-    impl->hideLevelSound.play();
+    impl->registry.playSound(impl->hideLevelSound);
 }
 
 /**
@@ -95,7 +162,7 @@ void SoundsManager::playHideLevelSound() const & noexcept
  */
 void SoundsManager::playFoundStarSound() const & noexcept
 {
-    impl->foundStarSound.play();
+    impl->registry.playSound(impl->foundStarSound);
 }
 
 /**
@@ -103,7 +170,7 @@ void SoundsManager::playFoundStarSound() const & noexcept
  */
 void SoundsManager::playFoundLifeOrTimeSound() const & noexcept
 {
-    impl->foundLifeOrTimeSound.play();
+    impl->registry.playSound(impl->foundLifeOrTimeSound);
 }
 
 /**
@@ -111,7 +178,7 @@ void SoundsManager::playFoundLifeOrTimeSound() const & noexcept
  */
 void SoundsManager::playFoundDeadOrLessTimeSound() const & noexcept
 {
-    impl->foundDeadOrLessTimeSound.play();
+    impl->registry.playSound(impl->foundDeadOrLessTimeSound);
 }
 
 /**
@@ -119,7 +186,7 @@ void SoundsManager::playFoundDeadOrLessTimeSound() const & noexcept
  */
 void SoundsManager::playCollisionSound() const & noexcept
 {
-    impl->collisionSound.play();
+    impl->registry.playSound(impl->collisionSound);
 }
 
 /**
@@ -127,7 +194,7 @@ void SoundsManager::playCollisionSound() const & noexcept
  */
 void SoundsManager::playFloorSwitchSound() const & noexcept
 {
-    impl->floorSwitchSound.play();
+    impl->registry.playSound(impl->floorSwitchSound);
 }
 
 /**
@@ -135,7 +202,7 @@ void SoundsManager::playFloorSwitchSound() const & noexcept
  */
 void SoundsManager::playTimeOverSound() const & noexcept
 {
-    impl->timeOverSound.play();
+    impl->registry.playSound(impl->timeOverSound);
 }
 
 /**
@@ -143,7 +210,7 @@ void SoundsManager::playTimeOverSound() const & noexcept
  */
 void SoundsManager::playMirrorAnimationSound() const & noexcept
 {
-    impl->mirrorAnimationSound.play();
+    impl->registry.playSound(impl->mirrorAnimationSound);
 }
 
 /**
@@ -151,7 +218,7 @@ void SoundsManager::playMirrorAnimationSound() const & noexcept
  */
 void SoundsManager::playWinLevelSound() const & noexcept
 {
-    impl->winLevelSound.play();
+    impl->registry.playSound(impl->winLevelSound);
 }
 
 /**
@@ -160,7 +227,7 @@ void SoundsManager::playWinLevelSound() const & noexcept
 void SoundsManager::playFloorMovementAnimationSound() const &
 noexcept
 {
-    impl->floorMovementAnimationSound.play();
+    impl->registry.playSound(impl->floorMovementAnimationSound);
 }
 
 }
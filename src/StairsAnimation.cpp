@@ -37,16 +37,22 @@ namespace animations
 /**
  *
  */
-StairsAnimation::StairsAnimation(
-    const utils::Context& context,
-    const short& dir
-) :
+StairsAnimation::StairsAnimation(const short& dir) noexcept :
     direction(dir)
 {
+}
+
+/**
+ *
+ */
+void StairsAnimation::resetAnimation(const utils::Context& context) &
+{
+    transformation = 0;
+    cellsTransparency = 255.f;
+
     /* this animation is a simple waiting period; in order to wait the
        appropriated time, we just save the current time once before the
-       waiting period; if the animation just started, the last animation
-       update time is equal to 0 */
+       waiting period */
     lastAnimationUpdateTime = context.getClockMillisecondsTime();
 }
 
@@ -24,9 +24,7 @@
 
 #include "TexturesManager.hpp"
 
-#include <SFML/Graphics/Texture.hpp>
-
-#include <stdexcept>
+#include "ResourcesRegistry.hpp"
 
 namespace memoris
 {
@@ -38,46 +36,53 @@ class TexturesManager::Impl
 
 public:
 
-    sf::Texture cursorTexture;
-    sf::Texture githubTexture;
-    sf::Texture starTexture;
-    sf::Texture lifeTexture;
-    sf::Texture targetTexture;
-    sf::Texture timeTexture;
-    sf::Texture floorTexture;
-    sf::Texture newTexture;
-    sf::Texture openTexture;
-    sf::Texture saveTexture;
-    sf::Texture exitTexture;
-    sf::Texture testTexture;
-    sf::Texture arrowUpTexture;
-    sf::Texture arrowDownTexture;
-    sf::Texture scrollArrowDownTexture;
-    sf::Texture scrollArrowUpTexture;
+    Impl(const ResourcesRegistry& resourcesRegistry) :
+        registry(resourcesRegistry)
+    {
+    }
+
+    const ResourcesRegistry& registry;
+
+    ResourcesRegistry::Handle cursorTexture;
+    ResourcesRegistry::Handle githubTexture;
+    ResourcesRegistry::Handle starTexture;
+    ResourcesRegistry::Handle lifeTexture;
+    ResourcesRegistry::Handle targetTexture;
+    ResourcesRegistry::Handle timeTexture;
+    ResourcesRegistry::Handle floorTexture;
+    ResourcesRegistry::Handle newTexture;
+    ResourcesRegistry::Handle openTexture;
+    ResourcesRegistry::Handle saveTexture;
+    ResourcesRegistry::Handle exitTexture;
+    ResourcesRegistry::Handle testTexture;
+    ResourcesRegistry::Handle arrowUpTexture;
+    ResourcesRegistry::Handle arrowDownTexture;
+    ResourcesRegistry::Handle scrollArrowDownTexture;
+    ResourcesRegistry::Handle scrollArrowUpTexture;
 };
 
 /**
  *
  */
-TexturesManager::TexturesManager() :
-    impl(std::make_unique<Impl>())
+TexturesManager::TexturesManager(const ResourcesRegistry& registry) :
+    impl(std::make_unique<Impl>(registry))
 {
-    loadTexture(impl->githubTexture, "fork-me");
-    loadTexture(impl->starTexture, "star");
-    loadTexture(impl->lifeTexture, "life");
-    loadTexture(impl->targetTexture, "target");
-    loadTexture(impl->timeTexture, "timer");
-    loadTexture(impl->floorTexture, "floor");
-    loadTexture(impl->newTexture, "new");
-    loadTexture(impl->openTexture, "open");
-    loadTexture(impl->saveTexture, "save");
-    loadTexture(impl->cursorTexture, "cursor");
-    loadTexture(impl->exitTexture, "exit");
-    loadTexture(impl->testTexture, "test");
-    loadTexture(impl->arrowUpTexture, "up");
-    loadTexture(impl->arrowDownTexture, "down");
-    loadTexture(impl->scrollArrowDownTexture, "scroll_down");
-    loadTexture(impl->scrollArrowUpTexture, "scroll_up");
+    impl->githubTexture = registry.getHandle("github");
+    impl->starTexture = registry.getHandle("star");
+    impl->lifeTexture = registry.getHandle("life");
+    impl->targetTexture = registry.getHandle("target");
+    impl->timeTexture = registry.getHandle("time");
+    impl->floorTexture = registry.getHandle("floor");
+    impl->newTexture = registry.getHandle("new");
+    impl->openTexture = registry.getHandle("open");
+    impl->saveTexture = registry.getHandle("save");
+    impl->cursorTexture = registry.getHandle("cursor");
+    impl->exitTexture = registry.getHandle("exit");
+    impl->testTexture = registry.getHandle("test");
+    impl->arrowUpTexture = registry.getHandle("arrowUp");
+    impl->arrowDownTexture = registry.getHandle("arrowDown");
+    impl->scrollArrowDownTexture = registry.getHandle("scrollArrowDown");
+    impl->scrollArrowUpTexture = registry.getHandle("scrollArrowUp");
 }
 
 /**
@@ -88,144 +93,129 @@ TexturesManager::~TexturesManager() noexcept = default;
 /**
  *
  */
-const sf::Texture& TexturesManager::getGithubTexture() const & noexcept
+const sf::Texture& TexturesManager::getGithubTexture() const &
 {
-    return impl->githubTexture;
+    return impl->registry.getTexture(impl->githubTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getStarTexture() const & noexcept
+const sf::Texture& TexturesManager::getStarTexture() const &
 {
-    return impl->starTexture;
+    return impl->registry.getTexture(impl->starTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getLifeTexture() const & noexcept
+const sf::Texture& TexturesManager::getLifeTexture() const &
 {
-    return impl->lifeTexture;
+    return impl->registry.getTexture(impl->lifeTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getTargetTexture() const & noexcept
+const sf::Texture& TexturesManager::getTargetTexture() const &
 {
-    return impl->targetTexture;
+    return impl->registry.getTexture(impl->targetTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getTimeTexture() const & noexcept
+const sf::Texture& TexturesManager::getTimeTexture() const &
 {
-    return impl->timeTexture;
+    return impl->registry.getTexture(impl->timeTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getFloorTexture() const & noexcept
+const sf::Texture& TexturesManager::getFloorTexture() const &
 {
-    return impl->floorTexture;
+    return impl->registry.getTexture(impl->floorTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getNewTexture() const & noexcept
+const sf::Texture& TexturesManager::getNewTexture() const &
 {
-    return impl->newTexture;
+    return impl->registry.getTexture(impl->newTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getOpenTexture() const & noexcept
+const sf::Texture& TexturesManager::getOpenTexture() const &
 {
-    return impl->openTexture;
+    return impl->registry.getTexture(impl->openTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getSaveTexture() const & noexcept
+const sf::Texture& TexturesManager::getSaveTexture() const &
 {
-    return impl->saveTexture;
+    return impl->registry.getTexture(impl->saveTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getCursorTexture() const & noexcept
+const sf::Texture& TexturesManager::getCursorTexture() const &
 {
-    return impl->cursorTexture;
+    return impl->registry.getTexture(impl->cursorTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getExitTexture() const & noexcept
+const sf::Texture& TexturesManager::getExitTexture() const &
 {
-    return impl->exitTexture;
+    return impl->registry.getTexture(impl->exitTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getTestTexture() const & noexcept
+const sf::Texture& TexturesManager::getTestTexture() const &
 {
-    return impl->testTexture;
+    return impl->registry.getTexture(impl->testTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getArrowUpTexture() const & noexcept
+const sf::Texture& TexturesManager::getArrowUpTexture() const &
 {
-    return impl->arrowUpTexture;
+    return impl->registry.getTexture(impl->arrowUpTexture);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getArrowDownTexture() const & noexcept
+const sf::Texture& TexturesManager::getArrowDownTexture() const &
 {
-    return impl->arrowDownTexture;
+    return impl->registry.getTexture(impl->arrowDownTexture);
 }
 
 /**
  *
  */
 const sf::Texture& TexturesManager::getScrollArrowDownTexture() const &
-    noexcept
-{
-    return impl->scrollArrowDownTexture;
-}
-
-/**
- *
- */
-const sf::Texture& TexturesManager::getScrollArrowUpTexture() const & noexcept
 {
-    return impl->scrollArrowUpTexture;
+    return impl->registry.getTexture(impl->scrollArrowDownTexture);
 }
 
 /**
  *
  */
-void TexturesManager::loadTexture(
-    sf::Texture& texture,
-    const std::string& path
-) &
+const sf::Texture& TexturesManager::getScrollArrowUpTexture() const &
 {
-    if (!texture.loadFromFile("res/images/" + path + ".png"))
-    {
-        throw std::invalid_argument("Cannot load texture : " + path);
-    }
+    return impl->registry.getTexture(impl->scrollArrowUpTexture);
 }
 
 }
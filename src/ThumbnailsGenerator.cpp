@@ -0,0 +1,581 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ThumbnailsGenerator.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "ThumbnailsGenerator.hpp"
+
+#include "Level.hpp"
+#include "cells.hpp"
+#include "files.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <cstdio>
+
+namespace memoris
+{
+namespace utils
+{
+
+namespace
+{
+
+constexpr char CACHE_DIRECTORY[] {"data/thumbnails/"};
+constexpr char LEVELS_DIRECTORY[] {"data/levels/"};
+constexpr char SERIE_EXTENSION[] {".serie"};
+constexpr char LEVEL_EXTENSION[] {".level"};
+
+constexpr unsigned short WORKERS_AMOUNT {2};
+
+constexpr unsigned int PIXELS_PER_CELL {2};
+constexpr unsigned int FLOORS_SEPARATION {2};
+
+/**
+ * @brief returns the color of one cell type into the thumbnails
+ *
+ * @param type the type of the cell
+ *
+ * @return const sf::Color
+ */
+const sf::Color getCellColor(const char& type) noexcept
+{
+    switch(type)
+    {
+    case cells::WALL_CELL:
+    {
+        return sf::Color(90, 90, 90);
+    }
+    case cells::EMPTY_CELL:
+    case cells::HIDDEN_CELL:
+    {
+        return sf::Color(20, 20, 20);
+    }
+    case cells::DEPARTURE_CELL:
+    {
+        return sf::Color(0, 200, 0);
+    }
+    case cells::ARRIVAL_CELL:
+    {
+        return sf::Color(220, 0, 0);
+    }
+    case cells::STAR_CELL:
+    {
+        return sf::Color(255, 220, 0);
+    }
+    case cells::MORE_LIFE_CELL:
+    case cells::MORE_TIME_CELL:
+    {
+        return sf::Color(0, 120, 255);
+    }
+    case cells::LESS_LIFE_CELL:
+    case cells::LESS_TIME_CELL:
+    {
+        return sf::Color(255, 120, 0);
+    }
+    default:
+    {
+        /* stairs, elevators and all the animated cells */
+        return sf::Color(200, 0, 200);
+    }
+    }
+}
+
+/**
+ * @brief reads the whole content of the given file
+ *
+ * @param filePath the path of the file to read
+ * @param content the string to fill
+ *
+ * @return const bool false if the file cannot be opened
+ */
+const bool readFile(
+    const std::string& filePath,
+    std::string& content
+)
+{
+    std::ifstream file(
+        filePath,
+        std::ios::binary
+    );
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    content.assign(
+        std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>()
+    );
+
+    return true;
+}
+
+/**
+ * @brief returns the path of the first level of the given serie file; the
+ * levels of a serie are located into the levels directory of the same type
+ * (officials or personals) as the serie
+ *
+ * @param seriePath the path of the serie file
+ * @param levelPath the string to fill
+ *
+ * @return const bool false if the serie cannot be opened or is empty
+ */
+const bool getFirstLevelPath(
+    const std::string& seriePath,
+    std::string& levelPath
+)
+{
+    std::ifstream file(seriePath);
+
+    std::string level;
+
+    /* the series files created before the results store start with three
+       empty results lines ("."), skipped as the empty lines */
+    while (
+        std::getline(file, level) &&
+        (level.empty() || level == ".")
+    )
+    {
+    }
+
+    const size_t nameSeparator = seriePath.find_last_of('/');
+
+    if (level.empty() || nameSeparator == std::string::npos)
+    {
+        return false;
+    }
+
+    const size_t typeSeparator = seriePath.find_last_of('/', nameSeparator - 1);
+    const size_t typeStart =
+        typeSeparator == std::string::npos ? 0 : typeSeparator + 1;
+
+    levelPath = LEVELS_DIRECTORY +
+        seriePath.substr(typeStart, nameSeparator - typeStart) + "/" +
+        level + LEVEL_EXTENSION;
+
+    return true;
+}
+
+/**
+ * @brief draws the playable floors of one level side by side, one pixels
+ * square per cell
+ *
+ * @param content the content of the level file
+ * @param image the image to draw
+ */
+void drawThumbnail(
+    const std::string& content,
+    sf::Image& image
+)
+{
+    using Level = entities::Level;
+
+    /* the cells are after the minutes and the seconds lines; the missing
+       cells at the end of the file are empty cells */
+    const size_t minutesEnd = content.find('\n');
+    const size_t secondsEnd = minutesEnd == std::string::npos ?
+        std::string::npos : content.find('\n', minutesEnd + 1);
+
+    std::string types(Level::CELLS_PER_LEVEL, cells::EMPTY_CELL);
+
+    if (secondsEnd != std::string::npos)
+    {
+        const size_t length = std::min(
+            content.size() - secondsEnd - 1,
+            static_cast<size_t>(Level::CELLS_PER_LEVEL)
+        );
+
+        std::copy_n(
+            content.cbegin() + secondsEnd + 1,
+            length,
+            types.begin()
+        );
+    }
+
+    std::vector<unsigned short> floors;
+
+    for (
+        unsigned short floor {0};
+        floor <= Level::MAX_FLOOR;
+        floor++
+    )
+    {
+        const auto first = types.cbegin() + floor * Level::CELLS_PER_FLOOR;
+
+        if (
+            std::any_of(
+                first,
+                first + Level::CELLS_PER_FLOOR,
+                [](const char& type)
+                {
+                    return type != cells::WALL_CELL &&
+                        type != cells::EMPTY_CELL;
+                }
+            )
+        )
+        {
+            floors.push_back(floor);
+        }
+    }
+
+    if (floors.empty())
+    {
+        floors.push_back(Level::MIN_FLOOR);
+    }
+
+    const unsigned int floorDimension =
+        Level::CELLS_PER_LINE * PIXELS_PER_CELL;
+
+    image.create(
+        floors.size() * (floorDimension + FLOORS_SEPARATION) -
+            FLOORS_SEPARATION,
+        floorDimension,
+        sf::Color::Transparent
+    );
+
+    for (size_t position {0}; position < floors.size(); position++)
+    {
+        const unsigned int floorOrigin =
+            position * (floorDimension + FLOORS_SEPARATION);
+
+        for (
+            unsigned short cell {0};
+            cell < Level::CELLS_PER_FLOOR;
+            cell++
+        )
+        {
+            const sf::Color color = getCellColor(
+                types[floors[position] * Level::CELLS_PER_FLOOR + cell]
+            );
+
+            const unsigned int horizontalOrigin =
+                floorOrigin + (cell % Level::CELLS_PER_LINE) * PIXELS_PER_CELL;
+            const unsigned int verticalOrigin =
+                (cell / Level::CELLS_PER_LINE) * PIXELS_PER_CELL;
+
+            for (unsigned int x {0}; x < PIXELS_PER_CELL; x++)
+            {
+                for (unsigned int y {0}; y < PIXELS_PER_CELL; y++)
+                {
+                    image.setPixel(
+                        horizontalOrigin + x,
+                        verticalOrigin + y,
+                        color
+                    );
+                }
+            }
+        }
+    }
+}
+
+}
+
+class ThumbnailsGenerator::Impl
+{
+
+public:
+
+    /**
+     * one thumbnail generation, requested by the rendering thread and
+     * executed by a worker thread
+     */
+    struct Job
+    {
+        std::string filePath;
+        unsigned int generation {0};
+
+        sf::Image image;
+        bool generated {false};
+    };
+
+    /**
+     * one thumbnail known by the rendering thread
+     */
+    struct Thumbnail
+    {
+        sf::Texture texture;
+        bool ready {false};
+    };
+
+    Impl()
+    {
+        for (unsigned short index {0}; index < WORKERS_AMOUNT; index++)
+        {
+            workers.emplace_back(&Impl::run, this);
+        }
+    }
+
+    /**
+     * @brief worker thread loop; generates the queued thumbnails one by one
+     */
+    void run() noexcept
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true)
+        {
+            condition.wait(
+                lock,
+                [this]()
+                {
+                    return stopped || !jobs.empty();
+                }
+            );
+
+            if (stopped)
+            {
+                return;
+            }
+
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+
+            /* the generation is executed without the lock, so the other
+               worker and the rendering thread are never blocked */
+            lock.unlock();
+
+            try
+            {
+                job.generated = generate(
+                    job.filePath,
+                    job.image
+                );
+            }
+            catch(std::exception&)
+            {
+                job.generated = false;
+            }
+
+            lock.lock();
+
+            finishedJobs.push_back(std::move(job));
+        }
+    }
+
+    /**
+     * @brief loads the thumbnail of the given file from the disk cache, or
+     * draws it and saves it into the cache if it is not cached yet
+     *
+     * @param filePath the path of the .level or .serie file
+     * @param image the image to fill
+     *
+     * @return const bool false if the level cannot be read
+     */
+    const bool generate(
+        const std::string& filePath,
+        sf::Image& image
+    ) const
+    {
+        std::string levelPath = filePath;
+
+        const std::string extension(SERIE_EXTENSION);
+
+        if (
+            filePath.size() > extension.size() &&
+            filePath.compare(
+                filePath.size() - extension.size(),
+                extension.size(),
+                extension
+            ) == 0 &&
+            !getFirstLevelPath(filePath, levelPath)
+        )
+        {
+            return false;
+        }
+
+        std::string content;
+
+        if (!readFile(levelPath, content))
+        {
+            return false;
+        }
+
+        char hash[9];
+        std::snprintf(
+            hash,
+            sizeof(hash),
+            "%08x",
+            static_cast<unsigned int>(
+                getChecksum(content.data(), content.size())
+            )
+        );
+
+        const std::string cachePath =
+            std::string(CACHE_DIRECTORY) + hash + ".png";
+
+        if (image.loadFromFile(cachePath))
+        {
+            return true;
+        }
+
+        drawThumbnail(content, image);
+
+        /* a failed cache writing only means the thumbnail is drawn again
+           the next time */
+        image.saveToFile(cachePath);
+
+        return true;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    std::deque<Job> jobs;
+    std::deque<Job> finishedJobs;
+
+    bool stopped {false};
+
+    /* incremented when the thumbnails are refreshed; the jobs requested
+       before are dropped when they are finished */
+    std::atomic<unsigned int> generation {0};
+
+    /* only used by the rendering thread */
+    std::unordered_map<std::string, Thumbnail> thumbnails;
+
+    /* the requested jobs that have not been received back yet, including
+       the ones of the previous generations; only used by the rendering
+       thread */
+    size_t pendingJobs {0};
+
+    /* declared last: the threads are started once all the other attributes
+       have been initialized */
+    std::vector<std::thread> workers;
+};
+
+/**
+ *
+ */
+ThumbnailsGenerator::ThumbnailsGenerator() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+ThumbnailsGenerator::~ThumbnailsGenerator() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopped = true;
+    }
+
+    impl->condition.notify_all();
+
+    for (auto& worker : impl->workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ *
+ */
+const sf::Texture* ThumbnailsGenerator::getThumbnail(
+    const std::string& filePath
+) const &
+{
+    auto& thumbnails = impl->thumbnails;
+
+    std::deque<Impl::Job> finishedJobs;
+
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        finishedJobs.swap(impl->finishedJobs);
+    }
+
+    impl->pendingJobs -= finishedJobs.size();
+
+    /* the textures are created here, by the rendering thread */
+    for (Impl::Job& job : finishedJobs)
+    {
+        if (job.generation != impl->generation)
+        {
+            continue;
+        }
+
+        Impl::Thumbnail& thumbnail = thumbnails[job.filePath];
+        thumbnail.ready =
+            job.generated &&
+            thumbnail.texture.loadFromImage(job.image);
+    }
+
+    const auto iterator = thumbnails.find(filePath);
+
+    if (iterator != thumbnails.end())
+    {
+        return iterator->second.ready ? &iterator->second.texture : nullptr;
+    }
+
+    /* the thumbnail is known as requested from now, even if it cannot be
+       generated, so it is requested only once */
+    thumbnails[filePath];
+
+    Impl::Job job;
+    job.filePath = filePath;
+    job.generation = impl->generation;
+
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->jobs.push_back(std::move(job));
+    }
+
+    impl->pendingJobs++;
+
+    impl->condition.notify_one();
+
+    return nullptr;
+}
+
+/**
+ *
+ */
+const bool ThumbnailsGenerator::hasPendingThumbnails() const & noexcept
+{
+    return impl->pendingJobs != 0;
+}
+
+/**
+ *
+ */
+void ThumbnailsGenerator::refresh() const & noexcept
+{
+    impl->generation++;
+    impl->thumbnails.clear();
+}
+
+}
+}
@@ -123,7 +123,7 @@ void VerticalMirrorAnimation::renderAnimation(
     else if (animationSteps == 33)
     {
         level->setPlayerCellIndex(updatedPlayerIndex);
-        level->getCells()[updatedPlayerIndex]->show(context);
+        level->getCell(updatedPlayerIndex).show(context);
 
         finished = true;
     }
@@ -166,26 +166,26 @@ void VerticalMirrorAnimation::invertSides(
             continue;
         }
 
-        const char type = level->getCells()[index]->getType();
-        const bool visible = level->getCells()[index]->isVisible();
+        const char type = level->getCell(index).getType();
+        const bool visible = level->getCell(index).isVisible();
         const unsigned short invertedIndex =
             findInvertedIndex(
                 line,
                 index
             );
 
-        level->getCells()[index]->setType(
-            level->getCells()[invertedIndex]->getType()
+        level->getCell(index).setType(
+            level->getCell(invertedIndex).getType()
         );
 
         showOrHideCell(
             context,
             level,
             index,
-            level->getCells()[invertedIndex]->isVisible()
+            level->getCell(invertedIndex).isVisible()
         );
 
-        level->getCells()[invertedIndex]->setType(type);
+        level->getCell(invertedIndex).setType(type);
 
         showOrHideCell(
             context,
@@ -296,7 +296,7 @@ void VerticalMirrorAnimation::displayLevelAndVerticalSeparator(
         &entities::Cell::display
     );
 
-    context.getSfmlWindow().draw(
+    context.getRenderTarget().draw(
         context.getShapesManager().getVerticalSeparator()
     );
 }
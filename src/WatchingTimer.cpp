@@ -28,8 +28,8 @@
 #include "ColorsManager.hpp"
 #include "Context.hpp"
 #include "fonts.hpp"
+#include "NumericText.hpp"
 
-#include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
@@ -37,40 +37,60 @@ namespace memoris
 namespace widgets
 {
 
+namespace
+{
+
+/* the watching time is displayed with two digits at most */
+constexpr const char* DISPLAYED_DIGITS {"##"};
+
+}
+
 class WatchingTimer::Impl
 {
 
 public:
 
-    Impl(const utils::Context& context)
+    Impl(const utils::Context& context) :
+        left(
+            context.getFontsManager().getTextFont(),
+            fonts::TITLE_SIZE,
+            context.getColorsManager().getColorWhite(),
+            DISPLAYED_DIGITS
+        ),
+        right(
+            context.getFontsManager().getTextFont(),
+            fonts::TITLE_SIZE,
+            context.getColorsManager().getColorWhite(),
+            DISPLAYED_DIGITS
+        )
     {
-        left.setFont(context.getFontsManager().getTextFont());
-        left.setColor(context.getColorsManager().getColorWhite());
-        left.setCharacterSize(fonts::TITLE_SIZE);
         left.setPosition(
             90.f,
             TIMERS_VERTICAL_POSITION
         );
 
-        right.setFont(context.getFontsManager().getTextFont());
-        right.setColor(context.getColorsManager().getColorWhite());
-        right.setCharacterSize(fonts::TITLE_SIZE);
         right.setPosition(
             1400.f,
             TIMERS_VERTICAL_POSITION
         );
     }
 
-    sf::Text left;
-    sf::Text right;
+    NumericText left;
+    NumericText right;
 };
 
 /**
  *
  */
 WatchingTimer::WatchingTimer(const utils::Context& context) :
-    impl(std::make_unique<Impl>(context))
+    impl(context)
 {
+    /* Impl is 400 bytes with SFML 2.5 on 64 bits (two numeric texts); the
+       storage keeps a quarter of headroom for the other SFML versions */
+    static_assert(
+        sizeof(Impl) <= decltype(impl)::SIZE,
+        "The WatchingTimer implementation does not fit its storage"
+    );
 }
 
 /**
@@ -82,10 +102,10 @@ WatchingTimer::~WatchingTimer() noexcept = default;
  *
  */
 void WatchingTimer::updateDisplayedAmount(const unsigned short& amount) &
+noexcept
 {
-    /* setString function only accepts std::string or sf::String */
-    impl->left.setString(std::to_string(amount));
-    impl->right.setString(std::to_string(amount));
+    impl->left.setNumber(0, amount);
+    impl->right.setNumber(0, amount);
 }
 
 /**
@@ -93,8 +113,8 @@ void WatchingTimer::updateDisplayedAmount(const unsigned short& amount) &
  */
 void WatchingTimer::display(const utils::Context& context) const &
 {
-    context.getSfmlWindow().draw(impl->left);
-    context.getSfmlWindow().draw(impl->right);
+    context.getRenderTarget().draw(impl->left);
+    context.getRenderTarget().draw(impl->right);
 }
 
 }
@@ -113,9 +113,9 @@ WinLevelEndingScreen::~WinLevelEndingScreen() noexcept = default;
  */
 void WinLevelEndingScreen::render(const Context& context) &
 {
-    context.getSfmlWindow().draw(filter);
-    context.getSfmlWindow().draw(text);
-    context.getSfmlWindow().draw(impl->leftLevelsSuffix);
+    context.getRenderTarget().draw(filter);
+    context.getRenderTarget().draw(text);
+    context.getRenderTarget().draw(impl->leftLevelsSuffix);
 
     animateLeftLevelsAmount(context);
 }
@@ -125,7 +125,7 @@ void WinLevelEndingScreen::render(const Context& context) &
  */
 void WinLevelEndingScreen::animateLeftLevelsAmount(const Context& context) &
 {
-    context.getSfmlWindow().draw(impl->leftLevelsAmount);
+    context.getRenderTarget().draw(impl->leftLevelsAmount);
 
     if (
         context.getClockMillisecondsTime() -
@@ -33,12 +33,15 @@
 #include "AnimatedBackground.hpp"
 #include "HorizontalGradient.hpp"
 #include "PlayingSerieManager.hpp"
+#include "LeaderboardManager.hpp"
+#include "LeaderboardClient.hpp"
 #include "SerieResult.hpp"
+#include "Game.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 
-#include <array>
+#include <algorithm>
 
 namespace memoris
 {
@@ -50,9 +53,13 @@ class WinSerieEndingController::Impl
 
 public:
 
-    Impl(const utils::Context& context) :
+    Impl(
+        const utils::Context& context,
+        allocators::MonotonicArena& arena
+    ) :
         background(context),
-        gradient(context)
+        gradient(context),
+        resultsTexts(arena)
     {
         title.setString("Serie finished !");
         title.setCharacterSize(fonts::TITLE_SIZE);
@@ -74,8 +81,28 @@ public:
             TIME_VERTICAL_POSITION
         );
 
-        // const std::array<entities::SerieResult, N>&
-        auto& results = context.getPlayingSerieManager().getResults();
+        const auto& serieManager = context.getPlayingSerieManager();
+
+        // managers::LeaderboardManager&
+        auto& leaderboard = context.getLeaderboardManager();
+        leaderboard.loadSerie(serieManager.getSerieName());
+
+        entities::SerieResult result(
+            context.getGame().getName(),
+            serieManager.getPlayingTime(),
+            serieManager.getLevelsTimes()
+        );
+
+        /* only queued, the upload is executed by the client thread */
+        context.getLeaderboardClient().upload(
+            serieManager.getSerieName(),
+            result
+        );
+
+        const size_t rank = leaderboard.addResult(
+            context.getAsyncFileWriter(),
+            std::move(result)
+        );
 
         // const sf::Font&
         const auto& font = context.getFontsManager().getTextFont();
@@ -84,47 +111,65 @@ public:
             context.getColorsManager().getColorWhiteCopy();
         colorResults.a = 0;
 
-        unsigned short index {0};
-
-        for (const entities::SerieResult& result : results)
-        {
-            std::string resultString = result.getString();
-
-            /* skip undefined result */
-            if (resultString == ".")
-            {
-                continue;
-            }
+        const size_t displayedResults = std::min(
+            leaderboard.getResultsAmount(),
+            static_cast<size_t>(RESULTS_DISPLAYED_AMOUNT)
+        );
 
-            /* replace commas by space for graphical reasons; I got some
-               problem by adding the space character directly into the file */
-            std::replace(
-                resultString.begin(),
-                resultString.end(),
-                ',',
-                ' '
-            );
+        /* the displayed results and the rank line */
+        resultsTexts.reserve(displayedResults + 1);
 
-            // std::unique_ptr<sf::Text>
-            auto resultText = std::make_unique<sf::Text>(
-                resultString,
+        for (size_t index {0}; index < displayedResults; index++)
+        {
+            addResultText(
+                std::to_string(index + 1) + ". " +
+                    leaderboard.getResult(index).getString(),
                 font,
-                fonts::TEXT_SIZE
+                colorResults
             );
+        }
 
-            resultText->setPosition(
-                window::getCenteredSfmlSurfaceHorizontalPosition(*resultText),
-                RESULTS_FIRST_ITEM_VERTICAL_POSITION + RESULTS_INTERVAL * index
-            );
+        /* the rank of the current game is always displayed, even if the
+           result is not one of the displayed best results */
+        addResultText(
+            "Rank " + std::to_string(rank) + " / " +
+                std::to_string(leaderboard.getResultsAmount()),
+            font,
+            colorResults
+        );
+
+        colorWhite = context.getColorsManager().getColorWhiteCopy();
+    }
+
+    /**
+     * @brief creates one line of the ranking under the previous one
+     *
+     * @param string the text of the line
+     * @param font the font of the line
+     * @param color the initial color of the line
+     */
+    void addResultText(
+        const std::string& string,
+        const sf::Font& font,
+        const sf::Color& color
+    )
+    {
+        const size_t index = resultsTexts.size();
 
-            resultText->setColor(colorResults);
+        resultsTexts.emplace_back(
+            string,
+            font,
+            fonts::TEXT_SIZE
+        );
 
-            resultsTexts.push_back(std::move(resultText));
+        sf::Text& resultText = resultsTexts.back();
 
-            index++;
-        }
+        resultText.setPosition(
+            window::getCenteredSfmlSurfaceHorizontalPosition(resultText),
+            RESULTS_FIRST_ITEM_VERTICAL_POSITION + RESULTS_INTERVAL * index
+        );
 
-        colorWhite = context.getColorsManager().getColorWhiteCopy();
+        resultText.setColor(color);
     }
 
     sf::Text title;
@@ -134,9 +179,10 @@ public:
 
     others::HorizontalGradient gradient;
 
-    /* use pointers instead of plain objects in order to accelerate the copy
-       process (sf::Text has no move constructor) */
-    std::vector<std::unique_ptr<sf::Text>> resultsTexts;
+    /* stored into the controller arena; the texts are constructed in place
+       into the reserved buffer, so they are never copied (sf::Text has no
+       move constructor) */
+    allocators::ArenaVector<sf::Text> resultsTexts;
 
     bool displayRanking {false};
     bool switchingDisplayedContent {false};
@@ -153,7 +199,12 @@ WinSerieEndingController::WinSerieEndingController(
     const utils::Context& context
 ) :
     Controller(context),
-    impl(std::make_unique<Impl>(context))
+    impl(
+        std::make_unique<Impl>(
+            context,
+            getArena()
+        )
+    )
 {
 }
 
@@ -201,10 +252,9 @@ const unsigned short& WinSerieEndingController::render(
         {
             impl->colorWhite.a += OPACITY_UPDATE_INTERVAL;
 
-            // const std::unique_ptr<sf::Text>&
-            for (const auto& resultText : impl->resultsTexts)
+            for (sf::Text& resultText : impl->resultsTexts)
             {
-                (*resultText).setColor(impl->colorWhite);
+                resultText.setColor(impl->colorWhite);
             }
 
             if (impl->colorWhite.a == COLOR_WHITE_MAX_OPACITY)
@@ -218,21 +268,20 @@ const unsigned short& WinSerieEndingController::render(
 
     if (impl->displayRanking)
     {
-        // const std::unique_ptr<sf::Text>&
-        for (const auto& resultText : impl->resultsTexts)
+        for (const sf::Text& resultText : impl->resultsTexts)
         {
-            context.getSfmlWindow().draw(*resultText);
+            context.getRenderTarget().draw(resultText);
         }
     }
     else
     {
-        context.getSfmlWindow().draw(impl->title);
-        context.getSfmlWindow().draw(impl->time);
+        context.getRenderTarget().draw(impl->title);
+        context.getRenderTarget().draw(impl->time);
     }
 
     nextControllerId = animateScreenTransition(context);
 
-    while(context.getSfmlWindow().pollEvent(event))
+    while(pollEvent(context))
     {
         switch(event.type)
         {
@@ -0,0 +1,285 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file allocations.cpp
+ * @package allocations
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifdef MEMORIS_TRACK_ALLOCATIONS
+
+#include "allocations.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <new>
+
+namespace memoris
+{
+namespace allocations
+{
+
+namespace
+{
+
+constexpr size_t PHASES_AMOUNT {
+    static_cast<size_t>(FramePhase::PHASES_AMOUNT)
+};
+
+constexpr const char* PHASES_NAMES[PHASES_AMOUNT] {
+    "clear",
+    "render",
+    "display"
+};
+
+/**
+ * the amount and the size of the allocations
+ */
+struct Counters
+{
+    size_t allocations;
+    size_t bytes;
+};
+
+/* the counters are only updated by the thread that renders the frames, the
+   allocations of the other threads (files writer, leaderboard client,
+   thumbnails generator) are never tracked; these variables are trivial, so
+   they can be used by the allocation operators at any time */
+thread_local bool tracking {false};
+thread_local FramePhase currentPhase {FramePhase::CLEAR};
+thread_local Counters frameCounters[PHASES_AMOUNT] {};
+
+thread_local unsigned short currentControllerId {0};
+thread_local unsigned int framesAmount {0};
+thread_local unsigned int allocatingFramesAmount {0};
+thread_local Counters firstFrameCounters {};
+thread_local Counters nextFramesCounters {};
+thread_local size_t lastFrameAllocations {0};
+
+/**
+ * @brief allocates memory and counts the allocation if the frame is tracked
+ *
+ * @param size the amount of bytes to allocate
+ *
+ * @return void*
+ *
+ * @throw std::bad_alloc the memory cannot be allocated
+ */
+void* allocate(std::size_t size)
+{
+    if (tracking)
+    {
+        Counters& counters = frameCounters[static_cast<size_t>(currentPhase)];
+        counters.allocations++;
+        counters.bytes += size;
+    }
+
+    void* memory = std::malloc(size == 0 ? 1 : size);
+
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+}
+
+/**
+ *
+ */
+void startFrame(const unsigned short& controllerId) noexcept
+{
+    for (Counters& counters : frameCounters)
+    {
+        counters = {};
+    }
+
+    currentControllerId = controllerId;
+    currentPhase = FramePhase::CLEAR;
+
+    tracking = true;
+}
+
+/**
+ *
+ */
+void setPhase(const FramePhase& phase) noexcept
+{
+    currentPhase = phase;
+}
+
+/**
+ *
+ */
+void endFrame() noexcept
+{
+    /* the report itself is never tracked */
+    tracking = false;
+
+    Counters frame {};
+
+    for (const Counters& counters : frameCounters)
+    {
+        frame.allocations += counters.allocations;
+        frame.bytes += counters.bytes;
+    }
+
+    Counters& controllerCounters =
+        framesAmount == 0 ? firstFrameCounters : nextFramesCounters;
+    controllerCounters.allocations += frame.allocations;
+    controllerCounters.bytes += frame.bytes;
+
+    lastFrameAllocations = frame.allocations;
+
+    framesAmount++;
+
+    if (frame.allocations == 0)
+    {
+        return;
+    }
+
+    allocatingFramesAmount++;
+
+    std::cerr << "allocations: controller " << currentControllerId <<
+        ", frame " << framesAmount << ":";
+
+    for (size_t phase {0}; phase < PHASES_AMOUNT; phase++)
+    {
+        std::cerr << (phase == 0 ? " " : ", ") << PHASES_NAMES[phase] <<
+            " " << frameCounters[phase].allocations << " (" <<
+            frameCounters[phase].bytes << " bytes)";
+    }
+
+    std::cerr << std::endl;
+}
+
+/**
+ *
+ */
+void endController() noexcept
+{
+    if (framesAmount != 0)
+    {
+        std::cerr << "allocations: controller " << currentControllerId <<
+            " summary: " << framesAmount << " frames, " <<
+            allocatingFramesAmount << " allocating, first frame " <<
+            firstFrameCounters.allocations << " (" <<
+            firstFrameCounters.bytes << " bytes), next frames " <<
+            nextFramesCounters.allocations << " (" <<
+            nextFramesCounters.bytes << " bytes)" << std::endl;
+    }
+
+    framesAmount = 0;
+    allocatingFramesAmount = 0;
+    firstFrameCounters = {};
+    nextFramesCounters = {};
+}
+
+/**
+ *
+ */
+const size_t getFrameAllocations() noexcept
+{
+    return lastFrameAllocations;
+}
+
+}
+}
+
+/**
+ *
+ */
+void* operator new(std::size_t size)
+{
+    return memoris::allocations::allocate(size);
+}
+
+/**
+ *
+ */
+void* operator new[](std::size_t size)
+{
+    return memoris::allocations::allocate(size);
+}
+
+/**
+ *
+ */
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return memoris::allocations::allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+/**
+ *
+ */
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return memoris::allocations::allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+/**
+ *
+ */
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+/**
+ *
+ */
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+/**
+ *
+ */
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+/**
+ *
+ */
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+#endif
@@ -26,11 +26,34 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
 namespace memoris
 {
 namespace allocators
 {
 
+namespace
+{
+
+constexpr std::size_t FIRST_BLOCK_SIZE {4096};
+constexpr std::size_t MAXIMUM_BLOCK_SIZE {65536};
+
+}
+
+class MonotonicArena::Impl
+{
+
+public:
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+
+    char* current {nullptr};
+    std::size_t available {0};
+    std::size_t nextBlockSize {FIRST_BLOCK_SIZE};
+};
+
 /**
  *
  */
@@ -49,6 +72,63 @@ void deleteDynamicObject(std::unique_ptr<T>& pointer)
     pointer.reset();
 }
 
+/**
+ *
+ */
+MonotonicArena::MonotonicArena() noexcept
+{
+}
+
+/**
+ *
+ */
+MonotonicArena::~MonotonicArena() noexcept = default;
+
+/**
+ *
+ */
+void* MonotonicArena::allocate(
+    const std::size_t& bytes,
+    const std::size_t& alignment
+) &
+{
+    const std::size_t padding =
+        (alignment - reinterpret_cast<std::uintptr_t>(impl->current) %
+            alignment) % alignment;
+
+    if (impl->current == nullptr || padding + bytes > impl->available)
+    {
+        /* the blocks sizes grow with the amount of used memory, the
+           allocations bigger than one block get their own block */
+        const std::size_t blockSize = std::max(
+            impl->nextBlockSize,
+            bytes
+        );
+
+        /* not std::make_unique, the block content does not have to be
+           initialized */
+        impl->blocks.emplace_back(new char[blockSize]);
+
+        impl->current = impl->blocks.back().get();
+        impl->available = blockSize;
+
+        impl->nextBlockSize = std::min(
+            impl->nextBlockSize * 2,
+            MAXIMUM_BLOCK_SIZE
+        );
+
+        /* new[] returns memory aligned for any fundamental type */
+        return allocate(bytes, alignment);
+    }
+
+    void* memory = impl->current + padding;
+
+    impl->current += padding + bytes;
+    impl->available -= padding + bytes;
+
+    return memory;
+}
+
 /* explicit instanciation because not defined directly into the header */
 
 template void createDynamicObject(std::unique_ptr<sf::Transform>& pointer);
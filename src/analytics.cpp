@@ -0,0 +1,571 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file analytics.cpp
+ * @package analytics
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "analytics.hpp"
+
+#include "simulation.hpp"
+#include "LevelTemplatesManager.hpp"
+
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace memoris
+{
+namespace analytics
+{
+
+namespace
+{
+
+using Level = entities::Level;
+using Heatmaps = std::unordered_map<std::string, LevelHeatmap>;
+
+/* the files are split into chunks of this size, so one big file is read by
+   all the workers */
+constexpr std::streamoff CHUNK_SIZE {4 * 1024 * 1024};
+
+constexpr char COMMENT_CHARACTER {'#'};
+constexpr char END_MOVE {'E'};
+
+constexpr float MILLISECONDS_PER_SECOND {1000.f};
+
+/**
+ * one part of a sessions file, contains the sessions lines that start
+ * between the first and the last offset
+ */
+struct Chunk
+{
+    size_t file;
+    std::streamoff begin;
+    std::streamoff end;
+};
+
+/**
+ * one recorded move; the move character is END_MOVE for the end of the
+ * recording
+ */
+struct Move
+{
+    unsigned int time;
+    char move;
+};
+
+/**
+ * the aggregated sessions of one worker
+ */
+struct WorkerReport
+{
+    Heatmaps heatmaps;
+
+    unsigned int rejectedSessions {0};
+};
+
+/**
+ * @brief parses the moves of one session line
+ *
+ * @param line the session line
+ * @param start the index of the first character after the level path
+ * @param moves the parsed moves, the container is cleared first
+ *
+ * @return const bool false if the line is malformed
+ */
+const bool parseMoves(
+    const std::string& line,
+    size_t start,
+    std::vector<Move>& moves
+)
+{
+    moves.clear();
+
+    const size_t length = line.size();
+
+    while (true)
+    {
+        while (start < length && line[start] == ' ')
+        {
+            start++;
+        }
+
+        if (start == length)
+        {
+            return true;
+        }
+
+        unsigned long time {0};
+        const size_t digitsStart = start;
+
+        while (start < length && line[start] >= '0' && line[start] <= '9')
+        {
+            time = time * 10 + static_cast<unsigned long>(line[start] - '0');
+
+            if (time > std::numeric_limits<unsigned int>::max())
+            {
+                return false;
+            }
+
+            start++;
+        }
+
+        /* the time, the separator and the move character are required, the
+           move is followed by a space or by the end of the line */
+        if (
+            start == digitsStart ||
+            start + 1 >= length ||
+            line[start] != ':' ||
+            (start + 2 < length && line[start + 2] != ' ')
+        )
+        {
+            return false;
+        }
+
+        const char& move = line[start + 1];
+
+        if (move != END_MOVE && simulation::getMovement(move) == 0)
+        {
+            return false;
+        }
+
+        moves.push_back({static_cast<unsigned int>(time), move});
+
+        start += 2;
+    }
+}
+
+/**
+ * @brief returns the heatmap of the given level, creates it if necessary
+ *
+ * @param heatmaps the heatmaps of the worker
+ * @param filePath the path of the level file
+ *
+ * @return LevelHeatmap&
+ */
+LevelHeatmap& getHeatmap(
+    Heatmaps& heatmaps,
+    const std::string& filePath
+)
+{
+    auto heatmap = heatmaps.find(filePath);
+
+    if (heatmap != heatmaps.end())
+    {
+        return heatmap->second;
+    }
+
+    LevelHeatmap& created = heatmaps[filePath];
+    created.filePath = filePath;
+    created.visits.assign(Level::CELLS_PER_LEVEL, 0);
+    created.wallCollisions.assign(Level::CELLS_PER_LEVEL, 0);
+    created.lostLifes.assign(Level::CELLS_PER_LEVEL, 0);
+    created.timeOvers.assign(Level::CELLS_PER_LEVEL, 0);
+
+    return created;
+}
+
+/**
+ * @brief replays one session and aggregates it into the heatmap of its
+ * level
+ *
+ * @param heatmap the heatmap of the level of the session
+ * @param levelTemplate the parsed level
+ * @param moves the moves of the session
+ */
+void replaySession(
+    LevelHeatmap& heatmap,
+    const managers::LevelTemplate& levelTemplate,
+    const std::vector<Move>& moves
+)
+{
+    simulation::LevelPlayer player(levelTemplate);
+
+    heatmap.sessions++;
+    heatmap.visits[player.getPlayerIndex()]++;
+
+    bool starFound {false};
+
+    for (const Move& move : moves)
+    {
+        const float time = move.time / MILLISECONDS_PER_SECOND;
+
+        if (move.move == END_MOVE)
+        {
+            player.stop(time);
+
+            break;
+        }
+
+        const simulation::MoveReport report = player.move(
+            simulation::getMovement(move.move),
+            time
+        );
+
+        const unsigned short& playerIndex = player.getPlayerIndex();
+
+        if (report.moved)
+        {
+            heatmap.visits[playerIndex]++;
+        }
+
+        if (report.hitWall)
+        {
+            heatmap.wallCollisions[report.wallIndex]++;
+        }
+
+        if (report.lostLife)
+        {
+            heatmap.lostLifes[playerIndex]++;
+        }
+
+        if (report.foundStar && !starFound)
+        {
+            heatmap.firstStarTimes.push_back(move.time);
+
+            starFound = true;
+        }
+
+        if (player.isOver())
+        {
+            break;
+        }
+    }
+
+    switch(player.getResult().outcome)
+    {
+    case simulation::Outcome::WIN:
+    {
+        heatmap.wins++;
+
+        break;
+    }
+    case simulation::Outcome::TIME_OVER:
+    {
+        heatmap.timeOverSessions++;
+        heatmap.timeOvers[player.getPlayerIndex()]++;
+
+        break;
+    }
+    case simulation::Outcome::NO_LIFE:
+    {
+        heatmap.noLifeSessions++;
+
+        break;
+    }
+    /* only the levels of a serie are not played, a session is one level */
+    case simulation::Outcome::UNFINISHED:
+    case simulation::Outcome::NOT_PLAYED:
+    {
+        heatmap.unfinishedSessions++;
+
+        break;
+    }
+    }
+}
+
+/**
+ * @brief reads and replays all the sessions of one chunk
+ *
+ * @param report the report of the worker
+ * @param levelTemplatesManager the templates manager of the worker
+ * @param filePath the path of the sessions file
+ * @param chunk the chunk to read
+ *
+ * @throw std::invalid_argument the sessions file cannot be opened anymore
+ */
+void analyzeChunk(
+    WorkerReport& report,
+    const managers::LevelTemplatesManager& levelTemplatesManager,
+    const std::string& filePath,
+    const Chunk& chunk
+)
+{
+    std::ifstream file(filePath, std::ifstream::binary);
+
+    if (!file.is_open())
+    {
+        throw std::invalid_argument("Cannot open the given sessions file.");
+    }
+
+    std::streamoff position {chunk.begin};
+    std::string line;
+
+    /* the line that starts into the previous chunk is read by the previous
+       chunk worker */
+    if (position != 0)
+    {
+        file.seekg(position - 1);
+
+        if (file.get() != '\n')
+        {
+            std::getline(file, line);
+
+            position += static_cast<std::streamoff>(line.size()) + 1;
+        }
+    }
+
+    std::vector<Move> moves;
+
+    while (position < chunk.end && std::getline(file, line))
+    {
+        position += static_cast<std::streamoff>(line.size()) + 1;
+
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (line.empty() || line.front() == COMMENT_CHARACTER)
+        {
+            continue;
+        }
+
+        const size_t pathEnd = line.find(' ');
+        const std::string levelPath = line.substr(0, pathEnd);
+
+        if (
+            !parseMoves(
+                line,
+                pathEnd == std::string::npos ? line.size() : pathEnd,
+                moves
+            )
+        )
+        {
+            report.rejectedSessions++;
+
+            continue;
+        }
+
+        std::shared_ptr<const managers::LevelTemplate> levelTemplate;
+
+        try
+        {
+            levelTemplate = levelTemplatesManager.getTemplate(levelPath);
+        }
+        catch (const std::invalid_argument&)
+        {
+            report.rejectedSessions++;
+
+            continue;
+        }
+
+        replaySession(
+            getHeatmap(report.heatmaps, levelPath),
+            *levelTemplate,
+            moves
+        );
+    }
+}
+
+/**
+ * @brief adds the counters and the times of one heatmap into another one
+ *
+ * @param destination the merged heatmap
+ * @param source the heatmap to add
+ */
+void mergeHeatmap(
+    LevelHeatmap& destination,
+    const LevelHeatmap& source
+)
+{
+    auto add = [](
+        std::vector<unsigned int>& counters,
+        const std::vector<unsigned int>& added
+    )
+    {
+        std::transform(
+            counters.cbegin(),
+            counters.cend(),
+            added.cbegin(),
+            counters.begin(),
+            [](const unsigned int& first, const unsigned int& second)
+            {
+                return first + second;
+            }
+        );
+    };
+
+    add(destination.visits, source.visits);
+    add(destination.wallCollisions, source.wallCollisions);
+    add(destination.lostLifes, source.lostLifes);
+    add(destination.timeOvers, source.timeOvers);
+
+    destination.sessions += source.sessions;
+    destination.wins += source.wins;
+    destination.timeOverSessions += source.timeOverSessions;
+    destination.noLifeSessions += source.noLifeSessions;
+    destination.unfinishedSessions += source.unfinishedSessions;
+
+    destination.firstStarTimes.insert(
+        destination.firstStarTimes.end(),
+        source.firstStarTimes.cbegin(),
+        source.firstStarTimes.cend()
+    );
+}
+
+}
+
+/**
+ *
+ */
+SessionsReport analyzeSessions(const std::vector<std::string>& filePaths)
+{
+    std::vector<Chunk> chunks;
+
+    for (size_t index {0}; index < filePaths.size(); index++)
+    {
+        std::ifstream file(
+            filePaths[index],
+            std::ifstream::binary | std::ifstream::ate
+        );
+
+        if (!file.is_open())
+        {
+            throw std::invalid_argument(
+                "Cannot open the given sessions file."
+            );
+        }
+
+        const std::streamoff size = file.tellg();
+
+        for (std::streamoff begin {0}; begin < size; begin += CHUNK_SIZE)
+        {
+            chunks.push_back(
+                {
+                    index,
+                    begin,
+                    size - begin < CHUNK_SIZE ? size : begin + CHUNK_SIZE
+                }
+            );
+        }
+    }
+
+    const size_t workersAmount = std::max(
+        static_cast<size_t>(1),
+        std::min(
+            static_cast<size_t>(std::thread::hardware_concurrency()),
+            chunks.size()
+        )
+    );
+
+    /* every worker takes the next chunk to read, so the workers stay busy
+       even if some chunks are longer to replay than the others */
+    std::atomic<size_t> nextChunk {0};
+
+    std::vector<WorkerReport> reports(workersAmount);
+    std::vector<std::exception_ptr> errors(workersAmount);
+
+    auto work = [&](const size_t& worker)
+    {
+        /* the templates manager is not thread safe, one per worker */
+        managers::LevelTemplatesManager levelTemplatesManager;
+
+        try
+        {
+            for (
+                size_t index = nextChunk++;
+                index < chunks.size();
+                index = nextChunk++
+            )
+            {
+                const Chunk& chunk = chunks[index];
+
+                analyzeChunk(
+                    reports[worker],
+                    levelTemplatesManager,
+                    filePaths[chunk.file],
+                    chunk
+                );
+            }
+        }
+        catch (...)
+        {
+            errors[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (size_t worker {1}; worker < workersAmount; worker++)
+    {
+        workers.emplace_back(work, worker);
+    }
+
+    /* the calling thread is the first worker */
+    work(0);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    SessionsReport report;
+
+    /* the merged heatmaps are ordered by level path */
+    std::map<std::string, LevelHeatmap> heatmaps;
+
+    for (WorkerReport& workerReport : reports)
+    {
+        report.rejectedSessions += workerReport.rejectedSessions;
+
+        for (auto& heatmap : workerReport.heatmaps)
+        {
+            auto merged = heatmaps.find(heatmap.first);
+
+            if (merged == heatmaps.end())
+            {
+                heatmaps.emplace(
+                    heatmap.first,
+                    std::move(heatmap.second)
+                );
+
+                continue;
+            }
+
+            mergeHeatmap(merged->second, heatmap.second);
+        }
+    }
+
+    for (auto& heatmap : heatmaps)
+    {
+        report.levels.push_back(std::move(heatmap.second));
+    }
+
+    return report;
+}
+
+}
+}
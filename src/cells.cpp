@@ -17,47 +17,218 @@
 */
 
 /**
- * @file cells.hpp
+ * @file cells.cpp
  * @package cells
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
 
 #include "cells.hpp"
 
+#include <limits>
+#include <cstddef>
+
 namespace memoris
 {
 namespace cells
 {
 
+namespace
+{
+
+using Action = CellAction;
+using Animation = CellAnimation;
+using Transform = transforms::FloorTransform;
+
+/* the transformation of the cells that do not transform the floor, never
+   applied */
+constexpr Transform NO_TRANSFORM {Transform::HORIZONTAL_MIRROR};
+
+/* indexed by the cells identifiers: type, action, animation, transform,
+   emptied on leave, blocking, placeable */
+constexpr CellTraits TRAITS[CELL_TYPES_AMOUNT] {
+    {
+        EMPTY_CELL, Action::NONE, Animation::NONE, NO_TRANSFORM,
+        false, false, true
+    },
+    {
+        DEPARTURE_CELL, Action::NONE, Animation::NONE, NO_TRANSFORM,
+        false, false, true
+    },
+    {
+        ARRIVAL_CELL, Action::ARRIVE, Animation::NONE, NO_TRANSFORM,
+        false, false, true
+    },
+    {
+        STAR_CELL, Action::FIND_STAR, Animation::NONE, NO_TRANSFORM,
+        true, false, true
+    },
+    {
+        MORE_LIFE_CELL, Action::MORE_LIFE, Animation::NONE, NO_TRANSFORM,
+        true, false, true
+    },
+    {
+        LESS_LIFE_CELL, Action::LESS_LIFE, Animation::NONE, NO_TRANSFORM,
+        true, false, true
+    },
+    {
+        MORE_TIME_CELL, Action::MORE_TIME, Animation::NONE, NO_TRANSFORM,
+        true, false, true
+    },
+    {
+        LESS_TIME_CELL, Action::LESS_TIME, Animation::NONE, NO_TRANSFORM,
+        true, false, true
+    },
+    {
+        WALL_CELL, Action::NONE, Animation::NONE, NO_TRANSFORM,
+        true, true, true
+    },
+    {
+        STAIRS_UP_CELL, Action::FLOOR_UP, Animation::STAIRS_UP, NO_TRANSFORM,
+        false, false, true
+    },
+    {
+        STAIRS_DOWN_CELL, Action::FLOOR_DOWN, Animation::STAIRS_DOWN,
+        NO_TRANSFORM, false, false, true
+    },
+    {
+        HORIZONTAL_MIRROR_CELL, Action::TRANSFORM_FLOOR,
+        Animation::HORIZONTAL_MIRROR, Transform::HORIZONTAL_MIRROR,
+        true, false, true
+    },
+    {
+        VERTICAL_MIRROR_CELL, Action::TRANSFORM_FLOOR,
+        Animation::VERTICAL_MIRROR, Transform::VERTICAL_MIRROR,
+        true, false, true
+    },
+    {
+        DIAGONAL_CELL, Action::TRANSFORM_FLOOR, Animation::DIAGONAL,
+        Transform::DIAGONAL, true, false, true
+    },
+    {
+        LEFT_ROTATION_CELL, Action::TRANSFORM_FLOOR, Animation::LEFT_ROTATION,
+        Transform::LEFT_ROTATION, true, false, true
+    },
+    {
+        RIGHT_ROTATION_CELL, Action::TRANSFORM_FLOOR,
+        Animation::RIGHT_ROTATION, Transform::RIGHT_ROTATION,
+        true, false, true
+    },
+    {
+        HIDDEN_CELL, Action::NONE, Animation::NONE, NO_TRANSFORM,
+        true, false, false
+    },
+    {
+        ELEVATOR_UP_CELL, Action::FLOOR_UP, Animation::STAIRS_UP,
+        NO_TRANSFORM, true, false, true
+    },
+    {
+        ELEVATOR_DOWN_CELL, Action::FLOOR_DOWN, Animation::STAIRS_DOWN,
+        NO_TRANSFORM, true, false, true
+    },
+    {
+        QUARTER_ROTATION_CELL, Action::TRANSFORM_FLOOR,
+        Animation::QUARTER_ROTATION, Transform::QUARTER_ROTATION,
+        true, false, true
+    },
+
+    /* the inverted quarter rotation has no effect in the game yet */
+    {
+        INVERTED_QUARTER_ROTATION_CELL, Action::NONE, Animation::NONE,
+        NO_TRANSFORM, true, false, false
+    },
+
+    /* the unknown characters */
+    {
+        '\0', Action::NONE, Animation::NONE, NO_TRANSFORM,
+        true, false, false
+    }
+};
+
+constexpr size_t CHARACTERS_AMOUNT {
+    std::numeric_limits<unsigned char>::max() + 1
+};
+
+/**
+ * the cells identifiers of every possible character
+ */
+struct CellsIds
+{
+    unsigned char ids[CHARACTERS_AMOUNT];
+};
+
+/**
+ * @brief creates the characters to identifiers table at compile time
+ *
+ * @return CellsIds
+ */
+constexpr CellsIds createCellsIds() noexcept
+{
+    CellsIds table {};
+
+    for (size_t character {0}; character < CHARACTERS_AMOUNT; character++)
+    {
+        table.ids[character] = UNKNOWN_CELL_ID;
+    }
+
+    for (unsigned char id {0}; id < UNKNOWN_CELL_ID; id++)
+    {
+        table.ids[static_cast<unsigned char>(TRAITS[id].type)] = id;
+    }
+
+    return table;
+}
+
+constexpr CellsIds CELLS_IDS = createCellsIds();
+
 /**
+ * @brief checks that every known cell type is found back from its own
+ * character, so no character is used twice into the traits table
  *
+ * @return const bool
  */
-template<typename T>
-std::unique_ptr<entities::Cell> getCellByType(
-    const utils::Context& context,
-    const T& horizontalPosition,
-    const T& verticalPosition,
-    const char type
-)
-{
-    return std::make_unique<entities::Cell>(
-        context,
-        HORIZONTAL_POSITION_ORIGIN +
-        CELL_DIMENSIONS * static_cast<float>(horizontalPosition),
-        VERTICAL_POSITION_ORIGIN +
-        CELL_DIMENSIONS * static_cast<float>(verticalPosition),
-        type
-    );
-}
-
-/* declared here because not specified into the header */
-
-template std::unique_ptr<entities::Cell> getCellByType(
-    const utils::Context& context,
-    const unsigned short& horizontalPosition,
-    const unsigned short& verticalPosition,
-    const char type
+constexpr bool checkCellsIds() noexcept
+{
+    for (unsigned char id {0}; id < UNKNOWN_CELL_ID; id++)
+    {
+        if (CELLS_IDS.ids[static_cast<unsigned char>(TRAITS[id].type)] != id)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static_assert(
+    checkCellsIds(),
+    "Every cell type must have its own character."
 );
 
+}
+
+/**
+ *
+ */
+const unsigned char& getCellId(const char& type) noexcept
+{
+    return CELLS_IDS.ids[static_cast<unsigned char>(type)];
+}
+
+/**
+ *
+ */
+const CellTraits& getCellTraits(const char& type) noexcept
+{
+    return TRAITS[getCellId(type)];
+}
+
+/**
+ *
+ */
+const CellTraits& getCellTraitsById(const unsigned char& id) noexcept
+{
+    return TRAITS[id];
+}
+
 }
 }
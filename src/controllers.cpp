@@ -39,6 +39,9 @@
 #include "WinSerieEndingController.hpp"
 #include "RemoveGameController.hpp"
 #include "PersonalSeriesMenuController.hpp"
+#include "Game.hpp"
+#include "snapshots.hpp"
+#include "LevelTemplatesManager.hpp"
 
 namespace memoris
 {
@@ -88,20 +91,58 @@ std::unique_ptr<Controller> getControllerById(
                 );
             }
 
-            /* creates a level object using the next level file path; this path
-               is located inside the context object; this part of the code
-               throws an exception if an error occures during the file reading
-               process; we use auto, the generates type is
-               std::shared_ptr<entities::Level>; create this pointer here
-               instead of directly creating it inside the game controller makes
-               the code easier to maintain; the level pointer is used in the
-               game controller and also in the LevelAnimation object; */
+            /* creates a level object from the template of the next level
+               file; the file is only read and parsed the first time the level
+               is played (or if it has been modified since), so restarting a
+               level is fast; this part of the code throws an exception if an
+               error occures during the file reading process; we use auto, the
+               generates type is std::shared_ptr<entities::Level>; create this
+               pointer here instead of directly creating it inside the game
+               controller makes the code easier to maintain; the level pointer
+               is used in the game controller and also in the LevelAnimation
+               object; */
+            const auto levelTemplate =
+                context.getLevelTemplatesManager().getTemplate(
+                    getLevelFilePath(
+                        serieManager.getSerieType() + "/" +
+                            serieManager.getNextLevelName()
+                    )
+                );
+
             auto level = std::make_shared<entities::Level>(
                 context,
-                getLevelFilePath(
-                    serieManager.getSerieType() + "/" +
-                        serieManager.getNextLevelName()
-                )
+                *levelTemplate
+            );
+
+            if (serieManager.hasResumedLevel())
+            {
+                const auto& resumedLevel = serieManager.getResumedLevel();
+
+                /* the dashboard gets these values from the serie manager
+                   when the game controller is created */
+                serieManager.setLifesAmount(resumedLevel.lifes);
+                serieManager.setWatchingTime(resumedLevel.watchingTime);
+
+                auto controller = std::make_unique<GameController>(
+                    context,
+                    level
+                );
+
+                controller->resumeLevel(
+                    context,
+                    resumedLevel
+                );
+
+                serieManager.clearResumedLevel();
+
+                return std::move(controller);
+            }
+
+            /* the serie can be resumed from the beginning of this level if
+               the game is closed during the level */
+            context.getGame().saveSnapshot(
+                context.getAsyncFileWriter(),
+                serieManager.getSnapshot(true)
             );
 
             return std::make_unique<GameController>(
@@ -0,0 +1,597 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file difficulty.cpp
+ * @package difficulty
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "difficulty.hpp"
+
+#include "LevelTemplatesManager.hpp"
+#include "cells.hpp"
+
+#include <fstream>
+#include <queue>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace memoris
+{
+namespace difficulty
+{
+
+namespace
+{
+
+using Level = entities::Level;
+
+constexpr char LEVELS_DIRECTORY[] {"data/levels/"};
+constexpr char LEVEL_EXTENSION[] {".level"};
+
+constexpr unsigned short UNREACHABLE {
+    std::numeric_limits<unsigned short>::max()
+};
+
+/* the shortest path is exact (every stars order is tried) up to this amount
+   of stars, the nearest star is always chosen first for the bigger levels */
+constexpr unsigned short MAXIMUM_EXACT_STARS {12};
+
+/* the time of one movement when the player follows the path memorized
+   during the watching period; the level timer is paused during the floors
+   animations, so only the keys presses are counted; the official levels give
+   at most this time per movement of their optimal path (95 movements in 20
+   seconds for e.level), so every official level has a positive slack */
+constexpr float SECONDS_PER_MOVEMENT {0.2f};
+
+/* the score weights, empirical values */
+constexpr float CELL_WEIGHT {1.f};
+constexpr float PATH_MOVEMENT_WEIGHT {0.5f};
+constexpr float TRANSFORMATION_WEIGHT {8.f};
+constexpr float TRANSFORMATIONS_TYPE_WEIGHT {4.f};
+constexpr float STAIRS_WEIGHT {2.f};
+constexpr float FLOOR_WEIGHT {6.f};
+constexpr float TIME_PRESSURE_WEIGHT {30.f};
+
+constexpr short MOVEMENTS[] {
+    -Level::CELLS_PER_LINE,
+    Level::CELLS_PER_LINE,
+    -1,
+    1
+};
+
+/* the amount of floors transformations types */
+constexpr size_t TRANSFORMATIONS_TYPES {
+    static_cast<size_t>(transforms::FloorTransform::INVERTED_QUARTER_ROTATION) +
+        1
+};
+
+/**
+ * @brief computes the amount of movements from the given cell to every cell
+ * of the level; the movements follow the game rules (no wall, no movement
+ * out of the floor, the stairs and elevators move the player to the next or
+ * previous floor)
+ *
+ * @param cells the cells types of the level
+ * @param source the index of the departure cell
+ *
+ * @return std::vector<unsigned short> UNREACHABLE for the cells that cannot
+ * be reached
+ */
+std::vector<unsigned short> getDistances(
+    const std::string& cells,
+    const unsigned short& source
+)
+{
+    std::vector<unsigned short> distances(Level::CELLS_PER_LEVEL, UNREACHABLE);
+    distances[source] = 0;
+
+    std::queue<unsigned short> indices;
+    indices.push(source);
+
+    while (!indices.empty())
+    {
+        const unsigned short index = indices.front();
+        indices.pop();
+
+        const unsigned short floor = index / Level::CELLS_PER_FLOOR;
+        const unsigned short column = index % Level::CELLS_PER_LINE;
+
+        for (const short& movement : MOVEMENTS)
+        {
+            const short expectedIndex = index + movement;
+
+            if (
+                expectedIndex < Level::CELLS_PER_FLOOR * floor ||
+                expectedIndex >= Level::CELLS_PER_FLOOR * (floor + 1) ||
+                (column == Level::CELLS_PER_LINE - 1 && movement == 1) ||
+                (column == 0 && movement == -1) ||
+                cells::getCellTraits(cells[expectedIndex]).blocking
+            )
+            {
+                continue;
+            }
+
+            unsigned short destination = expectedIndex;
+
+            switch(cells::getCellTraits(cells[destination]).action)
+            {
+            case cells::CellAction::FLOOR_UP:
+            {
+                if (
+                    destination + Level::CELLS_PER_FLOOR <
+                    Level::CELLS_PER_LEVEL
+                )
+                {
+                    destination += Level::CELLS_PER_FLOOR;
+                }
+
+                break;
+            }
+            case cells::CellAction::FLOOR_DOWN:
+            {
+                if (destination >= Level::CELLS_PER_FLOOR)
+                {
+                    destination -= Level::CELLS_PER_FLOOR;
+                }
+
+                break;
+            }
+            default:
+            {
+                break;
+            }
+            }
+
+            if (distances[destination] != UNREACHABLE)
+            {
+                continue;
+            }
+
+            distances[destination] = distances[index] + 1;
+            indices.push(destination);
+        }
+    }
+
+    return distances;
+}
+
+/**
+ * @brief computes the length of the shortest path that starts from the
+ * departure, finds all the stars and ends on one arrival
+ *
+ * @param cells the cells types of the level
+ * @param departure the index of the departure cell
+ *
+ * @return const unsigned short UNREACHABLE if there is no such path
+ */
+const unsigned short getOptimalPathLength(
+    const std::string& cells,
+    const unsigned short& departure
+)
+{
+    std::vector<unsigned short> stars, arrivals;
+
+    for (unsigned short index {0}; index < Level::CELLS_PER_LEVEL; index++)
+    {
+        const cells::CellAction& action =
+            cells::getCellTraits(cells[index]).action;
+
+        if (action == cells::CellAction::FIND_STAR)
+        {
+            stars.push_back(index);
+        }
+        else if (action == cells::CellAction::ARRIVE)
+        {
+            arrivals.push_back(index);
+        }
+    }
+
+    /* the distances from the departure (first) and from every star */
+    std::vector<std::vector<unsigned short>> distances;
+    distances.push_back(getDistances(cells, departure));
+
+    for (const unsigned short& star : stars)
+    {
+        distances.push_back(getDistances(cells, star));
+    }
+
+    /* the distance from the given key point (0 for the departure, the star
+       index plus one for a star) to the nearest arrival */
+    auto getArrivalDistance = [&distances, &arrivals](const size_t& point)
+    {
+        unsigned short distance {UNREACHABLE};
+
+        for (const unsigned short& arrival : arrivals)
+        {
+            distance = std::min(distance, distances[point][arrival]);
+        }
+
+        return distance;
+    };
+
+    const size_t starsAmount = stars.size();
+
+    if (starsAmount == 0)
+    {
+        return getArrivalDistance(0);
+    }
+
+    unsigned int length {UNREACHABLE};
+
+    if (starsAmount <= MAXIMUM_EXACT_STARS)
+    {
+        /* lengths[found stars mask][last found star] */
+        const size_t masksAmount = static_cast<size_t>(1) << starsAmount;
+        std::vector<std::vector<unsigned int>> lengths(
+            masksAmount,
+            std::vector<unsigned int>(starsAmount, UNREACHABLE)
+        );
+
+        for (size_t star {0}; star < starsAmount; star++)
+        {
+            lengths[static_cast<size_t>(1) << star][star] =
+                distances[0][stars[star]];
+        }
+
+        for (size_t mask {1}; mask < masksAmount; mask++)
+        {
+            for (size_t last {0}; last < starsAmount; last++)
+            {
+                const unsigned int current = lengths[mask][last];
+
+                if (current >= UNREACHABLE)
+                {
+                    continue;
+                }
+
+                for (size_t next {0}; next < starsAmount; next++)
+                {
+                    const size_t nextMask =
+                        mask | (static_cast<size_t>(1) << next);
+                    const unsigned short step =
+                        distances[last + 1][stars[next]];
+
+                    if (nextMask == mask || step == UNREACHABLE)
+                    {
+                        continue;
+                    }
+
+                    lengths[nextMask][next] = std::min(
+                        lengths[nextMask][next],
+                        current + step
+                    );
+                }
+            }
+        }
+
+        for (size_t last {0}; last < starsAmount; last++)
+        {
+            const unsigned short arrivalDistance = getArrivalDistance(last + 1);
+            const unsigned int current = lengths[masksAmount - 1][last];
+
+            if (current < UNREACHABLE && arrivalDistance != UNREACHABLE)
+            {
+                length = std::min(length, current + arrivalDistance);
+            }
+        }
+    }
+    else
+    {
+        std::vector<bool> found(starsAmount, false);
+        size_t point {0};
+        length = 0;
+
+        for (size_t step {0}; step < starsAmount; step++)
+        {
+            size_t nearest {starsAmount};
+
+            for (size_t star {0}; star < starsAmount; star++)
+            {
+                if (
+                    !found[star] &&
+                    (
+                        nearest == starsAmount ||
+                        distances[point][stars[star]] <
+                            distances[point][stars[nearest]]
+                    )
+                )
+                {
+                    nearest = star;
+                }
+            }
+
+            if (distances[point][stars[nearest]] == UNREACHABLE)
+            {
+                return UNREACHABLE;
+            }
+
+            length += distances[point][stars[nearest]];
+            found[nearest] = true;
+            point = nearest + 1;
+        }
+
+        const unsigned short arrivalDistance = getArrivalDistance(point);
+
+        if (arrivalDistance == UNREACHABLE)
+        {
+            return UNREACHABLE;
+        }
+
+        length += arrivalDistance;
+    }
+
+    return static_cast<unsigned short>(
+        std::min(length, static_cast<unsigned int>(UNREACHABLE))
+    );
+}
+
+}
+
+/**
+ *
+ */
+const LevelDifficulty estimateLevel(
+    const managers::LevelTemplate& levelTemplate
+)
+{
+    LevelDifficulty level;
+
+    const std::string& cells = levelTemplate.cells;
+
+    bool usedTypes[TRANSFORMATIONS_TYPES] {};
+
+    for (const char& type : cells)
+    {
+        const cells::CellTraits& traits = cells::getCellTraits(type);
+
+        if (traits.blocking)
+        {
+            continue;
+        }
+
+        level.cellsToMemorize++;
+
+        switch(traits.action)
+        {
+        case cells::CellAction::FLOOR_UP:
+        case cells::CellAction::FLOOR_DOWN:
+        {
+            level.stairs++;
+
+            break;
+        }
+        case cells::CellAction::TRANSFORM_FLOOR:
+        {
+            level.transformations++;
+
+            usedTypes[static_cast<size_t>(traits.transform)] = true;
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+        }
+    }
+
+    level.transformationsTypes = static_cast<unsigned short>(
+        std::count(
+            std::begin(usedTypes),
+            std::end(usedTypes),
+            true
+        )
+    );
+
+    level.usedFloors = levelTemplate.playableFloors;
+
+    const unsigned short pathLength = getOptimalPathLength(
+        cells,
+        levelTemplate.playerIndex
+    );
+
+    level.solvable = pathLength != UNREACHABLE;
+    level.optimalPathLength = level.solvable ? pathLength : 0;
+
+    const float budget = static_cast<float>(
+        levelTemplate.minutes * 60 + levelTemplate.seconds
+    );
+    const float requiredTime = level.optimalPathLength * SECONDS_PER_MOVEMENT;
+
+    level.timeSlack = budget - requiredTime;
+
+    level.score =
+        level.cellsToMemorize * CELL_WEIGHT +
+        level.optimalPathLength * PATH_MOVEMENT_WEIGHT +
+        level.transformations * TRANSFORMATION_WEIGHT +
+        level.transformationsTypes * TRANSFORMATIONS_TYPE_WEIGHT +
+        level.stairs * STAIRS_WEIGHT +
+        level.usedFloors * FLOOR_WEIGHT;
+
+    /* the less time left after the optimal path, the more pressure */
+    if (budget > 0.f)
+    {
+        level.score += TIME_PRESSURE_WEIGHT * requiredTime / budget;
+    }
+
+    return level;
+}
+
+/**
+ *
+ */
+std::vector<LevelDifficulty> estimateLevels(
+    const std::vector<std::string>& filePaths
+)
+{
+    std::vector<LevelDifficulty> levels(filePaths.size());
+
+    const size_t workersAmount = std::max(
+        static_cast<size_t>(1),
+        std::min(
+            static_cast<size_t>(std::thread::hardware_concurrency()),
+            filePaths.size()
+        )
+    );
+
+    /* every worker takes the next level to estimate, so the workers stay
+       busy even if some levels are longer to estimate than the others */
+    std::atomic<size_t> nextLevel {0};
+
+    std::vector<std::exception_ptr> errors(workersAmount);
+
+    auto work = [&](const size_t& worker)
+    {
+        /* the templates manager is not thread safe, one per worker */
+        managers::LevelTemplatesManager levelTemplatesManager;
+
+        try
+        {
+            for (
+                size_t index = nextLevel++;
+                index < filePaths.size();
+                index = nextLevel++
+            )
+            {
+                const std::string& filePath = filePaths[index];
+
+                levels[index] = estimateLevel(
+                    *levelTemplatesManager.getTemplate(filePath)
+                );
+                levels[index].filePath = filePath;
+            }
+        }
+        catch (...)
+        {
+            errors[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (size_t worker {1}; worker < workersAmount; worker++)
+    {
+        workers.emplace_back(work, worker);
+    }
+
+    /* the calling thread is the first worker */
+    work(0);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    return levels;
+}
+
+/**
+ *
+ */
+std::vector<std::string> getSerieLevelsPaths(const std::string& seriePath)
+{
+    std::ifstream file(seriePath);
+
+    if (!file.is_open())
+    {
+        throw std::invalid_argument("Cannot open the given serie file.");
+    }
+
+    const size_t nameSeparator = seriePath.find_last_of('/');
+    const size_t typeSeparator =
+        nameSeparator == std::string::npos || nameSeparator == 0 ?
+            std::string::npos :
+            seriePath.find_last_of('/', nameSeparator - 1);
+    const size_t typeStart =
+        typeSeparator == std::string::npos ? 0 : typeSeparator + 1;
+
+    const std::string directory = LEVELS_DIRECTORY + (
+        nameSeparator == std::string::npos ?
+            std::string() :
+            seriePath.substr(typeStart, nameSeparator - typeStart) + "/"
+    );
+
+    std::vector<std::string> paths;
+    std::string level;
+
+    while (std::getline(file, level))
+    {
+        /* the old series files start with three empty results lines */
+        if (level == "." || level.empty())
+        {
+            continue;
+        }
+
+        paths.push_back(directory + level + LEVEL_EXTENSION);
+    }
+
+    return paths;
+}
+
+/**
+ *
+ */
+const bool isOrderedByDifficulty(
+    const std::vector<LevelDifficulty>& levels
+) noexcept
+{
+    for (size_t index {0}; index < levels.size(); index++)
+    {
+        if (
+            !levels[index].solvable ||
+            (index != 0 && levels[index].score < levels[index - 1].score)
+        )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ *
+ */
+void sortByDifficulty(std::vector<LevelDifficulty>& levels)
+{
+    std::stable_sort(
+        levels.begin(),
+        levels.end(),
+        [](const LevelDifficulty& first, const LevelDifficulty& second)
+        {
+            return first.score < second.score;
+        }
+    );
+}
+
+}
+}
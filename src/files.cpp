@@ -40,5 +40,24 @@ void applyFailbitAndBadbitExceptions(std::ofstream& file)
     );
 }
 
+/**
+ *
+ */
+const uint32_t getChecksum(
+    const char* bytes,
+    const size_t& length
+) noexcept
+{
+    uint32_t hash {2166136261u};
+
+    for (size_t index {0}; index < length; index++)
+    {
+        hash ^= static_cast<unsigned char>(bytes[index]);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
 }
 }
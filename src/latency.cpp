@@ -0,0 +1,461 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file latency.cpp
+ * @package latency
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifdef MEMORIS_TRACK_LATENCY
+
+#include "latency.hpp"
+
+#include <SFML/Window/Event.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace memoris
+{
+namespace latency
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::chrono::milliseconds PROBE_INTERVAL {100};
+constexpr unsigned int PROBE_INPUTS_AMOUNT {600};
+
+/* the player goes around a square, so he comes back to the departure cell
+   if no wall blocks him */
+constexpr sf::Keyboard::Key PROBE_KEYS[] {
+    sf::Keyboard::Up,
+    sf::Keyboard::Right,
+    sf::Keyboard::Down,
+    sf::Keyboard::Left
+};
+
+constexpr size_t PROBE_KEYS_AMOUNT {sizeof(PROBE_KEYS) / sizeof(PROBE_KEYS[0])};
+
+/* upper bounds of the histograms buckets, in milliseconds; one more bucket
+   contains the longer latencies */
+constexpr long long BUCKETS_BOUNDS[] {1, 2, 4, 8, 16, 32, 64, 128, 256};
+
+constexpr size_t BUCKETS_AMOUNT {
+    sizeof(BUCKETS_BOUNDS) / sizeof(BUCKETS_BOUNDS[0]) + 1
+};
+
+/**
+ * one key press that moved the player
+ */
+struct Movement
+{
+    Clock::time_point queued;
+    Clock::time_point changed;
+};
+
+/* the input hooks are called by the main thread, the presentation hooks by
+   the frame presenting thread if it is enabled */
+std::mutex mutex;
+
+std::deque<Clock::time_point> queuedInputs;
+
+Clock::time_point executedInput;
+bool hasExecutedInput {false};
+
+/* the movements follow these lists in order: done after the last started
+   frame, drawn into the current frame, published, displaying */
+std::vector<Movement> changedMovements;
+std::vector<Movement> drawnMovements;
+std::vector<Movement> publishedMovements;
+std::vector<Movement> presentingMovements;
+
+/* the measured latencies, in microseconds */
+std::vector<long long> inputToChangeLatencies;
+std::vector<long long> changeToPresentLatencies;
+std::vector<long long> inputToPresentLatencies;
+
+unsigned int droppedInputs {0};
+unsigned int blockedInputs {0};
+
+/* only used by the main thread */
+bool probing {false};
+Clock::time_point nextInjectionTime;
+unsigned int injectedInputs {0};
+
+/**
+ * @brief returns the microseconds between the two given times
+ *
+ * @param start the first time
+ * @param end the second time
+ *
+ * @return const long long
+ */
+const long long getMicroseconds(
+    const Clock::time_point& start,
+    const Clock::time_point& end
+) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        end - start
+    ).count();
+}
+
+/**
+ * @brief moves all the movements of the source list at the end of the
+ * destination list
+ *
+ * @param source the list to empty
+ * @param destination the list to fill
+ */
+void moveMovements(
+    std::vector<Movement>& source,
+    std::vector<Movement>& destination
+) noexcept
+{
+    destination.insert(
+        destination.end(),
+        source.cbegin(),
+        source.cend()
+    );
+
+    source.clear();
+}
+
+/**
+ * @brief prints the percentiles and the histogram of the given latencies
+ *
+ * @param name the name of the measured interval
+ * @param latencies the latencies in microseconds, sorted by the function
+ */
+void reportLatencies(
+    const char* name,
+    std::vector<long long>& latencies
+) noexcept
+{
+    std::cerr << "latency: " << name << ", " << latencies.size() <<
+        " samples";
+
+    if (latencies.empty())
+    {
+        std::cerr << std::endl;
+
+        return;
+    }
+
+    std::sort(
+        latencies.begin(),
+        latencies.end()
+    );
+
+    const auto getPercentile = [&latencies](const size_t& percent)
+    {
+        return latencies[(latencies.size() - 1) * percent / 100] / 1000.0;
+    };
+
+    std::cerr << ", min " << latencies.front() / 1000.0 << " ms, median " <<
+        getPercentile(50) << " ms, p95 " << getPercentile(95) <<
+        " ms, p99 " << getPercentile(99) << " ms, max " <<
+        latencies.back() / 1000.0 << " ms" << std::endl;
+
+    unsigned int buckets[BUCKETS_AMOUNT] {};
+
+    for (const long long& latency : latencies)
+    {
+        size_t bucket {0};
+
+        while (
+            bucket < BUCKETS_AMOUNT - 1 &&
+            latency >= BUCKETS_BOUNDS[bucket] * 1000
+        )
+        {
+            bucket++;
+        }
+
+        buckets[bucket]++;
+    }
+
+    for (size_t bucket {0}; bucket < BUCKETS_AMOUNT; bucket++)
+    {
+        std::cerr << "latency:   ";
+
+        if (bucket == BUCKETS_AMOUNT - 1)
+        {
+            std::cerr << ">= " << BUCKETS_BOUNDS[bucket - 1];
+        }
+        else
+        {
+            std::cerr << "<  " << BUCKETS_BOUNDS[bucket];
+        }
+
+        std::cerr << " ms: " << buckets[bucket] << " " <<
+            std::string(buckets[bucket] * 50 / latencies.size(), '#') <<
+            std::endl;
+    }
+}
+
+}
+
+/**
+ *
+ */
+void inputQueued() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    queuedInputs.push_back(Clock::now());
+}
+
+/**
+ *
+ */
+void inputDropped() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queuedInputs.empty())
+    {
+        return;
+    }
+
+    queuedInputs.pop_front();
+
+    droppedInputs++;
+}
+
+/**
+ *
+ */
+void inputDequeued() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queuedInputs.empty())
+    {
+        return;
+    }
+
+    /* the previous executed key press did not move the player */
+    if (hasExecutedInput)
+    {
+        blockedInputs++;
+    }
+
+    executedInput = queuedInputs.front();
+    hasExecutedInput = true;
+
+    queuedInputs.pop_front();
+}
+
+/**
+ *
+ */
+void inputsCleared() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    droppedInputs += queuedInputs.size();
+
+    queuedInputs.clear();
+
+    hasExecutedInput = false;
+}
+
+/**
+ *
+ */
+void stateChanged() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!hasExecutedInput)
+    {
+        return;
+    }
+
+    changedMovements.push_back({executedInput, Clock::now()});
+
+    hasExecutedInput = false;
+}
+
+/**
+ *
+ */
+void frameStarted() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    moveMovements(
+        changedMovements,
+        drawnMovements
+    );
+}
+
+/**
+ *
+ */
+void framePublished() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    /* the frames replaced before their display are never presented, their
+       movements are displayed by the next presented frame */
+    moveMovements(
+        drawnMovements,
+        publishedMovements
+    );
+}
+
+/**
+ *
+ */
+void framePresenting() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    moveMovements(
+        publishedMovements,
+        presentingMovements
+    );
+}
+
+/**
+ *
+ */
+void framePresented() noexcept
+{
+    const auto presentedTime = Clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (const Movement& movement : presentingMovements)
+    {
+        inputToChangeLatencies.push_back(
+            getMicroseconds(movement.queued, movement.changed)
+        );
+        changeToPresentLatencies.push_back(
+            getMicroseconds(movement.changed, presentedTime)
+        );
+        inputToPresentLatencies.push_back(
+            getMicroseconds(movement.queued, presentedTime)
+        );
+    }
+
+    presentingMovements.clear();
+}
+
+/**
+ *
+ */
+const bool startProbe() noexcept
+{
+    probing = true;
+
+    nextInjectionTime = Clock::now() + PROBE_INTERVAL;
+
+    return true;
+}
+
+/**
+ *
+ */
+const bool isProbing() noexcept
+{
+    return probing;
+}
+
+/**
+ *
+ */
+const bool pollInjectedEvent(sf::Event& event) noexcept
+{
+    const auto currentTime = Clock::now();
+
+    if (
+        !probing ||
+        injectedInputs > PROBE_INPUTS_AMOUNT ||
+        currentTime < nextInjectionTime
+    )
+    {
+        return false;
+    }
+
+    /* the rate stays fixed, but a long frame never triggers a burst of
+       injected key presses */
+    nextInjectionTime += PROBE_INTERVAL;
+
+    if (nextInjectionTime < currentTime)
+    {
+        nextInjectionTime = currentTime + PROBE_INTERVAL;
+    }
+
+    event.type = sf::Event::KeyPressed;
+    event.key.alt = false;
+    event.key.control = false;
+    event.key.shift = false;
+    event.key.system = false;
+
+    /* the last injected key leaves the game */
+    event.key.code = injectedInputs == PROBE_INPUTS_AMOUNT ?
+        sf::Keyboard::Escape :
+        PROBE_KEYS[injectedInputs % PROBE_KEYS_AMOUNT];
+
+    injectedInputs++;
+
+    return true;
+}
+
+/**
+ *
+ */
+void report() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::cerr << "latency: " << inputToPresentLatencies.size() <<
+        " movements measured, " << blockedInputs << " blocked, " <<
+        droppedInputs << " dropped" << std::endl;
+
+    reportLatencies(
+        "key press to movement",
+        inputToChangeLatencies
+    );
+
+    reportLatencies(
+        "movement to display",
+        changeToPresentLatencies
+    );
+
+    reportLatencies(
+        "key press to display",
+        inputToPresentLatencies
+    );
+}
+
+}
+}
+
+#endif
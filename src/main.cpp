@@ -26,26 +26,230 @@
 #include "controllers.hpp"
 #include "musics.hpp"
 #include "SoundsManager.hpp"
+#include "ResourcesRegistry.hpp"
+#include "allocations.hpp"
+#include "latency.hpp"
+#include "Level.hpp"
+#include "LevelTemplatesManager.hpp"
+#include "EditingLevelManager.hpp"
+#include "simulation.hpp"
+#include "difficulty.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
 using namespace memoris;
 
+namespace
+{
+
+constexpr char SERIE_EXTENSION[] {".serie"};
+
 /**
+ * @brief batch play mode: plays the given levels and series without any
+ * window, music or sound, and prints the results as JSON; the arguments are
+ * [--pace seconds] [--script file] followed by the levels and series files
+ * paths; the pace is the level time of every move; the script file contains
+ * the moves of one level per line (see simulation.hpp), the built-in agent
+ * plays the levels if there is no script; the levels of a serie are played
+ * in a row, with the lifes and the watching time carried from one level to
+ * the next one, as into the game
+ *
+ * @param arguments the arguments following --batch
  *
+ * @return int the program exit code
  */
-int main()
+int playBatch(const std::vector<std::string>& arguments)
 {
+    auto argument = arguments.cbegin();
+
+    std::vector<std::string> scripts;
+    float secondsPerMovement {simulation::DEFAULT_SECONDS_PER_MOVEMENT};
+
+    while (
+        argument != arguments.cend() &&
+        (*argument == "--script" || *argument == "--pace")
+    )
+    {
+        const std::string& option = *argument;
+
+        argument++;
+
+        if (argument == arguments.cend())
+        {
+            break;
+        }
+
+        if (option == "--pace")
+        {
+            try
+            {
+                secondsPerMovement = std::stof(*argument);
+            }
+            catch (const std::logic_error&)
+            {
+                secondsPerMovement = 0.f;
+            }
+
+            if (secondsPerMovement <= 0.f)
+            {
+                std::cerr << "The pace must be a positive amount of " <<
+                    "seconds" << std::endl;
+
+                return EXIT_FAILURE;
+            }
+
+            argument++;
+
+            continue;
+        }
+
+        std::ifstream file(*argument);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Cannot open the moves script" << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        std::string script;
+
+        while (std::getline(file, script))
+        {
+            scripts.push_back(script);
+        }
+
+        argument++;
+    }
+
+    if (argument == arguments.cend())
+    {
+        std::cerr << "Usage: Memoris --batch [--pace seconds] " <<
+            "[--script file] level_or_serie_file..." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        /* a level given alone is a serie of one level */
+        std::vector<simulation::PlayedSerie> series;
+
+        for (; argument != arguments.cend(); argument++)
+        {
+            const std::string& path = *argument;
+            const size_t extensionSize = sizeof(SERIE_EXTENSION) - 1;
+
+            if (
+                path.size() > extensionSize &&
+                path.compare(
+                    path.size() - extensionSize,
+                    extensionSize,
+                    SERIE_EXTENSION
+                ) == 0
+            )
+            {
+                series.push_back(
+                    {
+                        path,
+                        difficulty::getSerieLevelsPaths(path)
+                    }
+                );
+
+                continue;
+            }
+
+            series.push_back({std::string(), {path}});
+        }
+
+        simulation::writeJson(
+            std::cout,
+            simulation::playSeries(
+                series,
+                scripts,
+                secondsPerMovement
+            )
+        );
+    }
+    catch (const std::invalid_argument& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+}
+
+/**
+ *
+ */
+int main(int argc, char* argv[])
+{
+    /* the batch mode is handled before the context creation, so the window,
+       the music and the sounds are never created */
+    if (argc > 1 && std::string(argv[1]) == "--batch")
+    {
+        return playBatch(std::vector<std::string>(argv + 2, argv + argc));
+    }
+
     unsigned short currentControllerId {controllers::MAIN_MENU_CONTROLLER_ID},
              nextControllerId {0};
 
     utils::Context context;
 
+    /* instrumentation build: the given level file is played alone, with key
+       presses injected at a fixed rate, and the program stops when the level
+       is left (see latency.hpp) */
+    if (argc == 3 && std::string(argv[1]) == "--latency-probe")
+    {
+        if (!latency::startProbe())
+        {
+            std::cerr << "The latency probe requires a build with " <<
+                "MEMORIS_TRACK_LATENCY" << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        try
+        {
+            /* the level is played as an edited level, so no serie and no
+               game are required */
+            auto level = std::make_shared<entities::Level>(
+                context,
+                *context.getLevelTemplatesManager().getTemplate(argv[2])
+            );
+
+            context.getEditingLevelManager().setLevel(level);
+        }
+        catch (const std::invalid_argument&)
+        {
+            std::cerr << "Cannot open the level " << argv[2] << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        currentControllerId = controllers::GAME_CONTROLLER_ID;
+    }
+
     auto currentMusicPath = musics::getMusicPathById(currentControllerId);
     context.loadMusicFile(currentMusicPath);
 
     do
     {
+        /* the previous controller has been destroyed, so no one sprite uses
+           the textures that are not used anymore; they are evicted if the
+           resources do not fit the memory budget */
+        context.getResourcesRegistry().collect();
+
         /* get a std::unique_ptr<controllers::Controller> */
         auto pCurrentController =
             controllers::getControllerById(
@@ -55,20 +259,47 @@ int main()
 
         do
         {
+            /* the previous frame is still up to date: the same frame is not
+               rendered again, the loop sleeps until the next event or the next
+               timed update of the controller screen */
+            if (pCurrentController->isIdle(context))
+            {
+                pCurrentController->waitForUpdate(context);
+            }
+
             /* NOTE: this instruction generates memory leaks; as it comes from
                the external dynamic library and because it is an insignificant
                amount of memory (63 bytes), I just ignore it; the generated
                error is (Valgrind) :
                by 0x527434E: sf::RenderTarget::clear(sf::Color const&)
                (in /usr/lib/x86_64-linux-gnu/libsfml-graphics.so.2.1) */
-            context.getSfmlWindow().clear();
+            allocations::startFrame(currentControllerId);
+
+            latency::frameStarted();
+
+            context.getRenderTarget().clear();
+
+            allocations::setPhase(allocations::FramePhase::RENDER);
 
             nextControllerId = pCurrentController->render(context);
 
-            context.getSfmlWindow().display();
+            allocations::setPhase(allocations::FramePhase::DISPLAY);
+
+            context.display();
+
+            allocations::endFrame();
         }
         while (not nextControllerId);
 
+        allocations::endController();
+
+        if (latency::isProbing())
+        {
+            currentControllerId = controllers::EXIT;
+
+            continue;
+        }
+
         if (currentControllerId == controllers::EXIT)
         {
             continue;
@@ -95,7 +326,9 @@ int main()
 
     context.stopMusic();
 
-    context.getSfmlWindow().close();
+    context.closeWindow();
+
+    latency::report();
 
     return EXIT_SUCCESS;
 }
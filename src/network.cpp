@@ -0,0 +1,148 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file network.cpp
+ * @package network
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "network.hpp"
+
+#include <SFML/Network/Packet.hpp>
+
+namespace memoris
+{
+namespace network
+{
+
+/**
+ *
+ */
+void writeBatch(
+    sf::Packet& packet,
+    const std::vector<ResultMessage>& messages
+)
+{
+    packet << PROTOCOL_VERSION;
+    packet << static_cast<sf::Uint16>(messages.size());
+
+    for (const ResultMessage& message : messages)
+    {
+        packet << static_cast<sf::Uint8>(MessageType::RESULT);
+        packet << message.serieName;
+        packet << message.gameName;
+        packet << message.time;
+        packet << static_cast<sf::Uint16>(message.levelsTimes.size());
+
+        for (const sf::Uint16& time : message.levelsTimes)
+        {
+            packet << time;
+        }
+    }
+}
+
+/**
+ *
+ */
+const bool readBatch(
+    sf::Packet& packet,
+    std::vector<ResultMessage>& messages
+)
+{
+    sf::Uint8 version {0};
+    sf::Uint16 messagesAmount {0};
+
+    if (
+        !(packet >> version >> messagesAmount) ||
+        version != PROTOCOL_VERSION ||
+        messagesAmount > MAXIMUM_BATCH_SIZE
+    )
+    {
+        return false;
+    }
+
+    for (sf::Uint16 index {0}; index < messagesAmount; index++)
+    {
+        sf::Uint8 type {0};
+        sf::Uint16 timesAmount {0};
+
+        ResultMessage message;
+
+        if (
+            !(
+                packet >> type >> message.serieName >> message.gameName >>
+                    message.time >> timesAmount
+            ) ||
+            type != static_cast<sf::Uint8>(MessageType::RESULT)
+        )
+        {
+            return false;
+        }
+
+        for (sf::Uint16 time {0}; time < timesAmount; time++)
+        {
+            sf::Uint16 levelTime {0};
+
+            if (!(packet >> levelTime))
+            {
+                return false;
+            }
+
+            message.levelsTimes.push_back(levelTime);
+        }
+
+        messages.push_back(std::move(message));
+    }
+
+    return packet.endOfPacket();
+}
+
+/**
+ *
+ */
+void writeAcknowledgement(
+    sf::Packet& packet,
+    const sf::Uint16& messagesAmount
+)
+{
+    packet << PROTOCOL_VERSION;
+    packet << static_cast<sf::Uint8>(MessageType::ACKNOWLEDGEMENT);
+    packet << messagesAmount;
+}
+
+/**
+ *
+ */
+const bool readAcknowledgement(
+    sf::Packet& packet,
+    sf::Uint16& messagesAmount
+)
+{
+    sf::Uint8 version {0};
+    sf::Uint8 type {0};
+
+    return
+        (packet >> version >> type >> messagesAmount) &&
+        version == PROTOCOL_VERSION &&
+        type == static_cast<sf::Uint8>(MessageType::ACKNOWLEDGEMENT) &&
+        packet.endOfPacket();
+}
+
+}
+}
@@ -0,0 +1,420 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file packs.cpp
+ * @package packs
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "packs.hpp"
+
+#include <cstring>
+
+namespace memoris
+{
+namespace packs
+{
+
+namespace
+{
+
+constexpr std::uint64_t MAGIC_SIZE {sizeof(MAGIC) - 1};
+
+/* the header contains the magic, the format version and the amount of
+   entries; every entry contains the path length, the path, the flags, the
+   offset, the stored size and the size */
+constexpr std::uint64_t HEADER_SIZE {MAGIC_SIZE + 4 + 4};
+constexpr std::uint64_t ENTRY_FIXED_SIZE {2 + 1 + 8 + 8 + 8};
+
+/* LZSS parameters: a match is encoded on two bytes, twelve bits for the
+   distance and four bits for the length */
+constexpr std::uint64_t WINDOW_SIZE {4096};
+constexpr std::uint64_t MINIMUM_MATCH {3};
+constexpr std::uint64_t MAXIMUM_MATCH {MINIMUM_MATCH + 15};
+
+/* items per flags byte, one bit per item, set for a literal */
+constexpr unsigned short GROUP_SIZE {8};
+
+constexpr unsigned short HASH_BITS {14};
+constexpr size_t HASH_SIZE {1 << HASH_BITS};
+
+/* the amount of previous positions compared for every position; more
+   positions give a (slightly) better compression and a slower builder */
+constexpr unsigned short MAXIMUM_CHAIN {32};
+
+/**
+ * @brief appends the given integer into the buffer, little endian
+ *
+ * @param buffer the buffer to write
+ * @param value the integer to write
+ */
+template<typename T>
+void writeInteger(
+    std::string& buffer,
+    const T& value
+)
+{
+    for (size_t byte {0}; byte < sizeof(T); byte++)
+    {
+        buffer.push_back(static_cast<char>((value >> (byte * 8)) & 0xFF));
+    }
+}
+
+/**
+ * @brief reads one little endian integer and moves the position after it
+ *
+ * @param data the read buffer
+ * @param size the size of the buffer
+ * @param position the position of the integer, updated
+ * @param value the read integer
+ *
+ * @return const bool false if the buffer is too short
+ */
+template<typename T>
+const bool readInteger(
+    const char* data,
+    const std::uint64_t& size,
+    std::uint64_t& position,
+    T& value
+)
+{
+    if (size - position < sizeof(T))
+    {
+        return false;
+    }
+
+    value = 0;
+
+    for (size_t byte {0}; byte < sizeof(T); byte++)
+    {
+        value |= static_cast<T>(
+            static_cast<std::uint8_t>(data[position + byte])
+        ) << (byte * 8);
+    }
+
+    position += sizeof(T);
+
+    return true;
+}
+
+/**
+ * @brief returns the hash of the three bytes at the given position
+ *
+ * @param content the first byte
+ *
+ * @return const size_t
+ */
+const size_t getHash(const char* content)
+{
+    const std::uint32_t bytes =
+        static_cast<std::uint8_t>(content[0]) |
+        static_cast<std::uint8_t>(content[1]) << 8 |
+        static_cast<std::uint8_t>(content[2]) << 16;
+
+    /* multiplicative hashing, keeps the highest bits of the product */
+    return (bytes * 2654435761u) >> (32 - HASH_BITS);
+}
+
+}
+
+/**
+ *
+ */
+const std::uint64_t getIndexSize(const std::vector<PackEntry>& entries)
+{
+    std::uint64_t size {HEADER_SIZE};
+
+    for (const PackEntry& entry : entries)
+    {
+        size += ENTRY_FIXED_SIZE + entry.path.size();
+    }
+
+    return size;
+}
+
+/**
+ *
+ */
+void writeIndex(
+    std::string& index,
+    const std::vector<PackEntry>& entries
+)
+{
+    index.append(MAGIC, MAGIC_SIZE);
+
+    writeInteger(index, FORMAT_VERSION);
+    writeInteger(index, static_cast<std::uint32_t>(entries.size()));
+
+    for (const PackEntry& entry : entries)
+    {
+        writeInteger(index, static_cast<std::uint16_t>(entry.path.size()));
+        index.append(entry.path);
+        writeInteger(index, entry.flags);
+        writeInteger(index, entry.offset);
+        writeInteger(index, entry.storedSize);
+        writeInteger(index, entry.size);
+    }
+}
+
+/**
+ *
+ */
+const bool readIndex(
+    const char* data,
+    const std::uint64_t& size,
+    std::vector<PackEntry>& entries
+)
+{
+    std::uint64_t position {MAGIC_SIZE};
+    std::uint32_t version {0};
+    std::uint32_t entriesAmount {0};
+
+    if (
+        size < HEADER_SIZE ||
+        std::memcmp(data, MAGIC, MAGIC_SIZE) != 0 ||
+        !readInteger(data, size, position, version) ||
+        !readInteger(data, size, position, entriesAmount) ||
+        version != FORMAT_VERSION
+    )
+    {
+        return false;
+    }
+
+    for (std::uint32_t index {0}; index < entriesAmount; index++)
+    {
+        std::uint16_t pathLength {0};
+        PackEntry entry;
+
+        if (
+            !readInteger(data, size, position, pathLength) ||
+            size - position < pathLength
+        )
+        {
+            return false;
+        }
+
+        entry.path.assign(data + position, pathLength);
+        position += pathLength;
+
+        if (
+            !readInteger(data, size, position, entry.flags) ||
+            !readInteger(data, size, position, entry.offset) ||
+            !readInteger(data, size, position, entry.storedSize) ||
+            !readInteger(data, size, position, entry.size) ||
+            entry.offset > size ||
+            entry.storedSize > size - entry.offset ||
+            (
+                !(entry.flags & COMPRESSED_ENTRY) &&
+                entry.storedSize != entry.size
+            )
+        )
+        {
+            return false;
+        }
+
+        entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+/**
+ *
+ */
+std::vector<char> compress(
+    const char* content,
+    const std::uint64_t& size
+)
+{
+    std::vector<char> output;
+    output.reserve(size);
+
+    /* the last position of every hash, and the previous position with the
+       same hash for every position */
+    std::vector<std::int64_t> heads(HASH_SIZE, -1);
+    std::vector<std::int64_t> previous(size, -1);
+
+    std::uint64_t position {0};
+    size_t flagsPosition {0};
+    unsigned short item {GROUP_SIZE};
+
+    while (position < size)
+    {
+        if (item == GROUP_SIZE)
+        {
+            flagsPosition = output.size();
+            output.push_back(0);
+
+            item = 0;
+        }
+
+        std::uint64_t bestLength {0};
+        std::uint64_t bestDistance {0};
+
+        if (size - position >= MINIMUM_MATCH)
+        {
+            std::int64_t candidate = heads[getHash(content + position)];
+
+            for (
+                unsigned short depth {0};
+                candidate != -1 && depth < MAXIMUM_CHAIN &&
+                    position - candidate <= WINDOW_SIZE;
+                depth++
+            )
+            {
+                std::uint64_t length {0};
+
+                while (
+                    length < MAXIMUM_MATCH &&
+                    position + length < size &&
+                    content[candidate + length] == content[position + length]
+                )
+                {
+                    length++;
+                }
+
+                if (length > bestLength)
+                {
+                    bestLength = length;
+                    bestDistance = position - candidate;
+                }
+
+                candidate = previous[candidate];
+            }
+        }
+
+        std::uint64_t advance {1};
+
+        if (bestLength >= MINIMUM_MATCH)
+        {
+            const std::uint64_t distance = bestDistance - 1;
+
+            output.push_back(static_cast<char>(distance & 0xFF));
+            output.push_back(
+                static_cast<char>(
+                    ((distance >> 8) << 4) | (bestLength - MINIMUM_MATCH)
+                )
+            );
+
+            advance = bestLength;
+        }
+        else
+        {
+            output[flagsPosition] |= static_cast<char>(1 << item);
+            output.push_back(content[position]);
+        }
+
+        for (
+            std::uint64_t inserted = position;
+            inserted < position + advance;
+            inserted++
+        )
+        {
+            if (size - inserted < MINIMUM_MATCH)
+            {
+                break;
+            }
+
+            const size_t hash = getHash(content + inserted);
+
+            previous[inserted] = heads[hash];
+            heads[hash] = static_cast<std::int64_t>(inserted);
+        }
+
+        position += advance;
+        item++;
+    }
+
+    return output;
+}
+
+/**
+ *
+ */
+const bool decompress(
+    const char* content,
+    const std::uint64_t& storedSize,
+    std::vector<char>& output,
+    const std::uint64_t& size
+)
+{
+    output.resize(size);
+
+    std::uint64_t read {0};
+    std::uint64_t written {0};
+
+    while (written < size)
+    {
+        if (read == storedSize)
+        {
+            return false;
+        }
+
+        const std::uint8_t flags = static_cast<std::uint8_t>(content[read++]);
+
+        for (
+            unsigned short item {0};
+            item < GROUP_SIZE && written < size;
+            item++
+        )
+        {
+            if (flags & (1 << item))
+            {
+                if (read == storedSize)
+                {
+                    return false;
+                }
+
+                output[written++] = content[read++];
+
+                continue;
+            }
+
+            if (storedSize - read < 2)
+            {
+                return false;
+            }
+
+            const std::uint8_t first = static_cast<std::uint8_t>(content[read]);
+            const std::uint8_t second =
+                static_cast<std::uint8_t>(content[read + 1]);
+
+            read += 2;
+
+            const std::uint64_t distance = (first | (second >> 4) << 8) + 1;
+            const std::uint64_t length = (second & 0x0F) + MINIMUM_MATCH;
+
+            if (distance > written || length > size - written)
+            {
+                return false;
+            }
+
+            /* byte by byte: the match can overlap the written bytes */
+            for (std::uint64_t byte {0}; byte < length; byte++, written++)
+            {
+                output[written] = output[written - distance];
+            }
+        }
+    }
+
+    return read == storedSize;
+}
+
+}
+}
@@ -0,0 +1,964 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file simulation.cpp
+ * @package simulation
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "simulation.hpp"
+
+#include "LevelTemplatesManager.hpp"
+#include "transforms.hpp"
+#include "cells.hpp"
+
+#include <queue>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <cctype>
+
+namespace memoris
+{
+namespace simulation
+{
+
+namespace
+{
+
+using Level = entities::Level;
+
+/* the watching time changes of the more and less time cells (see the game
+   controller and the game dashboard) */
+constexpr unsigned short WATCHING_TIME_UPDATE_STEP {3};
+constexpr unsigned short MINIMUM_WATCHING_TIME {3};
+
+/* the control characters are written as \u00XX into the JSON strings */
+constexpr char HEXADECIMAL_DIGITS[] {"0123456789abcdef"};
+constexpr char FIRST_PRINTABLE_CHARACTER {0x20};
+
+constexpr short MOVEMENTS[] {
+    -Level::CELLS_PER_LINE,
+    Level::CELLS_PER_LINE,
+    -1,
+    1
+};
+
+/* the scripts characters of the movements, in the same order */
+constexpr char MOVEMENTS_CHARACTERS[] {'U', 'D', 'L', 'R'};
+
+constexpr const char* OUTCOMES[] {
+    "win",
+    "time over",
+    "no life",
+    "unfinished",
+    "not played"
+};
+
+/**
+ * @brief returns the cell where the player goes when entering the given
+ * cell; the stairs and the elevators move the player to the next or to the
+ * previous floor, if it exists
+ *
+ * @param index the entered cell
+ * @param action the action of the entered cell
+ *
+ * @return const unsigned short
+ */
+const unsigned short getDestination(
+    const unsigned short& index,
+    const cells::CellAction& action
+) noexcept
+{
+    if (
+        action == cells::CellAction::FLOOR_UP &&
+        index + Level::CELLS_PER_FLOOR < Level::CELLS_PER_LEVEL
+    )
+    {
+        return index + Level::CELLS_PER_FLOOR;
+    }
+
+    if (
+        action == cells::CellAction::FLOOR_DOWN &&
+        index >= Level::CELLS_PER_FLOOR
+    )
+    {
+        return index - Level::CELLS_PER_FLOOR;
+    }
+
+    return index;
+}
+
+/**
+ * @brief checks if the player can safely go through the given cell: the
+ * floors transformations change the level and the less life cells may end
+ * the level, so they are only taken if there is no other path
+ *
+ * @param action the action of the cell
+ * @param lifes the current lifes amount
+ *
+ * @return const bool
+ */
+const bool isSafe(
+    const cells::CellAction& action,
+    const unsigned short& lifes
+) noexcept
+{
+    return
+        action != cells::CellAction::TRANSFORM_FLOOR &&
+        (action != cells::CellAction::LESS_LIFE || lifes != 0);
+}
+
+/**
+ * @brief returns the first movement of the shortest path from the player to
+ * the nearest target: a star if some stars are still hidden, the arrival
+ * otherwise; the movements follow the game rules (see the difficulty
+ * distances computation)
+ *
+ * @param level the played level
+ * @param safe true if the unsafe cells cannot be crossed
+ *
+ * @return const short 0 if no target can be reached
+ *
+ * not noexcept because the search containers may throw std::bad_alloc
+ */
+const short getNextMovement(
+    const LevelPlayer& level,
+    const bool& safe
+)
+{
+    const cells::CellAction target =
+        level.getResult().foundStars < level.getResult().starsAmount ?
+            cells::CellAction::FIND_STAR :
+            cells::CellAction::ARRIVE;
+
+    /* the first movement of the path to every visited cell, 0 for the cells
+       that are not visited yet */
+    std::vector<short> firstMovements(Level::CELLS_PER_LEVEL, 0);
+
+    std::queue<unsigned short> indices;
+    indices.push(level.getPlayerIndex());
+
+    while (!indices.empty())
+    {
+        const unsigned short index = indices.front();
+        indices.pop();
+
+        for (const short& movement : MOVEMENTS)
+        {
+            if (!level.isAllowed(index, movement))
+            {
+                continue;
+            }
+
+            const unsigned short expectedIndex = index + movement;
+            const cells::CellAction& action =
+                cells::getCellTraits(level.getCellType(expectedIndex)).action;
+
+            const short firstMovement =
+                index == level.getPlayerIndex() ?
+                    movement : firstMovements[index];
+
+            /* the cells actions are only executed when the player enters
+               them, so a target reached by the stairs is not found */
+            if (action == target)
+            {
+                return firstMovement;
+            }
+
+            if (safe && !isSafe(action, level.getResult().lifes))
+            {
+                continue;
+            }
+
+            const unsigned short destination =
+                getDestination(expectedIndex, action);
+
+            if (
+                destination == level.getPlayerIndex() ||
+                firstMovements[destination] != 0
+            )
+            {
+                continue;
+            }
+
+            firstMovements[destination] = firstMovement;
+            indices.push(destination);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief plays the given level with the built-in agent until the level is
+ * over or no target can be reached
+ *
+ * @param level the played level
+ * @param script the agent moves are appended to this script
+ * @param secondsPerMovement the level time of every move
+ *
+ * not noexcept because the path computation containers may throw
+ * std::bad_alloc
+ */
+void playWithAgent(
+    LevelPlayer& level,
+    std::string& script,
+    const float& secondsPerMovement
+)
+{
+    /* the agent may go back and forth between transformations cells, but
+       every move takes time, so the level always ends */
+    while (!level.isOver())
+    {
+        short movement = getNextMovement(level, true);
+
+        if (movement == 0)
+        {
+            movement = getNextMovement(level, false);
+        }
+
+        if (movement == 0)
+        {
+            break;
+        }
+
+        level.move(
+            movement,
+            level.getResult().time + secondsPerMovement
+        );
+
+        script += MOVEMENTS_CHARACTERS[
+            std::find(
+                std::begin(MOVEMENTS),
+                std::end(MOVEMENTS),
+                movement
+            ) - std::begin(MOVEMENTS)
+        ];
+    }
+}
+
+/**
+ * @brief plays the given moves script on the given level, until the level is
+ * over or the script has no more moves
+ *
+ * @param level the played level
+ * @param script the moves, the characters that are not moves are ignored
+ * @param secondsPerMovement the level time of every move
+ */
+void playScriptMoves(
+    LevelPlayer& level,
+    const std::string& script,
+    const float& secondsPerMovement
+) noexcept
+{
+    for (const char& character : script)
+    {
+        const short movement = getMovement(character);
+
+        if (movement == 0)
+        {
+            continue;
+        }
+
+        level.move(
+            movement,
+            level.getResult().time + secondsPerMovement
+        );
+
+        if (level.isOver())
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief writes the given text as a JSON string
+ *
+ * @param stream the output stream
+ * @param text the text to write
+ */
+void writeJsonString(
+    std::ostream& stream,
+    const std::string& text
+)
+{
+    stream << '"';
+
+    for (const char& character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            stream << '\\' << character;
+        }
+        else if (
+            static_cast<unsigned char>(character) < FIRST_PRINTABLE_CHARACTER
+        )
+        {
+            stream << "\\u00" << HEXADECIMAL_DIGITS[character >> 4] <<
+                HEXADECIMAL_DIGITS[character & 0xf];
+        }
+        else
+        {
+            stream << character;
+        }
+    }
+
+    stream << '"';
+}
+
+}
+
+class LevelPlayer::Impl
+{
+
+public:
+
+    Impl(
+        const managers::LevelTemplate& levelTemplate,
+        const unsigned short& lifes,
+        const unsigned short& watchingTime
+    ) :
+        cells(levelTemplate.cells),
+        playerIndex(levelTemplate.playerIndex),
+        timeBudget(
+            static_cast<float>(
+                levelTemplate.minutes * 60 + levelTemplate.seconds
+            )
+        )
+    {
+        result.starsAmount = levelTemplate.starsAmount;
+        result.lifes = lifes;
+        result.watchingTime = watchingTime;
+    }
+
+    /**
+     * @brief ends the level with the given outcome
+     *
+     * @param outcome the outcome of the level
+     */
+    void end(const Outcome& outcome) & noexcept
+    {
+        result.outcome = outcome;
+
+        over = true;
+    }
+
+    /**
+     * @brief empties the cell the player leaves, as the game controller
+     * does
+     */
+    void emptyPlayerCell() & noexcept
+    {
+        char& type = cells[playerIndex];
+
+        if (cells::getCellTraits(type).emptiedOnLeave)
+        {
+            type = cells::EMPTY_CELL;
+        }
+    }
+
+    /**
+     * @brief applies the effect of the cell the player just entered
+     *
+     * @param report the report of the current move
+     */
+    void executePlayerCellAction(MoveReport& report) & noexcept
+    {
+        const cells::CellTraits& traits =
+            cells::getCellTraits(cells[playerIndex]);
+
+        switch(traits.action)
+        {
+        case cells::CellAction::FIND_STAR:
+        {
+            result.foundStars++;
+
+            report.foundStar = true;
+
+            break;
+        }
+        case cells::CellAction::MORE_LIFE:
+        {
+            result.lifes++;
+
+            break;
+        }
+        case cells::CellAction::LESS_LIFE:
+        {
+            report.lostLife = true;
+
+            if (result.lifes == 0)
+            {
+                end(Outcome::NO_LIFE);
+
+                return;
+            }
+
+            result.lifes--;
+
+            break;
+        }
+        case cells::CellAction::FLOOR_UP:
+        case cells::CellAction::FLOOR_DOWN:
+        {
+            playerIndex = getDestination(playerIndex, traits.action);
+
+            break;
+        }
+        case cells::CellAction::TRANSFORM_FLOOR:
+        {
+            transformFloor(traits.transform);
+
+            break;
+        }
+        case cells::CellAction::ARRIVE:
+        {
+            if (result.foundStars == result.starsAmount)
+            {
+                end(Outcome::WIN);
+            }
+
+            break;
+        }
+
+        /* the more and less time cells only change the watching time of the
+           next levels, they have no effect on the played level */
+        case cells::CellAction::MORE_TIME:
+        {
+            result.watchingTime += WATCHING_TIME_UPDATE_STEP;
+
+            break;
+        }
+        case cells::CellAction::LESS_TIME:
+        {
+            if (result.watchingTime != MINIMUM_WATCHING_TIME)
+            {
+                result.watchingTime -= WATCHING_TIME_UPDATE_STEP;
+            }
+
+            break;
+        }
+        case cells::CellAction::NONE:
+        {
+            break;
+        }
+        }
+    }
+
+    /**
+     * @brief transforms the floor of the player; the player moves with its
+     * cell, as at the end of the matching level animation
+     *
+     * @param transform the transformation to apply
+     */
+    void transformFloor(const transforms::FloorTransform& transform) &
+        noexcept
+    {
+        const unsigned short floorIndex = playerIndex % Level::CELLS_PER_FLOOR;
+        const size_t firstIndex = playerIndex - floorIndex;
+
+        transforms::PackedFloor source;
+        transforms::PackedFloor destination;
+
+        std::copy(
+            cells.cbegin() + firstIndex,
+            cells.cbegin() + firstIndex + Level::CELLS_PER_FLOOR,
+            source.begin()
+        );
+
+        transforms::applyFloorTransform(
+            transform,
+            destination,
+            source
+        );
+
+        std::copy(
+            destination.cbegin(),
+            destination.cend(),
+            cells.begin() + firstIndex
+        );
+
+        playerIndex = firstIndex + transforms::getTransformedIndex(
+            transform,
+            floorIndex
+        );
+    }
+
+    std::string cells;
+
+    unsigned short playerIndex {0};
+
+    LevelResult result;
+
+    bool over {false};
+
+    /* the level time, in seconds */
+    float timeBudget {0.f};
+};
+
+/**
+ *
+ */
+LevelPlayer::LevelPlayer(
+    const managers::LevelTemplate& levelTemplate,
+    const unsigned short& lifes,
+    const unsigned short& watchingTime
+) :
+    impl(
+        std::make_unique<Impl>(
+            levelTemplate,
+            lifes,
+            watchingTime
+        )
+    )
+{
+}
+
+/**
+ *
+ */
+LevelPlayer::~LevelPlayer() noexcept = default;
+
+/**
+ *
+ */
+const MoveReport LevelPlayer::move(
+    const short& movement,
+    const float& time
+) & noexcept
+{
+    MoveReport report;
+
+    if (impl->over)
+    {
+        return report;
+    }
+
+    LevelResult& result = impl->result;
+
+    if (time > impl->timeBudget)
+    {
+        result.time = impl->timeBudget;
+
+        impl->end(Outcome::TIME_OVER);
+
+        return report;
+    }
+
+    result.time = time;
+
+    if (!isAllowed(impl->playerIndex, movement))
+    {
+        result.collisions++;
+
+        /* the floor borders are not cells, only the walls are reported */
+        if (isInsideFloor(impl->playerIndex, movement))
+        {
+            report.hitWall = true;
+            report.wallIndex = impl->playerIndex + movement;
+        }
+
+        return report;
+    }
+
+    impl->emptyPlayerCell();
+
+    impl->playerIndex += movement;
+    result.moves++;
+
+    report.moved = true;
+
+    impl->executePlayerCellAction(report);
+
+    return report;
+}
+
+/**
+ *
+ */
+void LevelPlayer::stop(const float& time) & noexcept
+{
+    if (impl->over || time < impl->timeBudget)
+    {
+        return;
+    }
+
+    impl->result.time = impl->timeBudget;
+
+    impl->end(Outcome::TIME_OVER);
+}
+
+/**
+ *
+ */
+const bool LevelPlayer::isInsideFloor(
+    const unsigned short& index,
+    const short& movement
+) noexcept
+{
+    const unsigned short floor = index / Level::CELLS_PER_FLOOR;
+    const unsigned short column = index % Level::CELLS_PER_LINE;
+    const short expectedIndex = index + movement;
+
+    return !(
+        expectedIndex < Level::CELLS_PER_FLOOR * floor ||
+        expectedIndex >= Level::CELLS_PER_FLOOR * (floor + 1) ||
+        (column == Level::CELLS_PER_LINE - 1 && movement == 1) ||
+        (column == 0 && movement == -1)
+    );
+}
+
+/**
+ *
+ */
+const bool LevelPlayer::isAllowed(
+    const unsigned short& index,
+    const short& movement
+) const & noexcept
+{
+    return
+        isInsideFloor(index, movement) &&
+        !cells::getCellTraits(impl->cells[index + movement]).blocking;
+}
+
+/**
+ *
+ */
+const bool& LevelPlayer::isOver() const & noexcept
+{
+    return impl->over;
+}
+
+/**
+ *
+ */
+const unsigned short& LevelPlayer::getPlayerIndex() const & noexcept
+{
+    return impl->playerIndex;
+}
+
+/**
+ *
+ */
+const char& LevelPlayer::getCellType(const unsigned short& index) const &
+    noexcept
+{
+    return impl->cells[index];
+}
+
+/**
+ *
+ */
+const LevelResult& LevelPlayer::getResult() const & noexcept
+{
+    return impl->result;
+}
+
+/**
+ *
+ */
+const short getMovement(const char& character) noexcept
+{
+    switch(std::toupper(character))
+    {
+    case 'U':
+    {
+        return -Level::CELLS_PER_LINE;
+    }
+    case 'D':
+    {
+        return Level::CELLS_PER_LINE;
+    }
+    case 'L':
+    {
+        return -1;
+    }
+    case 'R':
+    {
+        return 1;
+    }
+    }
+
+    return 0;
+}
+
+/**
+ *
+ */
+const LevelResult playScript(
+    const managers::LevelTemplate& levelTemplate,
+    const std::string& script,
+    const float& secondsPerMovement
+)
+{
+    LevelPlayer level(levelTemplate);
+
+    playScriptMoves(
+        level,
+        script,
+        secondsPerMovement
+    );
+
+    return level.getResult();
+}
+
+/**
+ *
+ */
+const LevelResult playAgent(
+    const managers::LevelTemplate& levelTemplate,
+    const float& secondsPerMovement
+)
+{
+    LevelPlayer level(levelTemplate);
+    std::string script;
+
+    playWithAgent(
+        level,
+        script,
+        secondsPerMovement
+    );
+
+    return level.getResult();
+}
+
+/**
+ *
+ */
+const std::string getAgentScript(
+    const managers::LevelTemplate& levelTemplate,
+    const float& secondsPerMovement
+)
+{
+    LevelPlayer level(levelTemplate);
+    std::string script;
+
+    playWithAgent(
+        level,
+        script,
+        secondsPerMovement
+    );
+
+    return script;
+}
+
+/**
+ *
+ */
+std::vector<LevelResult> playSeries(
+    const std::vector<PlayedSerie>& series,
+    const std::vector<std::string>& scripts,
+    const float& secondsPerMovement
+)
+{
+    /* the index of the first level of every serie into the results and into
+       the scripts */
+    std::vector<size_t> firstLevels;
+    size_t levelsAmount {0};
+
+    for (const PlayedSerie& serie : series)
+    {
+        firstLevels.push_back(levelsAmount);
+        levelsAmount += serie.levelsPaths.size();
+    }
+
+    std::vector<LevelResult> results(levelsAmount);
+
+    const size_t workersAmount = std::max(
+        static_cast<size_t>(1),
+        std::min(
+            static_cast<size_t>(std::thread::hardware_concurrency()),
+            series.size()
+        )
+    );
+
+    /* every worker takes the next serie to play, so the workers stay busy
+       even if some series are longer to play than the others */
+    std::atomic<size_t> nextSerie {0};
+
+    std::vector<std::exception_ptr> errors(workersAmount);
+
+    const std::string noScript;
+
+    auto work = [&](const size_t& worker)
+    {
+        /* the templates manager is not thread safe, one per worker */
+        managers::LevelTemplatesManager levelTemplatesManager;
+
+        try
+        {
+            for (
+                size_t index = nextSerie++;
+                index < series.size();
+                index = nextSerie++
+            )
+            {
+                const PlayedSerie& serie = series[index];
+
+                /* the resources of the serie, as saved by the playing serie
+                   manager at the end of every won level */
+                unsigned short lifes {INITIAL_LIFES};
+                unsigned short watchingTime {INITIAL_WATCHING_TIME};
+                float serieTime {0.f};
+                bool serieOver {false};
+
+                for (
+                    size_t position {0};
+                    position < serie.levelsPaths.size();
+                    position++
+                )
+                {
+                    const size_t level = firstLevels[index] + position;
+                    LevelResult& result = results[level];
+
+                    if (serieOver)
+                    {
+                        result.outcome = Outcome::NOT_PLAYED;
+                    }
+                    else
+                    {
+                        const auto levelTemplate =
+                            levelTemplatesManager.getTemplate(
+                                serie.levelsPaths[position]
+                            );
+
+                        LevelPlayer player(
+                            *levelTemplate,
+                            lifes,
+                            watchingTime
+                        );
+
+                        if (scripts.empty())
+                        {
+                            std::string script;
+
+                            playWithAgent(
+                                player,
+                                script,
+                                secondsPerMovement
+                            );
+                        }
+                        else
+                        {
+                            playScriptMoves(
+                                player,
+                                level < scripts.size() ?
+                                    scripts[level] : noScript,
+                                secondsPerMovement
+                            );
+                        }
+
+                        result = player.getResult();
+
+                        serieTime += result.time;
+                        result.serieTime = serieTime;
+
+                        lifes = result.lifes;
+                        watchingTime = result.watchingTime;
+
+                        serieOver = result.outcome != Outcome::WIN;
+                    }
+
+                    result.filePath = serie.levelsPaths[position];
+                    result.serieFilePath = serie.filePath;
+                }
+            }
+        }
+        catch (...)
+        {
+            errors[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (size_t worker {1}; worker < workersAmount; worker++)
+    {
+        workers.emplace_back(work, worker);
+    }
+
+    /* the calling thread is the first worker */
+    work(0);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    return results;
+}
+
+/**
+ *
+ */
+void writeJson(
+    std::ostream& stream,
+    const std::vector<LevelResult>& results
+)
+{
+    stream << "[";
+
+    for (auto result = results.cbegin(); result != results.cend(); result++)
+    {
+        stream << (result == results.cbegin() ? "\n" : ",\n") <<
+            "  {\"level\": ";
+
+        writeJsonString(stream, result->filePath);
+
+        stream << ", \"serie\": ";
+
+        if (result->serieFilePath.empty())
+        {
+            stream << "null";
+        }
+        else
+        {
+            writeJsonString(stream, result->serieFilePath);
+        }
+
+        stream << ", \"outcome\": \"" <<
+            OUTCOMES[static_cast<size_t>(result->outcome)] <<
+            "\", \"win\": " <<
+            (result->outcome == Outcome::WIN ? "true" : "false") <<
+            ", \"time\": " << result->time <<
+            ", \"moves\": " << result->moves <<
+            ", \"collisions\": " << result->collisions <<
+            ", \"stars\": " << result->foundStars <<
+            ", \"starsAmount\": " << result->starsAmount <<
+            ", \"lifes\": " << result->lifes <<
+            ", \"watchingTime\": " << result->watchingTime <<
+            ", \"serieTime\": " << result->serieTime << "}";
+    }
+
+    stream << "\n]\n";
+}
+
+}
+}
@@ -0,0 +1,424 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file snapshots.cpp
+ * @package snapshots
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "snapshots.hpp"
+
+#include "files.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+
+namespace memoris
+{
+namespace snapshots
+{
+
+namespace
+{
+
+/* the file format is:
+ *
+ * - the "MRSS" magic and the format version (one byte)
+ * - the flags byte (first bit set if there is a level section)
+ * - the serie name, the level index, the lifes, the watching time and the
+ *   total playing time
+ * - the amount of finished levels and their playing times
+ * - the amount of remaining levels and their names
+ * - the level section (if any): the player index, the timer, the found
+ *   stars, the lifes, the watching time, the playing time, one byte per cell
+ *   and one bit per cell visibility
+ * - the FNV-1a checksum of all the previous bytes
+ *
+ * the integers are written in little endian, the strings are prefixed by
+ * their length (one byte) */
+
+constexpr char MAGIC[] {'M', 'R', 'S', 'S'};
+constexpr unsigned short MAGIC_LENGTH {4};
+
+constexpr char VERSION {1};
+
+constexpr char HAS_LEVEL_FLAG {0x01};
+
+constexpr size_t CELLS_PER_LEVEL {2560};
+constexpr size_t VISIBILITIES_BYTES {CELLS_PER_LEVEL / 8};
+
+constexpr size_t MAXIMUM_STRING_LENGTH {255};
+
+constexpr size_t CHECKSUM_LENGTH {4};
+
+/**
+ * @brief appends one unsigned short (two bytes) at the end of the bytes
+ *
+ * @param bytes the bytes to update
+ * @param value the value to append
+ */
+void writeShort(
+    std::vector<char>& bytes,
+    const unsigned short& value
+)
+{
+    bytes.push_back(static_cast<char>(value & 0xFF));
+    bytes.push_back(static_cast<char>((value >> 8) & 0xFF));
+}
+
+/**
+ * @brief appends one string prefixed by its length
+ *
+ * @param bytes the bytes to update
+ * @param value the string to append
+ *
+ * @throw std::invalid_argument the string is too long
+ */
+void writeString(
+    std::vector<char>& bytes,
+    const std::string& value
+)
+{
+    if (value.size() > MAXIMUM_STRING_LENGTH)
+    {
+        throw std::invalid_argument("The snapshot string is too long.");
+    }
+
+    bytes.push_back(static_cast<char>(value.size()));
+    bytes.insert(
+        bytes.end(),
+        value.cbegin(),
+        value.cend()
+    );
+}
+
+/**
+ * sequential reader of the snapshot bytes; every read checks the remaining
+ * length, so a truncated file never leads to an out of range access
+ */
+class Reader
+{
+
+public:
+
+    Reader(
+        const std::vector<char>& bytes,
+        const size_t& length
+    ) noexcept :
+        bytes(bytes),
+        length(length)
+    {
+    }
+
+    const char readByte()
+    {
+        require(1);
+
+        return bytes[position++];
+    }
+
+    const unsigned short readShort()
+    {
+        require(2);
+
+        const unsigned short low =
+            static_cast<unsigned char>(bytes[position]);
+        const unsigned short high =
+            static_cast<unsigned char>(bytes[position + 1]);
+
+        position += 2;
+
+        return low | (high << 8);
+    }
+
+    std::string readString()
+    {
+        const size_t size = static_cast<unsigned char>(readByte());
+
+        require(size);
+
+        std::string value(
+            bytes.cbegin() + position,
+            bytes.cbegin() + position + size
+        );
+
+        position += size;
+
+        return value;
+    }
+
+    std::vector<char> readBytes(const size_t& size)
+    {
+        require(size);
+
+        std::vector<char> value(
+            bytes.cbegin() + position,
+            bytes.cbegin() + position + size
+        );
+
+        position += size;
+
+        return value;
+    }
+
+    const bool isFinished() const & noexcept
+    {
+        return position == length;
+    }
+
+private:
+
+    void require(const size_t& size) const
+    {
+        if (length - position < size)
+        {
+            throw std::invalid_argument("The snapshot is truncated.");
+        }
+    }
+
+    const std::vector<char>& bytes;
+
+    const size_t length;
+
+    size_t position {0};
+};
+
+}
+
+/**
+ *
+ */
+std::vector<char> serialize(const SerieSnapshot& snapshot)
+{
+    std::vector<char> bytes(
+        MAGIC,
+        MAGIC + MAGIC_LENGTH
+    );
+
+    bytes.push_back(VERSION);
+    bytes.push_back(snapshot.hasLevel ? HAS_LEVEL_FLAG : 0);
+
+    writeString(
+        bytes,
+        snapshot.serieName
+    );
+
+    writeShort(bytes, snapshot.levelIndex);
+    writeShort(bytes, snapshot.lifes);
+    writeShort(bytes, snapshot.watchingTime);
+    writeShort(bytes, snapshot.totalPlayingTime);
+
+    writeShort(
+        bytes,
+        static_cast<unsigned short>(snapshot.levelsTimes.size())
+    );
+
+    for (const unsigned short& time : snapshot.levelsTimes)
+    {
+        writeShort(bytes, time);
+    }
+
+    writeShort(
+        bytes,
+        static_cast<unsigned short>(snapshot.levels.size())
+    );
+
+    for (const std::string& level : snapshot.levels)
+    {
+        writeString(
+            bytes,
+            level
+        );
+    }
+
+    if (snapshot.hasLevel)
+    {
+        const LevelSnapshot& level = snapshot.level;
+
+        if (
+            level.cells.size() != CELLS_PER_LEVEL ||
+            level.visibilities.size() != CELLS_PER_LEVEL
+        )
+        {
+            throw std::invalid_argument("The level snapshot is incomplete.");
+        }
+
+        writeShort(bytes, level.playerIndex);
+        writeShort(bytes, level.minutes);
+        writeShort(bytes, level.seconds);
+        writeShort(bytes, level.foundStars);
+        writeShort(bytes, level.lifes);
+        writeShort(bytes, level.watchingTime);
+        writeShort(bytes, level.playingTime);
+
+        bytes.insert(
+            bytes.end(),
+            level.cells.cbegin(),
+            level.cells.cend()
+        );
+
+        /* the visibilities are packed into 320 bytes instead of 2560 */
+        for (size_t byte {0}; byte < VISIBILITIES_BYTES; byte++)
+        {
+            char packed {0};
+
+            for (size_t bit {0}; bit < 8; bit++)
+            {
+                if (level.visibilities[byte * 8 + bit])
+                {
+                    packed |= static_cast<char>(1 << bit);
+                }
+            }
+
+            bytes.push_back(packed);
+        }
+    }
+
+    const uint32_t hash = utils::getChecksum(
+        bytes.data(),
+        bytes.size()
+    );
+
+    writeShort(bytes, static_cast<unsigned short>(hash & 0xFFFF));
+    writeShort(bytes, static_cast<unsigned short>(hash >> 16));
+
+    return bytes;
+}
+
+/**
+ *
+ */
+SerieSnapshot deserialize(const std::vector<char>& bytes)
+{
+    if (
+        bytes.size() < MAGIC_LENGTH + CHECKSUM_LENGTH ||
+        !std::equal(
+            MAGIC,
+            MAGIC + MAGIC_LENGTH,
+            bytes.cbegin()
+        )
+    )
+    {
+        throw std::invalid_argument("The file is not a snapshot.");
+    }
+
+    const size_t length = bytes.size() - CHECKSUM_LENGTH;
+
+    Reader checksumReader(
+        bytes,
+        bytes.size()
+    );
+    checksumReader.readBytes(length);
+
+    const uint32_t low = checksumReader.readShort();
+    const uint32_t high = checksumReader.readShort();
+
+    const uint32_t expectedHash = low | (high << 16);
+
+    if (
+        utils::getChecksum(
+            bytes.data(),
+            length
+        ) != expectedHash
+    )
+    {
+        throw std::invalid_argument("The snapshot is corrupted.");
+    }
+
+    Reader reader(
+        bytes,
+        length
+    );
+    reader.readBytes(MAGIC_LENGTH);
+
+    const char version = reader.readByte();
+
+    if (version != VERSION)
+    {
+        throw std::invalid_argument("Unknown snapshot version.");
+    }
+
+    SerieSnapshot snapshot;
+
+    snapshot.hasLevel = reader.readByte() & HAS_LEVEL_FLAG;
+
+    snapshot.serieName = reader.readString();
+
+    snapshot.levelIndex = reader.readShort();
+    snapshot.lifes = reader.readShort();
+    snapshot.watchingTime = reader.readShort();
+    snapshot.totalPlayingTime = reader.readShort();
+
+    const unsigned short timesAmount = reader.readShort();
+
+    for (unsigned short index {0}; index < timesAmount; index++)
+    {
+        snapshot.levelsTimes.push_back(reader.readShort());
+    }
+
+    const unsigned short levelsAmount = reader.readShort();
+
+    for (unsigned short index {0}; index < levelsAmount; index++)
+    {
+        snapshot.levels.push_back(reader.readString());
+    }
+
+    if (snapshot.hasLevel)
+    {
+        LevelSnapshot& level = snapshot.level;
+
+        level.playerIndex = reader.readShort();
+        level.minutes = reader.readShort();
+        level.seconds = reader.readShort();
+        level.foundStars = reader.readShort();
+        level.lifes = reader.readShort();
+        level.watchingTime = reader.readShort();
+        level.playingTime = reader.readShort();
+
+        level.cells = reader.readBytes(CELLS_PER_LEVEL);
+
+        const std::vector<char> packed = reader.readBytes(VISIBILITIES_BYTES);
+
+        level.visibilities.resize(CELLS_PER_LEVEL);
+
+        for (size_t index {0}; index < CELLS_PER_LEVEL; index++)
+        {
+            level.visibilities[index] = (packed[index / 8] >> (index % 8)) & 1;
+        }
+
+        if (
+            level.playerIndex >= CELLS_PER_LEVEL ||
+            snapshot.levels.empty()
+        )
+        {
+            throw std::invalid_argument("The level snapshot is invalid.");
+        }
+    }
+
+    if (!reader.isFinished())
+    {
+        throw std::invalid_argument("The snapshot has trailing bytes.");
+    }
+
+    return snapshot;
+}
+
+}
+}
@@ -0,0 +1,361 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file transforms.cpp
+ * @package transforms
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "transforms.hpp"
+
+#include "transformsKernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace memoris
+{
+namespace transforms
+{
+
+namespace
+{
+
+constexpr unsigned short HALF_CELLS_PER_LINE {8};
+constexpr unsigned short LAST_LINE_INDEX {15};
+
+/**
+ * @brief detects the best instructions set supported by both of the
+ * processor and the compiled kernels
+ *
+ * @return InstructionsSet
+ */
+InstructionsSet detectInstructionsSet() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+
+    unsigned int eax {0}, ebx {0}, ecx {0}, edx {0};
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return InstructionsSet::SCALAR;
+    }
+
+    constexpr unsigned int SSE4_1_BIT {1u << 19};
+    constexpr unsigned int OSXSAVE_BIT {1u << 27};
+    constexpr unsigned int AVX_BIT {1u << 28};
+    constexpr unsigned int AVX2_BIT {1u << 5};
+
+    const bool sse4 = ecx & SSE4_1_BIT;
+
+    /* AVX2 is usable only if the operating system saves the YMM registers
+       during the context switches (checked through xgetbv) */
+    bool avx2 {false};
+
+    if ((ecx & OSXSAVE_BIT) && (ecx & AVX_BIT) && __get_cpuid_max(0, 0) >= 7)
+    {
+        unsigned int xcrLow {0}, xcrHigh {0};
+        __asm__ ("xgetbv" : "=a" (xcrLow), "=d" (xcrHigh) : "c" (0));
+
+        constexpr unsigned int YMM_STATE_MASK {0x6};
+
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+        avx2 =
+            (xcrLow & YMM_STATE_MASK) == YMM_STATE_MASK &&
+            (ebx & AVX2_BIT);
+    }
+
+    if (avx2 && kernels::hasAvx2Kernels() && kernels::hasSse4Kernels())
+    {
+        return InstructionsSet::AVX2;
+    }
+
+    if (sse4 && kernels::hasSse4Kernels())
+    {
+        return InstructionsSet::SSE4;
+    }
+
+#endif
+
+    return InstructionsSet::SCALAR;
+}
+
+}
+
+/**
+ *
+ */
+void applyFloorTransform(
+    const FloorTransform& transform,
+    PackedFloor& destination,
+    const PackedFloor& source
+) noexcept
+{
+    switch(getInstructionsSet())
+    {
+    case InstructionsSet::AVX2:
+    {
+        kernels::applyAvx2(
+            transform,
+            destination.data(),
+            source.data()
+        );
+
+        break;
+    }
+    case InstructionsSet::SSE4:
+    {
+        kernels::applySse4(
+            transform,
+            destination.data(),
+            source.data()
+        );
+
+        break;
+    }
+    default:
+    {
+        kernels::applyScalar(
+            transform,
+            destination.data(),
+            source.data()
+        );
+    }
+    }
+}
+
+/**
+ *
+ */
+void applyFloorTransformInPlace(
+    const FloorTransform& transform,
+    PackedFloor& types,
+    PackedFloor& visibilities
+) noexcept
+{
+    /* the kernels cannot work in place, a temporary floor is used; this is
+       a 256 bytes array on the stack, no dynamic allocation is required */
+    PackedFloor source = types;
+    applyFloorTransform(
+        transform,
+        types,
+        source
+    );
+
+    source = visibilities;
+    applyFloorTransform(
+        transform,
+        visibilities,
+        source
+    );
+}
+
+/**
+ *
+ */
+const unsigned short getSourceIndex(
+    const FloorTransform& transform,
+    const unsigned short& index
+) noexcept
+{
+    const unsigned short line = index / CELLS_PER_LINE;
+    const unsigned short column = index % CELLS_PER_LINE;
+
+    unsigned short sourceLine {line};
+    unsigned short sourceColumn {column};
+
+    const bool top = line < HALF_CELLS_PER_LINE;
+    const bool left = column < HALF_CELLS_PER_LINE;
+
+    switch(transform)
+    {
+    case FloorTransform::HORIZONTAL_MIRROR:
+    {
+        sourceLine = LAST_LINE_INDEX - line;
+
+        break;
+    }
+    case FloorTransform::VERTICAL_MIRROR:
+    {
+        sourceColumn = LAST_LINE_INDEX - column;
+
+        break;
+    }
+    case FloorTransform::DIAGONAL:
+    {
+        /* top left and bottom right quarters are inverted, top right and
+           bottom left quarters are inverted */
+        sourceLine = (line + HALF_CELLS_PER_LINE) % CELLS_PER_LINE;
+        sourceColumn = (column + HALF_CELLS_PER_LINE) % CELLS_PER_LINE;
+
+        break;
+    }
+    case FloorTransform::LEFT_ROTATION:
+    {
+        sourceLine = column;
+        sourceColumn = LAST_LINE_INDEX - line;
+
+        break;
+    }
+    case FloorTransform::RIGHT_ROTATION:
+    {
+        sourceLine = LAST_LINE_INDEX - column;
+        sourceColumn = line;
+
+        break;
+    }
+    case FloorTransform::QUARTER_ROTATION:
+    {
+        /* each quarter moves to the next one: top right to top left, top
+           left to bottom left, bottom left to bottom right, bottom right to
+           top right */
+        if (top && left)
+        {
+            sourceColumn = column + HALF_CELLS_PER_LINE;
+        }
+        else if (top)
+        {
+            sourceLine = line + HALF_CELLS_PER_LINE;
+        }
+        else if (left)
+        {
+            sourceLine = line - HALF_CELLS_PER_LINE;
+        }
+        else
+        {
+            sourceColumn = column - HALF_CELLS_PER_LINE;
+        }
+
+        break;
+    }
+    case FloorTransform::INVERTED_QUARTER_ROTATION:
+    {
+        if (top && left)
+        {
+            sourceLine = line + HALF_CELLS_PER_LINE;
+        }
+        else if (top)
+        {
+            sourceColumn = column - HALF_CELLS_PER_LINE;
+        }
+        else if (left)
+        {
+            sourceColumn = column + HALF_CELLS_PER_LINE;
+        }
+        else
+        {
+            sourceLine = line - HALF_CELLS_PER_LINE;
+        }
+
+        break;
+    }
+    }
+
+    return sourceLine * CELLS_PER_LINE + sourceColumn;
+}
+
+/**
+ *
+ */
+const unsigned short getTransformedIndex(
+    const FloorTransform& transform,
+    const unsigned short& index
+) noexcept
+{
+    /* the mirrors and the diagonal are their own inverse; the rotations and
+       the quarters rotations are the inverse of each other */
+    switch(transform)
+    {
+    case FloorTransform::LEFT_ROTATION:
+    {
+        return getSourceIndex(
+            FloorTransform::RIGHT_ROTATION,
+            index
+        );
+    }
+    case FloorTransform::RIGHT_ROTATION:
+    {
+        return getSourceIndex(
+            FloorTransform::LEFT_ROTATION,
+            index
+        );
+    }
+    case FloorTransform::QUARTER_ROTATION:
+    {
+        return getSourceIndex(
+            FloorTransform::INVERTED_QUARTER_ROTATION,
+            index
+        );
+    }
+    case FloorTransform::INVERTED_QUARTER_ROTATION:
+    {
+        return getSourceIndex(
+            FloorTransform::QUARTER_ROTATION,
+            index
+        );
+    }
+    default:
+    {
+        return getSourceIndex(
+            transform,
+            index
+        );
+    }
+    }
+}
+
+namespace kernels
+{
+
+/**
+ *
+ */
+void applyScalar(
+    const FloorTransform& transform,
+    char* destination,
+    const char* source
+) noexcept
+{
+    for (
+        unsigned short index {0};
+        index < CELLS_PER_FLOOR;
+        index++
+    )
+    {
+        destination[index] = source[getSourceIndex(transform, index)];
+    }
+}
+
+}
+
+/**
+ *
+ */
+const InstructionsSet& getInstructionsSet() noexcept
+{
+    /* the detection is executed only one time, during the first call */
+    static const InstructionsSet instructionsSet = detectInstructionsSet();
+
+    return instructionsSet;
+}
+
+}
+}
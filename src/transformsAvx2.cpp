@@ -0,0 +1,214 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file transformsAvx2.cpp
+ * @brief AVX2 floor transformations kernels; one YMM register contains two
+ * floor lines, so the whole floor is 8 registers; this file is compiled with
+ * -mavx2 (see CMakeLists.txt)
+ * @package transforms
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "transformsKernels.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace memoris
+{
+namespace transforms
+{
+namespace kernels
+{
+
+#ifdef __AVX2__
+
+namespace
+{
+
+constexpr unsigned short REGISTERS {8};
+constexpr unsigned short HALF_REGISTERS {4};
+
+}
+
+/**
+ *
+ */
+const bool hasAvx2Kernels() noexcept
+{
+    return true;
+}
+
+/**
+ *
+ */
+void applyAvx2(
+    const FloorTransform& transform,
+    char* destination,
+    const char* source
+) noexcept
+{
+    /* the rotations require a bytes transposition that cannot cross the
+       128 bits lanes of the YMM registers; the SSE4 kernel is used instead */
+    if (
+        transform == FloorTransform::LEFT_ROTATION ||
+        transform == FloorTransform::RIGHT_ROTATION
+    )
+    {
+        applySse4(
+            transform,
+            destination,
+            source
+        );
+
+        return;
+    }
+
+    __m256i lines[REGISTERS];
+    __m256i result[REGISTERS];
+
+    for (unsigned short index {0}; index < REGISTERS; index++)
+    {
+        lines[index] = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(source) + index
+        );
+    }
+
+    switch(transform)
+    {
+    case FloorTransform::HORIZONTAL_MIRROR:
+    {
+        /* the registers order is inverted and the two lines of each
+           register are swapped */
+        for (unsigned short index {0}; index < REGISTERS; index++)
+        {
+            const __m256i& pair = lines[REGISTERS - 1 - index];
+
+            result[index] = _mm256_permute2x128_si256(
+                pair,
+                pair,
+                0x01
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::VERTICAL_MIRROR:
+    {
+        const __m256i reverseMask = _mm256_setr_epi8(
+            15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+            15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+        );
+
+        for (unsigned short index {0}; index < REGISTERS; index++)
+        {
+            result[index] = _mm256_shuffle_epi8(
+                lines[index],
+                reverseMask
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::DIAGONAL:
+    {
+        for (unsigned short index {0}; index < REGISTERS; index++)
+        {
+            result[index] = _mm256_shuffle_epi32(
+                lines[(index + HALF_REGISTERS) % REGISTERS],
+                _MM_SHUFFLE(1, 0, 3, 2)
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::QUARTER_ROTATION:
+    {
+        for (unsigned short index {0}; index < HALF_REGISTERS; index++)
+        {
+            const __m256i& top = lines[index];
+            const __m256i& bottom = lines[index + HALF_REGISTERS];
+
+            result[index] = _mm256_unpackhi_epi64(top, bottom);
+            result[index + HALF_REGISTERS] = _mm256_unpacklo_epi64(
+                top,
+                bottom
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::INVERTED_QUARTER_ROTATION:
+    {
+        for (unsigned short index {0}; index < HALF_REGISTERS; index++)
+        {
+            const __m256i& top = lines[index];
+            const __m256i& bottom = lines[index + HALF_REGISTERS];
+
+            result[index] = _mm256_unpacklo_epi64(bottom, top);
+            result[index + HALF_REGISTERS] = _mm256_unpackhi_epi64(
+                bottom,
+                top
+            );
+        }
+
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    for (unsigned short index {0}; index < REGISTERS; index++)
+    {
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(destination) + index,
+            result[index]
+        );
+    }
+}
+
+#else
+
+/**
+ *
+ */
+const bool hasAvx2Kernels() noexcept
+{
+    return false;
+}
+
+/**
+ *
+ */
+void applyAvx2(
+    const FloorTransform&,
+    char*,
+    const char*
+) noexcept
+{
+}
+
+#endif
+
+}
+}
+}
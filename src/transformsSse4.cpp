@@ -0,0 +1,277 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file transformsSse4.cpp
+ * @brief SSE4 floor transformations kernels; one floor line (16 cells) fits
+ * exactly into one XMM register, so the whole floor is 16 registers; this
+ * file is compiled with -msse4.1 (see CMakeLists.txt)
+ * @package transforms
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "transformsKernels.hpp"
+
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+namespace memoris
+{
+namespace transforms
+{
+namespace kernels
+{
+
+#ifdef __SSE4_1__
+
+namespace
+{
+
+constexpr unsigned short LINES {16};
+constexpr unsigned short HALF_LINES {8};
+
+/* the order of the bytes of one line after a vertical mirror */
+constexpr char REVERSE_BYTES_MASK[] {
+    15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+};
+
+/**
+ * @brief loads the 16 lines of a floor into registers
+ *
+ * @param lines the registers to write
+ * @param source the floor to read
+ */
+void loadLines(
+    __m128i* lines,
+    const char* source
+) noexcept
+{
+    for (unsigned short line {0}; line < LINES; line++)
+    {
+        lines[line] = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(source) + line
+        );
+    }
+}
+
+/**
+ * @brief stores the 16 lines registers into a floor
+ *
+ * @param destination the floor to write
+ * @param lines the registers to read
+ */
+void storeLines(
+    char* destination,
+    const __m128i* lines
+) noexcept
+{
+    for (unsigned short line {0}; line < LINES; line++)
+    {
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(destination) + line,
+            lines[line]
+        );
+    }
+}
+
+/**
+ * @brief transposes the 16x16 bytes matrix in place; four perfect shuffles
+ * of the lines (interleaving the line N with the line N + 8) give the
+ * transposed matrix
+ *
+ * @param lines the 16 lines registers
+ */
+void transpose(__m128i* lines) noexcept
+{
+    __m128i shuffled[LINES];
+
+    for (unsigned short step {0}; step < 4; step++)
+    {
+        for (unsigned short line {0}; line < HALF_LINES; line++)
+        {
+            shuffled[2 * line] = _mm_unpacklo_epi8(
+                lines[line],
+                lines[line + HALF_LINES]
+            );
+
+            shuffled[2 * line + 1] = _mm_unpackhi_epi8(
+                lines[line],
+                lines[line + HALF_LINES]
+            );
+        }
+
+        for (unsigned short line {0}; line < LINES; line++)
+        {
+            lines[line] = shuffled[line];
+        }
+    }
+}
+
+}
+
+/**
+ *
+ */
+const bool hasSse4Kernels() noexcept
+{
+    return true;
+}
+
+/**
+ *
+ */
+void applySse4(
+    const FloorTransform& transform,
+    char* destination,
+    const char* source
+) noexcept
+{
+    __m128i lines[LINES];
+    __m128i result[LINES];
+
+    loadLines(
+        lines,
+        source
+    );
+
+    const __m128i reverseMask = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(REVERSE_BYTES_MASK)
+    );
+
+    switch(transform)
+    {
+    case FloorTransform::HORIZONTAL_MIRROR:
+    {
+        for (unsigned short line {0}; line < LINES; line++)
+        {
+            result[line] = lines[LINES - 1 - line];
+        }
+
+        break;
+    }
+    case FloorTransform::VERTICAL_MIRROR:
+    {
+        for (unsigned short line {0}; line < LINES; line++)
+        {
+            result[line] = _mm_shuffle_epi8(
+                lines[line],
+                reverseMask
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::DIAGONAL:
+    {
+        /* the line N + 8 with both of its halves inverted */
+        for (unsigned short line {0}; line < LINES; line++)
+        {
+            result[line] = _mm_shuffle_epi32(
+                lines[(line + HALF_LINES) % LINES],
+                _MM_SHUFFLE(1, 0, 3, 2)
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::LEFT_ROTATION:
+    {
+        transpose(lines);
+
+        for (unsigned short line {0}; line < LINES; line++)
+        {
+            result[line] = lines[LINES - 1 - line];
+        }
+
+        break;
+    }
+    case FloorTransform::RIGHT_ROTATION:
+    {
+        transpose(lines);
+
+        for (unsigned short line {0}; line < LINES; line++)
+        {
+            result[line] = _mm_shuffle_epi8(
+                lines[line],
+                reverseMask
+            );
+        }
+
+        break;
+    }
+    case FloorTransform::QUARTER_ROTATION:
+    {
+        for (unsigned short line {0}; line < HALF_LINES; line++)
+        {
+            const __m128i& top = lines[line];
+            const __m128i& bottom = lines[line + HALF_LINES];
+
+            result[line] = _mm_unpackhi_epi64(top, bottom);
+            result[line + HALF_LINES] = _mm_unpacklo_epi64(top, bottom);
+        }
+
+        break;
+    }
+    case FloorTransform::INVERTED_QUARTER_ROTATION:
+    {
+        for (unsigned short line {0}; line < HALF_LINES; line++)
+        {
+            const __m128i& top = lines[line];
+            const __m128i& bottom = lines[line + HALF_LINES];
+
+            result[line] = _mm_unpacklo_epi64(bottom, top);
+            result[line + HALF_LINES] = _mm_unpackhi_epi64(bottom, top);
+        }
+
+        break;
+    }
+    }
+
+    storeLines(
+        destination,
+        result
+    );
+}
+
+#else
+
+/**
+ *
+ */
+const bool hasSse4Kernels() noexcept
+{
+    return false;
+}
+
+/**
+ *
+ */
+void applySse4(
+    const FloorTransform&,
+    char*,
+    const char*
+) noexcept
+{
+}
+
+#endif
+
+}
+}
+}
@@ -0,0 +1,166 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file allocations.cpp
+ * @brief level rules allocations test, compiled with
+ * MEMORIS_TRACK_ALLOCATIONS; every given level is played by the headless
+ * level rules of the simulation (see simulation.hpp) with the moves script of
+ * the built-in agent; once the level is started, every move is one tracked
+ * frame and the test fails on the first move that allocates; the game
+ * controller, the level cells and the animations need a window, they are not
+ * played here, their frames are only reported by the instrumented game
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "allocations.hpp"
+#include "simulation.hpp"
+#include "LevelTemplatesManager.hpp"
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cstdlib>
+#include <new>
+
+using namespace memoris;
+
+namespace
+{
+
+/* the controller id printed by the allocations reports, the levels are
+   numbered from 1 */
+constexpr unsigned short FIRST_LEVEL_ID {1};
+
+/**
+ * @brief checks that the allocations of one frame are counted, so the test
+ * cannot pass because of a broken tracking
+ *
+ * @return const bool
+ */
+const bool isTrackingAllocations()
+{
+    allocations::startFrame(0);
+
+    /* the allocation function is called directly, the compilers may remove
+       the unused new expressions */
+    void* allocated = ::operator new(1);
+
+    allocations::endFrame();
+    allocations::endController();
+
+    ::operator delete(allocated);
+
+    return allocations::getFrameAllocations() == 1;
+}
+
+}
+
+/**
+ *
+ */
+int main(int argc, char** argv)
+{
+    if (!isTrackingAllocations())
+    {
+        std::cerr << "the allocations are not tracked, the test must be " <<
+            "compiled with MEMORIS_TRACK_ALLOCATIONS" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " level_file..." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    managers::LevelTemplatesManager levelTemplatesManager;
+
+    for (int argument {1}; argument < argc; argument++)
+    {
+        const unsigned short levelId = FIRST_LEVEL_ID + argument - 1;
+
+        std::shared_ptr<const managers::LevelTemplate> levelTemplate;
+        std::string script;
+
+        try
+        {
+            levelTemplate = levelTemplatesManager.getTemplate(argv[argument]);
+            script = simulation::getAgentScript(
+                *levelTemplate,
+                simulation::DEFAULT_SECONDS_PER_MOVEMENT
+            );
+        }
+        catch (const std::exception& exception)
+        {
+            std::cerr << argv[argument] << ": " << exception.what() <<
+                std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        /* the level start copies the cells, only the moves are tracked */
+        simulation::LevelPlayer level(*levelTemplate);
+
+        unsigned short moves {0};
+
+        for (const char& character : script)
+        {
+            allocations::startFrame(levelId);
+
+            level.move(
+                simulation::getMovement(character),
+                (moves + 1) * simulation::DEFAULT_SECONDS_PER_MOVEMENT
+            );
+
+            allocations::endFrame();
+
+            if (allocations::getFrameAllocations() != 0)
+            {
+                std::cerr << argv[argument] << ": the move " << moves <<
+                    " allocates" << std::endl;
+
+                return EXIT_FAILURE;
+            }
+
+            moves++;
+        }
+
+        allocations::startFrame(levelId);
+
+        level.stop(moves * simulation::DEFAULT_SECONDS_PER_MOVEMENT);
+
+        allocations::endFrame();
+        allocations::endController();
+
+        if (allocations::getFrameAllocations() != 0)
+        {
+            std::cerr << argv[argument] << ": the level end allocates" <<
+                std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        std::cout << argv[argument] << ": " << moves <<
+            " simulated moves without allocation" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,529 @@
+/*
+ * Memoris
+ * Copyright (C) 2016  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file transforms.cpp
+ * @brief floor transformations kernels tests; every kernel supported by the
+ * processor (scalar, SSE4, AVX2) is applied on random floors and compared to
+ * a per cell reference; the rotations reference is the per cell algorithm of
+ * the previous RotateFloorAnimation::rotateCells(); the other references
+ * move every cell the way its level animation moves it; exits with a non
+ * zero status on the first difference
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "transforms.hpp"
+#include "transformsKernels.hpp"
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+using namespace memoris;
+
+namespace
+{
+
+using FloorTransform = transforms::FloorTransform;
+using InstructionsSet = transforms::InstructionsSet;
+using PackedFloor = transforms::PackedFloor;
+
+constexpr unsigned short LINES {16};
+constexpr unsigned short HALF_LINES {8};
+constexpr unsigned short LAST_LINE {15};
+
+constexpr unsigned int RANDOM_FLOORS {2000};
+constexpr unsigned int SEED {2016};
+
+/* the cells characters of the levels files and the visibility flags, the
+   random floors only contain these values */
+constexpr char CELLS_CHARACTERS[] {"wesdaflLkKjJuUvVmMnNoO"};
+
+constexpr FloorTransform TRANSFORMS[] {
+    FloorTransform::HORIZONTAL_MIRROR,
+    FloorTransform::VERTICAL_MIRROR,
+    FloorTransform::DIAGONAL,
+    FloorTransform::LEFT_ROTATION,
+    FloorTransform::RIGHT_ROTATION,
+    FloorTransform::QUARTER_ROTATION,
+    FloorTransform::INVERTED_QUARTER_ROTATION
+};
+
+constexpr const char* TRANSFORMS_NAMES[] {
+    "horizontal mirror",
+    "vertical mirror",
+    "diagonal",
+    "left rotation",
+    "right rotation",
+    "quarter rotation",
+    "inverted quarter rotation"
+};
+
+using Kernel = void (*)(const FloorTransform&, char*, const char*) noexcept;
+
+struct KernelEntry
+{
+    const char* name;
+    Kernel kernel;
+};
+
+/**
+ * @brief one floor of the reference, cells types, cells visibilities and
+ * player index
+ */
+struct ReferenceFloor
+{
+    PackedFloor types;
+    PackedFloor visibilities;
+    unsigned short playerIndex;
+};
+
+/**
+ * @brief reference of the rotations, the cells copy order of the previous
+ * RotateFloorAnimation::rotateCells(); the cells are first copied line per
+ * line (reversed for the right rotation), then written column per column
+ * from the bottom left (left rotation) or bottom right (right rotation) cell
+ *
+ * @param floor the floor to rotate
+ * @param direction -1 for the left rotation, 1 for the right rotation
+ */
+void rotateCellsReference(
+    ReferenceFloor& floor,
+    const short& direction
+)
+{
+    struct CopiedCell
+    {
+        char type;
+        char visibility;
+    };
+
+    std::vector<std::vector<CopiedCell>> horizontalLines;
+
+    unsigned short playerColumn = 0,
+                   playerIndex = 0;
+
+    for (
+        unsigned short lines = 0;
+        lines < LINES;
+        lines++
+    )
+    {
+        std::vector<CopiedCell> line;
+        unsigned short offset = 0;
+
+        for (
+            short index = direction == -1 ? 0 : LAST_LINE;
+            index >= 0 && index < LINES;
+            index += direction == -1 ? 1 : -1
+        )
+        {
+            const unsigned short cell = lines * LINES + index;
+
+            line.push_back({floor.types[cell], floor.visibilities[cell]});
+
+            if (cell == floor.playerIndex)
+            {
+                playerColumn = lines;
+                playerIndex = offset;
+            }
+
+            offset++;
+        }
+
+        horizontalLines.push_back(line);
+    }
+
+    unsigned short destination = direction == -1 ? 240 : 255;
+
+    for (unsigned short column = 0; column < LINES; column++)
+    {
+        for (unsigned short index = 0; index < LINES; index++)
+        {
+            floor.types[destination] = horizontalLines[column][index].type;
+            floor.visibilities[destination] =
+                horizontalLines[column][index].visibility;
+
+            if (column == playerColumn && index == playerIndex)
+            {
+                floor.playerIndex = destination;
+            }
+
+            if (destination >= LINES)
+            {
+                destination -= LINES;
+            }
+        }
+
+        if (direction == -1 && destination != LAST_LINE)
+        {
+            destination += 241;
+        }
+        else if (direction == 1 && destination != 0)
+        {
+            destination += 239;
+        }
+    }
+}
+
+/**
+ * @brief returns where the level animation of the given transformation
+ * moves the cell at the given line and column
+ *
+ * @param transform the transformation, neither the left nor the right
+ * rotation
+ * @param line the line of the cell
+ * @param column the column of the cell
+ *
+ * @return unsigned short
+ */
+unsigned short getMovedIndex(
+    const FloorTransform& transform,
+    unsigned short line,
+    unsigned short column
+)
+{
+    const bool top = line < HALF_LINES;
+    const bool left = column < HALF_LINES;
+
+    switch(transform)
+    {
+    case FloorTransform::HORIZONTAL_MIRROR:
+    {
+        line = LAST_LINE - line;
+
+        break;
+    }
+    case FloorTransform::VERTICAL_MIRROR:
+    {
+        column = LAST_LINE - column;
+
+        break;
+    }
+    case FloorTransform::DIAGONAL:
+    {
+        line = top ? line + HALF_LINES : line - HALF_LINES;
+        column = left ? column + HALF_LINES : column - HALF_LINES;
+
+        break;
+    }
+    case FloorTransform::QUARTER_ROTATION:
+    {
+        /* the top left quarter goes down, the bottom left quarter goes
+           right, the bottom right quarter goes up, the top right quarter
+           goes left */
+        if (top && left)
+        {
+            line += HALF_LINES;
+        }
+        else if (left)
+        {
+            column += HALF_LINES;
+        }
+        else if (!top)
+        {
+            line -= HALF_LINES;
+        }
+        else
+        {
+            column -= HALF_LINES;
+        }
+
+        break;
+    }
+    default:
+    {
+        /* inverted quarter rotation, every quarter goes the other way */
+        if (top && left)
+        {
+            column += HALF_LINES;
+        }
+        else if (top)
+        {
+            line += HALF_LINES;
+        }
+        else if (!left)
+        {
+            column -= HALF_LINES;
+        }
+        else
+        {
+            line -= HALF_LINES;
+        }
+    }
+    }
+
+    return line * LINES + column;
+}
+
+/**
+ * @brief applies the reference of the given transformation
+ *
+ * @param transform the transformation to apply
+ * @param floor the floor to transform
+ */
+void applyReference(
+    const FloorTransform& transform,
+    ReferenceFloor& floor
+)
+{
+    if (transform == FloorTransform::LEFT_ROTATION)
+    {
+        rotateCellsReference(floor, -1);
+
+        return;
+    }
+
+    if (transform == FloorTransform::RIGHT_ROTATION)
+    {
+        rotateCellsReference(floor, 1);
+
+        return;
+    }
+
+    ReferenceFloor moved = floor;
+
+    for (
+        unsigned short index {0};
+        index < transforms::CELLS_PER_FLOOR;
+        index++
+    )
+    {
+        const unsigned short destination = getMovedIndex(
+            transform,
+            index / LINES,
+            index % LINES
+        );
+
+        moved.types[destination] = floor.types[index];
+        moved.visibilities[destination] = floor.visibilities[index];
+
+        if (index == floor.playerIndex)
+        {
+            moved.playerIndex = destination;
+        }
+    }
+
+    floor = moved;
+}
+
+/**
+ * @brief returns the kernels supported by the processor
+ *
+ * @return std::vector<KernelEntry>
+ */
+std::vector<KernelEntry> getKernels()
+{
+    std::vector<KernelEntry> kernels {
+        {"scalar", transforms::kernels::applyScalar}
+    };
+
+    const InstructionsSet& instructionsSet = transforms::getInstructionsSet();
+
+    /* AVX2 is only selected when SSE4 is also supported */
+    if (instructionsSet != InstructionsSet::SCALAR)
+    {
+        kernels.push_back({"sse4", transforms::kernels::applySse4});
+    }
+
+    if (instructionsSet == InstructionsSet::AVX2)
+    {
+        kernels.push_back({"avx2", transforms::kernels::applyAvx2});
+    }
+
+    return kernels;
+}
+
+/**
+ * @brief prints the first different cell of two floors
+ *
+ * @param kernel the name of the tested kernel
+ * @param transform the index of the transformation
+ * @param floors the name of the compared floors
+ * @param expected the reference floor
+ * @param result the kernel floor
+ */
+void printDifference(
+    const std::string& kernel,
+    const size_t& transform,
+    const std::string& floors,
+    const PackedFloor& expected,
+    const PackedFloor& result
+)
+{
+    for (
+        unsigned short index {0};
+        index < transforms::CELLS_PER_FLOOR;
+        index++
+    )
+    {
+        if (expected[index] != result[index])
+        {
+            std::cerr << kernel << " " << TRANSFORMS_NAMES[transform] <<
+                ": " << floors << " differ at cell " << index <<
+                " (expected " << static_cast<int>(expected[index]) <<
+                ", got " << static_cast<int>(result[index]) << ")" <<
+                std::endl;
+
+            return;
+        }
+    }
+}
+
+}
+
+/**
+ *
+ */
+int main()
+{
+    std::mt19937 generator {SEED};
+    std::uniform_int_distribution<unsigned short> characters(
+        0,
+        sizeof(CELLS_CHARACTERS) - 2
+    );
+    std::uniform_int_distribution<unsigned short> cells(
+        0,
+        transforms::CELLS_PER_FLOOR - 1
+    );
+    std::bernoulli_distribution visible;
+
+    const std::vector<KernelEntry> kernels = getKernels();
+
+    unsigned int checks {0};
+
+    for (unsigned int floor {0}; floor < RANDOM_FLOORS; floor++)
+    {
+        ReferenceFloor source;
+
+        for (
+            unsigned short index {0};
+            index < transforms::CELLS_PER_FLOOR;
+            index++
+        )
+        {
+            source.types[index] = CELLS_CHARACTERS[characters(generator)];
+            source.visibilities[index] = visible(generator) ? 1 : 0;
+        }
+
+        source.playerIndex = cells(generator);
+
+        for (
+            size_t transform {0};
+            transform < sizeof(TRANSFORMS) / sizeof(FloorTransform);
+            transform++
+        )
+        {
+            ReferenceFloor expected = source;
+            applyReference(TRANSFORMS[transform], expected);
+
+            const unsigned short playerIndex =
+                transforms::getTransformedIndex(
+                    TRANSFORMS[transform],
+                    source.playerIndex
+                );
+
+            if (playerIndex != expected.playerIndex)
+            {
+                std::cerr << TRANSFORMS_NAMES[transform] << ": player " <<
+                    source.playerIndex << " moved to " << playerIndex <<
+                    " instead of " << expected.playerIndex << std::endl;
+
+                return EXIT_FAILURE;
+            }
+
+            for (const KernelEntry& entry : kernels)
+            {
+                PackedFloor types, visibilities;
+
+                entry.kernel(
+                    TRANSFORMS[transform],
+                    types.data(),
+                    source.types.data()
+                );
+
+                entry.kernel(
+                    TRANSFORMS[transform],
+                    visibilities.data(),
+                    source.visibilities.data()
+                );
+
+                if (types != expected.types)
+                {
+                    printDifference(
+                        entry.name,
+                        transform,
+                        "types",
+                        expected.types,
+                        types
+                    );
+
+                    return EXIT_FAILURE;
+                }
+
+                if (visibilities != expected.visibilities)
+                {
+                    printDifference(
+                        entry.name,
+                        transform,
+                        "visibilities",
+                        expected.visibilities,
+                        visibilities
+                    );
+
+                    return EXIT_FAILURE;
+                }
+
+                checks++;
+            }
+
+            /* the in place function used by the level animations must give
+               the same result with the selected kernel */
+            ReferenceFloor inPlace = source;
+            transforms::applyFloorTransformInPlace(
+                TRANSFORMS[transform],
+                inPlace.types,
+                inPlace.visibilities
+            );
+
+            if (
+                inPlace.types != expected.types ||
+                inPlace.visibilities != expected.visibilities
+            )
+            {
+                std::cerr << TRANSFORMS_NAMES[transform] <<
+                    ": the in place transformation differs" << std::endl;
+
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    std::cout << checks << " kernels results checked (";
+
+    for (const KernelEntry& entry : kernels)
+    {
+        std::cout << " " << entry.name;
+    }
+
+    std::cout << " )" << std::endl;
+
+    return EXIT_SUCCESS;
+}